@@ -0,0 +1,94 @@
+#include "polygon_operations/geometry_parser.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+
+// Average time of a call in seconds, repeating the call for at least minimumDuration seconds
+double TimePerCall(const std::function<void()>& call, double minimumDuration = 0.5)
+{
+    size_t calls = 0;
+    auto start = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed(0);
+    do
+    {
+        call();
+        ++calls;
+        elapsed = std::chrono::steady_clock::now() - start;
+    } while (elapsed.count() < minimumDuration);
+    return elapsed.count() / calls;
+}
+
+void Report(const char* name, size_t bytes, size_t geometriesNumber, double time)
+{
+    std::printf("%-32s %10.1f MB/s %12.1f Mgeometries/s\n", name, 1e-6 * bytes / time, 1e-6 * geometriesNumber / time);
+}
+
+int main()
+{
+    // Octagons and points as written by GIS tools, with 17 significant digits
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<double> distribution(-180.0, 180.0);
+    std::string wkt = {};
+    std::vector<uint8_t> wkb = {};
+    char number[64];
+    const auto appendWkb = [&](const void* value, size_t size) {
+        wkb.insert(wkb.end(), static_cast<const uint8_t*>(value), static_cast<const uint8_t*>(value) + size);
+    };
+    size_t geometriesNumber = 0;
+    while (wkt.size() < (size_t(64) << 20))
+    {
+        const double centerX = distribution(gen);
+        const double centerY = distribution(gen);
+        std::snprintf(number, sizeof(number), "POINT (%.17g %.17g)\n", centerX, centerY);
+        wkt += number;
+        const uint8_t littleEndian = 1;
+        const uint32_t pointType = 1, polygonType = 3, ringsNumber = 1, verticesNumber = 9;
+        appendWkb(&littleEndian, 1);
+        appendWkb(&pointType, 4);
+        appendWkb(&centerX, 8);
+        appendWkb(&centerY, 8);
+
+        wkt += "POLYGON ((";
+        appendWkb(&littleEndian, 1);
+        appendWkb(&polygonType, 4);
+        appendWkb(&ringsNumber, 4);
+        appendWkb(&verticesNumber, 4);
+        for (size_t vertexId = 0; vertexId < verticesNumber; ++vertexId)
+        {
+            const double angle = 2.0 * M_PI * (vertexId % 8) / 8;
+            const double x = centerX + 0.01 * cos(angle);
+            const double y = centerY + 0.01 * sin(angle);
+            std::snprintf(number, sizeof(number), "%s%.17g %.17g", (vertexId > 0) ? ", " : "", x, y);
+            wkt += number;
+            appendWkb(&x, 8);
+            appendWkb(&y, 8);
+        }
+        wkt += "))\n";
+        geometriesNumber += 2;
+    }
+
+    GeometryBatch geometries;
+    Report("WKT, 1 thread", wkt.size(), geometriesNumber, TimePerCall([&]() {
+        geometries = GeometryBatch();
+        parse_wkt(wkt.data(), wkt.size(), geometries);
+    }));
+
+    WorkStealingThreadPool pool;
+    char name[64];
+    std::snprintf(name, sizeof(name), "WKT, pool of %zu threads", pool.ThreadsNumber());
+    Report(name, wkt.size(), geometriesNumber, TimePerCall([&]() {
+        geometries = GeometryBatch();
+        parse_wkt(wkt.data(), wkt.size(), geometries, pool);
+    }));
+
+    Report("WKB, 1 thread", wkb.size(), geometriesNumber, TimePerCall([&]() {
+        geometries = GeometryBatch();
+        parse_wkb(wkb.data(), wkb.size(), geometries);
+    }));
+
+    return 0;
+}
@@ -0,0 +1,213 @@
+#include "polygon_operations/predicates.h"
+#include "polygon_operations/convex_hull.h"
+#include "polygon_operations/convex_intersection.h"
+#include "polygon_operations/convex_polygon.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <stdexcept>
+
+// Average time of a call in nanoseconds, repeating the call for at least minimumDuration seconds
+double TimePerCall(const std::function<bool()>& call, double minimumDuration = 0.2)
+{
+    size_t calls = 0;
+    size_t positives = 0;
+    auto start = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed(0);
+    do
+    {
+        positives += call();
+        ++calls;
+        elapsed = std::chrono::steady_clock::now() - start;
+    } while (elapsed.count() < minimumDuration);
+
+    // Use the result so that the calls cannot be optimized away
+    if (positives > calls)
+        std::printf("unexpected result\n");
+
+    return 1e9 * elapsed.count() / calls;
+}
+
+// Minimum times per call of two calls in nanoseconds, alternating short trials of both so that they
+// see the same load, which keeps the ratio of the times stable on a busy machine
+void CompareTimesPerCall(const std::function<bool()>& call1, const std::function<bool()>& call2, double& time1, double& time2)
+{
+    const size_t trials = 9;
+    time1 = TimePerCall(call1, 0.03);
+    time2 = TimePerCall(call2, 0.03);
+    for (size_t trial = 1; trial < trials; ++trial)
+    {
+        time1 = std::min(time1, TimePerCall(call1, 0.03));
+        time2 = std::min(time2, TimePerCall(call2, 0.03));
+    }
+}
+
+// Regular polygon with counterclockwise vertices
+std::vector<Point> CreateRegularPolygon(double centerX, double centerY, double radius, size_t verticesNumber)
+{
+    std::vector<Point> polygon = {};
+    for (size_t vertexId = 0; vertexId < verticesNumber; ++vertexId)
+    {
+        const double angle = 2.0 * M_PI * vertexId / verticesNumber;
+        polygon.emplace_back(Point(centerX + radius * cos(angle), centerY + radius * sin(angle)));
+    }
+    return polygon;
+}
+
+// Times the orientation of every consecutive triple of points with the selected predicate, in nanoseconds per triple
+double TimeOrientation(const std::vector<Point>& points, OrientationPredicate predicate)
+{
+    const size_t triples = points.size() - 2;
+    const double time = TimePerCall([&]() {
+        size_t counterclockwise = 0;
+        for (size_t pointId = 0; pointId < triples; ++pointId)
+            counterclockwise += (orient2d(points[pointId], points[pointId + 1], points[pointId + 2], predicate) > 0.0);
+        return counterclockwise > triples;
+    });
+    return time / triples;
+}
+
+// Share of the triples whose sign is certified by the filter
+double FilterRate(const std::vector<Point>& points)
+{
+    size_t certified = 0;
+    double determinant = 0.0;
+    for (size_t pointId = 0; pointId + 2 < points.size(); ++pointId)
+        certified += orient2d_filter(points[pointId], points[pointId + 1], points[pointId + 2], determinant);
+    return static_cast<double>(certified) / (points.size() - 2);
+}
+
+int main()
+{
+    std::mt19937 gen(42);
+    const size_t pointsNumber = 4096;
+
+    // Uniform points, as in general position workloads
+    std::uniform_real_distribution<double> coordinateDistribution(-1.0, 1.0);
+    std::vector<Point> uniform = {};
+    for (size_t pointId = 0; pointId < pointsNumber; ++pointId)
+        uniform.emplace_back(Point(coordinateDistribution(gen), coordinateDistribution(gen)));
+
+    // Points a few units in the last place away from the line y = x, all nearly collinear
+    std::uniform_int_distribution<int> ulpDistribution(0, 255);
+    std::uniform_real_distribution<double> lineDistribution(0.0, 24.0);
+    std::vector<Point> nearlyCollinear = {};
+    for (size_t pointId = 0; pointId < pointsNumber; ++pointId)
+    {
+        const double t = lineDistribution(gen);
+        nearlyCollinear.emplace_back(Point(t, std::nextafter(t, (ulpDistribution(gen) % 2) ? 0.0 : 48.0)));
+    }
+
+    std::printf("%18s | %12s %16s %9s | %10s\n", "points", "fast [ns]", "adaptive [ns]", "overhead", "filtered");
+    for (const auto* points : {&uniform, &nearlyCollinear})
+    {
+        const double fastTime = TimeOrientation(*points, OrientationPredicate::Fast);
+        const double adaptiveTime = TimeOrientation(*points, OrientationPredicate::Adaptive);
+        std::printf("%18s | %12.2f %16.2f %8.1f%% | %9.3f%%\n", (points == &uniform) ? "uniform" : "nearly collinear",
+                    fastTime, adaptiveTime, 100.0 * (adaptiveTime / fastTime - 1.0), 100.0 * FilterRate(*points));
+    }
+
+    std::printf("\n%18s | %12s %16s %9s\n", "operation", "fast [ns]", "adaptive [ns]", "overhead");
+    // The bounding box of the hull is a fixed cost, which the few tests of the hull of 16 points do not amortize
+    for (size_t verticesNumber : {16, 256, 4096})
+    {
+        std::vector<Point> points(uniform.begin(), uniform.begin() + verticesNumber);
+        double fastTime = 0.0;
+        double adaptiveTime = 0.0;
+        CompareTimesPerCall([&]() { return convex_hull_from_points(points).size() < 3; },
+                            [&]() { return convex_hull_from_points(points, OrientationPredicate::Adaptive).size() < 3; },
+                            fastTime, adaptiveTime);
+        char name[32];
+        std::snprintf(name, sizeof(name), "hull of %zu", verticesNumber);
+        std::printf("%18s | %12.1f %16.1f %8.1f%%\n", name, fastTime, adaptiveTime, 100.0 * (adaptiveTime / fastTime - 1.0));
+    }
+    {
+        // Rotation makes the rows and columns of the grid nearly collinear
+        std::vector<Point> grid = {};
+        for (int i = 0; i < 64; ++i)
+            for (int j = 0; j < 64; ++j)
+                grid.emplace_back(Point(0.1 * (i * cos(0.3) - j * sin(0.3)), 0.1 * (i * sin(0.3) + j * cos(0.3))));
+        const double adaptiveTime =
+            TimePerCall([&]() { return convex_hull_from_points(grid, OrientationPredicate::Adaptive).size() < 3; });
+        // Rounded orientations make the polar order inconsistent, which the fast hull may fail on
+        try
+        {
+            const double fastTime = TimePerCall([&]() { return convex_hull_from_points(grid).size() < 3; });
+            std::printf("%18s | %12.1f %16.1f %8.1f%%\n", "hull of grid", fastTime, adaptiveTime,
+                        100.0 * (adaptiveTime / fastTime - 1.0));
+        }
+        catch (const std::invalid_argument& exception)
+        {
+            std::printf("%18s | %12s %16.1f %9s\n", "hull of grid", "failed", adaptiveTime, "");
+        }
+    }
+    for (size_t verticesNumber : {16, 256, 4096})
+    {
+        const std::vector<Point> polygon1 = CreateRegularPolygon(0.0, 0.0, 1.0, verticesNumber);
+        const std::vector<Point> polygon2 = CreateRegularPolygon(0.5, 0.3, 1.0, verticesNumber);
+        std::vector<Point> intersection(2 * verticesNumber, Point(0.0, 0.0));
+        double fastTime = 0.0;
+        double adaptiveTime = 0.0;
+        CompareTimesPerCall(
+            [&]() {
+                return convex_polygon_intersection(polygon1.data(), verticesNumber, polygon2.data(), verticesNumber,
+                                                   intersection.data()) < 3;
+            },
+            [&]() {
+                return convex_polygon_intersection(polygon1.data(), verticesNumber, polygon2.data(), verticesNumber,
+                                                   intersection.data(), OrientationPredicate::Adaptive) < 3;
+            },
+            fastTime, adaptiveTime);
+        char name[32];
+        std::snprintf(name, sizeof(name), "intersection %zu", verticesNumber);
+        std::printf("%18s | %12.1f %16.1f %8.1f%%\n", name, fastTime, adaptiveTime, 100.0 * (adaptiveTime / fastTime - 1.0));
+    }
+
+    // Batched tests of many points against one edge, in nanoseconds per point
+    std::printf("\n%18s | %12s %16s %16s | %10s\n", "batch", "fast [ns]", "adaptive [ns]", "mixed [ns]", "float");
+    for (const auto* points : {&uniform, &nearlyCollinear})
+    {
+        const Point& a = (*points)[0];
+        const Point& b = (*points)[1];
+        std::vector<signed char> signs(points->size());
+        double times[3] = {};
+        size_t fallbacks = 0;
+        const OrientationPredicate predicates[3] = {OrientationPredicate::Fast, OrientationPredicate::Adaptive,
+                                                    OrientationPredicate::MixedPrecision};
+        for (size_t predicateId = 0; predicateId < 3; ++predicateId)
+        {
+            times[predicateId] = TimePerCall([&]() {
+                fallbacks = orient2d_signs(a, b, points->data(), points->size(), signs.data(), predicates[predicateId]);
+                return signs[0] > 1;
+            }) / points->size();
+        }
+        std::printf("%18s | %12.2f %16.2f %16.2f | %9.3f%%\n", (points == &uniform) ? "signs uniform" : "signs collinear",
+                    times[0], times[1], times[2], 100.0 * (1.0 - static_cast<double>(fallbacks) / points->size()));
+    }
+    {
+        const std::vector<Point> polygon = CreateRegularPolygon(0.0, 0.0, 0.8, 16);
+        double times[3] = {};
+        const OrientationPredicate predicates[3] = {OrientationPredicate::Fast, OrientationPredicate::Adaptive,
+                                                    OrientationPredicate::MixedPrecision};
+        for (size_t predicateId = 0; predicateId < 3; ++predicateId)
+        {
+            times[predicateId] = TimePerCall([&]() {
+                return points_are_in_polygon(uniform, polygon, predicates[predicateId])[0] > 1;
+            }) / uniform.size();
+        }
+        std::printf("%18s | %12.2f %16.2f %16.2f |\n", "containment", times[0], times[1], times[2]);
+
+        for (size_t predicateId = 0; predicateId < 3; ++predicateId)
+        {
+            times[predicateId] = TimePerCall([&]() {
+                return convex_hull_from_points(uniform, predicates[predicateId]).size() < 3;
+            }) / uniform.size();
+        }
+        std::printf("%18s | %12.2f %16.2f %16.2f |\n", "hull", times[0], times[1], times[2]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+"""Benchmark of the Python extension module against pure NumPy baselines.
+
+Run with the module directory in PYTHONPATH, e.g. from a build configured with -DENABLE_PYTHON=ON:
+    PYTHONPATH=build/python python3 benchmark/python_benchmark.py
+"""
+import threading
+import time
+
+import numpy
+
+import polygon_operations
+
+
+def time_per_call(call, minimum_duration=0.5):
+    """Average time of a call in seconds, repeating the call for at least minimum_duration seconds"""
+    calls = 0
+    start = time.perf_counter()
+    while True:
+        call()
+        calls += 1
+        elapsed = time.perf_counter() - start
+        if elapsed >= minimum_duration:
+            return elapsed / calls
+
+
+def regular_polygons(polygons_number, vertices_number, rng):
+    """Vertices and CSR offsets of random regular polygons moving counterclockwise"""
+    angles = 2.0 * numpy.pi * numpy.arange(vertices_number) / vertices_number
+    centers = rng.uniform(-10.0, 10.0, (polygons_number, 1, 2))
+    radii = rng.uniform(0.5, 1.5, (polygons_number, 1, 1))
+    vertices = centers + radii * numpy.stack([numpy.cos(angles), numpy.sin(angles)], axis=1)[numpy.newaxis]
+    offsets = numpy.arange(polygons_number + 1, dtype=numpy.int64) * vertices_number
+    return numpy.ascontiguousarray(vertices.reshape(-1, 2)), offsets
+
+
+def numpy_convex_hull(points):
+    """Andrew's monotone chain with the sort in NumPy, since NumPy has no convex hull"""
+    order = numpy.lexsort((points[:, 1], points[:, 0]))
+    sorted_points = points[order]
+
+    def chain(chain_points):
+        hull = []
+        for point in chain_points:
+            while len(hull) >= 2:
+                (ox, oy), (ax, ay) = hull[-2], hull[-1]
+                if (ax - ox) * (point[1] - oy) - (ay - oy) * (point[0] - ox) > 0.0:
+                    break
+                hull.pop()
+            hull.append((point[0], point[1]))
+        return hull
+
+    lower = chain(sorted_points.tolist())
+    upper = chain(sorted_points[::-1].tolist())
+    return numpy.array(lower[:-1] + upper[:-1])
+
+
+def numpy_points_in_polygon(points, polygon):
+    """Cross products of every point with every edge, broadcast over an (n, m) array"""
+    edges = numpy.roll(polygon, -1, axis=0) - polygon
+    relative = points[:, numpy.newaxis, :] - polygon[numpy.newaxis, :, :]
+    crosses = edges[numpy.newaxis, :, 0] * relative[:, :, 1] - edges[numpy.newaxis, :, 1] * relative[:, :, 0]
+    return (crosses >= 0.0).all(axis=1)
+
+
+def numpy_polygon_areas(vertices, vertices_number):
+    """Shoelace areas of polygons with the same number of vertices"""
+    polygons = vertices.reshape(-1, vertices_number, 2)
+    following = numpy.roll(polygons, -1, axis=1)
+    return 0.5 * (polygons[:, :, 0] * following[:, :, 1] - following[:, :, 0] * polygons[:, :, 1]).sum(axis=1)
+
+
+def numpy_do_intersect(vertices, polygon, vertices_number):
+    """Separating axis test of polygons with the same number of vertices against one polygon"""
+    polygons = vertices.reshape(-1, vertices_number, 2)
+    separated = numpy.zeros(len(polygons), dtype=bool)
+    for axes_polygons in (polygons, numpy.broadcast_to(polygon, (len(polygons),) + polygon.shape)):
+        edges = numpy.roll(axes_polygons, -1, axis=1) - axes_polygons
+        normals = numpy.stack([-edges[:, :, 1], edges[:, :, 0]], axis=2)
+        projections1 = numpy.einsum('pak,pvk->pav', normals, polygons)
+        projections2 = numpy.einsum('pak,vk->pav', normals, polygon)
+        separated |= ((projections1.max(axis=2) < projections2.min(axis=2)) |
+                      (projections2.max(axis=2) < projections1.min(axis=2))).any(axis=1)
+    return ~separated
+
+
+def report(name, baseline, extension):
+    print(f"{name:<40} numpy {1e3 * baseline:9.3f} ms   extension {1e3 * extension:9.3f} ms   speedup {baseline / extension:6.1f}x")
+
+
+def main():
+    rng = numpy.random.default_rng(0)
+
+    points = rng.uniform(-1.0, 1.0, (100000, 2))
+    assert len(numpy_convex_hull(points)) == len(polygon_operations.convex_hull(points, 'adaptive'))
+    report("convex hull, 100000 points",
+           time_per_call(lambda: numpy_convex_hull(points)),
+           time_per_call(lambda: polygon_operations.convex_hull(points)))
+
+    polygon = polygon_operations.convex_hull(rng.uniform(-1.0, 1.0, (64, 2)))
+    assert (numpy_points_in_polygon(points, polygon) == polygon_operations.points_in_polygon(points, polygon)).all()
+    report(f"containment, 100000 points, {len(polygon)} vertices",
+           time_per_call(lambda: numpy_points_in_polygon(points, polygon)),
+           time_per_call(lambda: polygon_operations.points_in_polygon(points, polygon)))
+    points32 = points.astype(numpy.float32)
+    report("containment, float32 points",
+           time_per_call(lambda: numpy_points_in_polygon(points32, polygon.astype(numpy.float32))),
+           time_per_call(lambda: polygon_operations.points_in_polygon(points32, polygon)))
+
+    vertices, offsets = regular_polygons(100000, 8, rng)
+    assert numpy.allclose(numpy_polygon_areas(vertices, 8), polygon_operations.polygon_metrics_batch(vertices, offsets)[:, 0])
+    report("areas, 100000 octagons",
+           time_per_call(lambda: numpy_polygon_areas(vertices, 8)),
+           time_per_call(lambda: polygon_operations.polygon_metrics_batch(vertices, offsets)))
+
+    square = numpy.array([[-5.0, -5.0], [5.0, -5.0], [5.0, 5.0], [-5.0, 5.0]])
+    square_offsets = numpy.array([0, 4], dtype=numpy.int64)
+    assert (numpy_do_intersect(vertices, square, 8) == polygon_operations.do_intersect_batch(vertices, offsets, square, square_offsets)).all()
+    report("intersection, 100000 octagons, square",
+           time_per_call(lambda: numpy_do_intersect(vertices, square, 8)),
+           time_per_call(lambda: polygon_operations.do_intersect_batch(vertices, offsets, square, square_offsets)))
+
+    # The extension releases the GIL, so the queries of several Python threads run in parallel
+    def run_threads(threads_number):
+        chunks = numpy.array_split(points, threads_number)
+        threads = [threading.Thread(target=polygon_operations.points_in_polygon, args=(chunk, polygon)) for chunk in chunks]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+    single = time_per_call(lambda: run_threads(1))
+    for threads_number in (2, 4):
+        multiple = time_per_call(lambda: run_threads(threads_number))
+        print(f"containment on {threads_number} Python threads: {single / multiple:4.1f}x the throughput of 1 thread")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,67 @@
+#include "polygon_operations/convex_polygon.h"
+#include "polygon_operations/sat_kernel.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+
+// Regular polygon with counterclockwise vertices
+std::vector<Point> CreateRegularPolygon(double centerX, double centerY, double radius, size_t verticesNumber)
+{
+    std::vector<Point> polygon = {};
+    for (size_t vertexId = 0; vertexId < verticesNumber; ++vertexId)
+    {
+        const double angle = 2.0 * M_PI * vertexId / verticesNumber;
+        polygon.emplace_back(Point(centerX + radius * cos(angle), centerY + radius * sin(angle)));
+    }
+    return polygon;
+}
+
+// Average time of a call in nanoseconds, repeating the call for at least minimumDuration seconds
+double TimePerCall(const std::function<bool()>& call, double minimumDuration = 0.2)
+{
+    size_t calls = 0;
+    size_t intersections = 0;
+    auto start = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed(0);
+    do
+    {
+        intersections += call();
+        ++calls;
+        elapsed = std::chrono::steady_clock::now() - start;
+    } while (elapsed.count() < minimumDuration);
+
+    // Use the result so that the calls cannot be optimized away
+    if (intersections > calls)
+        std::printf("unexpected result\n");
+
+    return 1e9 * elapsed.count() / calls;
+}
+
+int main()
+{
+    std::printf("%8s %12s | %16s %16s %8s | %16s %9s\n", "vertices", "case", "reference [ns]", "kernel [ns]", "speedup",
+                "with MTV [ns]", "overhead");
+
+    for (size_t verticesNumber : {3, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096})
+    {
+        const std::vector<Point> polygon1 = CreateRegularPolygon(0.0, 0.0, 1.0, verticesNumber);
+        // Intersecting polygons force the test of every axis, which is the worst case
+        const std::vector<Point> intersecting = CreateRegularPolygon(0.5, 0.3, 1.0, verticesNumber);
+        const std::vector<Point> separated = CreateRegularPolygon(2.5, 0.3, 1.0, verticesNumber);
+
+        for (const auto* polygon2 : {&intersecting, &separated})
+        {
+            const double referenceTime = TimePerCall([&]() { return do_intersect_reference(polygon1, *polygon2); });
+            const double kernelTime = TimePerCall([&]() { return do_intersect(polygon1, *polygon2); });
+            MinimumTranslation translation;
+            const double translationTime = TimePerCall([&]() { return do_intersect(polygon1, *polygon2, translation); });
+
+            std::printf("%8zu %12s | %16.1f %16.1f %7.1fx | %16.1f %8.1f%%\n", verticesNumber,
+                        (polygon2 == &intersecting) ? "intersecting" : "separated", referenceTime, kernelTime,
+                        referenceTime / kernelTime, translationTime, 100.0 * (translationTime / kernelTime - 1.0));
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+/*!
+ * Options of a MonotonicArena
+ */
+struct ArenaOptions
+{
+    /// Size of the chunks requested from the system, larger requests get a chunk of their own,
+    /// which is returned to the system when the arena rewinds to its first chunk
+    size_t chunkSize = size_t(1) << 20;
+
+    /// Back the chunks with transparent huge pages (Linux only, ignored elsewhere), which reduces
+    /// the TLB misses of arenas of many megabytes
+    bool hugePages = false;
+};
+
+/*!
+ * Memory resource handing out memory by bumping a pointer inside chunks requested from the system,
+ * for the many short-lived polygons and scratch buffers of a batch job. Deallocation does nothing,
+ * and all the memory is reclaimed at once by Reset, which rewinds to the first chunk and keeps the
+ * chunks for reuse, or by Rewind to a marker taken earlier. The chunks of options.chunkSize bytes
+ * are returned to the system only when the arena is destroyed, while the larger chunks of the large
+ * requests are returned whenever the arena rewinds to its first chunk, e.g. by Reset or at the end of
+ * the outermost ArenaScope, so that one large call does not pin its peak memory until the thread
+ * exits. Rewinding is O(1) otherwise, and O(number of chunks) when it returns to the first chunk.
+ * An arena is not thread-safe, see thread_local_arena.
+ * It is used through std::pmr containers, e.g. std::pmr::vector<Point> polygon(&arena).
+ */
+class MonotonicArena : public std::pmr::memory_resource
+{
+public:
+    /// Position of the arena, for rewinding the allocations made after it
+    struct Marker
+    {
+        size_t chunk;
+        size_t offset;
+    };
+
+    explicit MonotonicArena(const ArenaOptions& options = ArenaOptions());
+    ~MonotonicArena();
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    /// Reclaims all the allocations, keeping the regular chunks for reuse and releasing the larger ones
+    void Reset();
+
+    /// Current position of the arena
+    Marker Mark() const {return {currentChunk, offset};}
+
+    /// Reclaims the allocations made after the marker was taken, releasing the chunks larger than
+    /// the regular ones when the marker is in the first chunk, which invalidates the later markers
+    void Rewind(const Marker& marker);
+
+    /// Bytes requested from the system
+    size_t BytesReserved() const;
+
+    /// Bytes handed out since the last reset, including the padding for alignment
+    size_t BytesUsed() const;
+
+    /// Options of the arena
+    const ArenaOptions& Options() const {return options;}
+
+private:
+    struct Chunk
+    {
+        char* memory;
+        size_t size;
+    };
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {return this == &other;}
+
+    /// Requests a chunk of at least the given size from the system
+    Chunk AllocateChunk(size_t minimumSize) const;
+
+    /// Returns a chunk to the system
+    void FreeChunk(const Chunk& chunk) const;
+
+    /// Returns the chunks larger than options.chunkSize from the given one onwards to the system,
+    /// keeping the order of the other chunks
+    void ReleaseOversizeChunks(size_t firstChunk);
+
+    ArenaOptions options;
+    std::vector<Chunk> chunks;
+    size_t currentChunk;
+    size_t offset;
+};
+
+/*!
+ * Arena of the calling thread, with the default options. The library draws its internal scratch
+ * buffers from it inside an ArenaScope, so a batch job running on the threads of a
+ * WorkStealingThreadPool reuses the same memory for every polygon instead of calling malloc.
+ * User code may allocate from it as well and Reset it between batches, as long as no arena scope
+ * is open on the thread and no allocation is in use.
+ * \return The arena of the calling thread
+ */
+MonotonicArena& thread_local_arena();
+
+/*!
+ * Marks an arena on construction and rewinds it on destruction, so that the scratch buffers
+ * allocated inside the scope are reclaimed in O(1) when it ends. The containers using the arena
+ * must be destroyed before the scope, i.e. be declared after it.
+ */
+class ArenaScope
+{
+public:
+    explicit ArenaScope(MonotonicArena& arena = thread_local_arena()): arena(arena), marker(arena.Mark()) {}
+    ~ArenaScope() {arena.Rewind(marker);}
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+    /// The memory resource of the scope
+    MonotonicArena* Resource() {return &arena;}
+
+private:
+    MonotonicArena& arena;
+    MonotonicArena::Marker marker;
+};
+
+#endif
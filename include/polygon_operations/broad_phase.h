@@ -0,0 +1,45 @@
+#ifndef BROAD_PHASE_H
+#define BROAD_PHASE_H
+
+#include "polygon_operations/utilities.h"
+#include <chrono>
+
+/*!
+ * Timings and counters of the last frame of a broad phase, where the times are in seconds
+ */
+struct BroadPhaseTimings
+{
+    /// Time spent computing the bounding boxes of the polygons
+    double boundsUpdate = 0.0;
+
+    /// Time spent sorting or binning the bounding boxes
+    double sort = 0.0;
+
+    /// Time spent finding the candidate pairs with overlapping bounding boxes
+    double sweep = 0.0;
+
+    /// Time spent confirming the candidate pairs with do_intersect
+    double narrowPhase = 0.0;
+
+    /// Number of element moves performed while sorting or binning
+    size_t moves = 0;
+
+    /// Number of pairs with overlapping bounding boxes
+    size_t candidatePairs = 0;
+
+    /// Number of candidate pairs confirmed by do_intersect
+    size_t confirmedPairs = 0;
+};
+
+namespace BroadPhase
+{
+    typedef std::chrono::steady_clock Clock;
+
+    /// Seconds elapsed since the given time point
+    inline double SecondsSince(const Clock::time_point& start)
+    {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+}
+
+#endif
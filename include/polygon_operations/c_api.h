@@ -0,0 +1,117 @@
+#ifndef C_API_H
+#define C_API_H
+
+/*!
+ * Stable C ABI of the library for foreign function interfaces, e.g. Go (cgo), Rust or Python (ctypes).
+ * Only C types are used: a point is a pair of doubles (x, y), so an array of n points is an array
+ * of 2n doubles, and a batch of polygons is an array of the vertices of all the polygons with an
+ * array of offsets in compressed sparse row (CSR) form, as in PolygonBatch, where polygon i has the
+ * vertices from offsets[i] to offsets[i + 1]. The batch entry points process thousands of operations
+ * per call, so that the cost of crossing the FFI boundary is paid once. No exception crosses the
+ * boundary: every function returns a status code, and the message of the last error of the calling
+ * thread is given by po_last_error_message. All the functions are thread-safe and never keep
+ * pointers to the given arrays, which are owned by the caller.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Version of the ABI, incremented when a signature or a layout changes
+#define PO_ABI_VERSION 1
+
+/// Status returned by every function of the C ABI
+typedef enum po_status
+{
+    PO_OK = 0,
+    /// An argument is invalid, e.g. a null pointer, too few points or collinear points
+    PO_INVALID_ARGUMENT = 1,
+    /// Memory could not be allocated
+    PO_OUT_OF_MEMORY = 2,
+    /// Any other error of the library
+    PO_INTERNAL_ERROR = 3
+} po_status;
+
+/// Predicate deciding the orientation of three points, see OrientationPredicate
+typedef enum po_predicate
+{
+    PO_PREDICATE_FAST = 0,
+    PO_PREDICATE_ADAPTIVE = 1,
+    PO_PREDICATE_MIXED_PRECISION = 2
+} po_predicate;
+
+/*!
+ * Version of the ABI of the loaded library, to be compared with PO_ABI_VERSION of the header
+ * \return The version of the ABI
+ */
+int po_abi_version(void);
+
+/*!
+ * Message of the last error of the calling thread
+ * \return A null-terminated message valid until the next call of the thread, empty when there was no error
+ */
+const char* po_last_error_message(void);
+
+/*!
+ * Computes the convex hull of a number of points with the Graham scan of convex_hull_from_points
+ * \param points The points as 2 * pointsNumber doubles
+ * \param pointsNumber The number of points, at least 3
+ * \param predicate The predicate deciding the orientation of three points
+ * \param hull Output with room for 2 * pointsNumber doubles, receiving the vertices of the hull moving
+ * counterclockwise starting from the lowest one
+ * \param hullSize Output receiving the number of vertices of the hull
+ * \return PO_OK, or PO_INVALID_ARGUMENT when the points are fewer than 3 or all collinear
+ */
+po_status po_convex_hull(const double* points, size_t pointsNumber, po_predicate predicate, double* hull, size_t* hullSize);
+
+/*!
+ * Computes the convex hulls of a batch of point sets
+ * \param points The points of all the sets as 2 * offsets[setsNumber] doubles
+ * \param offsets The setsNumber + 1 offsets of the sets inside the points
+ * \param setsNumber The number of sets
+ * \param predicate The predicate deciding the orientation of three points
+ * \param hulls Output with room for 2 * offsets[setsNumber] doubles, receiving the vertices of every hull
+ * \param hullOffsets Output with room for setsNumber + 1 offsets, receiving the offsets of the hulls inside hulls
+ * \return PO_OK, or PO_INVALID_ARGUMENT when the offsets are not non-decreasing or a hull does not exist,
+ * in which case the hulls of the preceding sets are already written
+ */
+po_status po_convex_hulls(const double* points, const uint64_t* offsets, size_t setsNumber, po_predicate predicate,
+                          double* hulls, uint64_t* hullOffsets);
+
+/*!
+ * Finds which of a number of points are contained inside a convex polygon with the batched
+ * orientation tests of points_are_in_polygon. Points on the boundary are considered included.
+ * \param points The points as 2 * pointsNumber doubles
+ * \param pointsNumber The number of points
+ * \param polygon The vertices of the polygon moving counterclockwise as 2 * polygonSize doubles
+ * \param polygonSize The number of vertices of the polygon, at least 3
+ * \param predicate The predicate deciding the side of the edges where the points lie
+ * \param inside Output with room for pointsNumber bytes, receiving 1 for the points inside and 0 otherwise
+ * \return PO_OK, or PO_INVALID_ARGUMENT when the polygon has less than 3 vertices
+ */
+po_status po_points_in_polygon(const double* points, size_t pointsNumber, const double* polygon, size_t polygonSize,
+                               po_predicate predicate, uint8_t* inside);
+
+/*!
+ * Finds whether the polygons of a number of pairs of a batch intersect with the Separating Axis
+ * Theorem of do_intersect, e.g. for the candidate pairs of a broad phase
+ * \param vertices The vertices of all the convex polygons moving counterclockwise as 2 * offsets[polygonsNumber] doubles
+ * \param offsets The polygonsNumber + 1 offsets of the polygons inside the vertices
+ * \param polygonsNumber The number of polygons
+ * \param pairs The indices of the polygons of every pair as 2 * pairsNumber integers
+ * \param pairsNumber The number of pairs
+ * \param intersecting Output with room for pairsNumber bytes, receiving 1 for the intersecting pairs and 0 otherwise
+ * \return PO_OK, or PO_INVALID_ARGUMENT when the offsets are not non-decreasing, an index is out of range
+ * or a polygon of a pair has less than 3 vertices
+ */
+po_status po_do_intersect_pairs(const double* vertices, const uint64_t* offsets, size_t polygonsNumber,
+                                const uint64_t* pairs, size_t pairsNumber, uint8_t* intersecting);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
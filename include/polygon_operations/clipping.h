@@ -0,0 +1,62 @@
+#ifndef CLIPPING_H
+#define CLIPPING_H
+
+#include "polygon_operations/polygon_batch.h"
+#include "polygon_operations/thread_pool.h"
+#include "polygon_operations/utilities.h"
+
+/*!
+ * Clips a convex polygon against the half-plane of the points p with DotProduct(normal, p) <= offset
+ * with O(n) complexity, keeping the vertices inside the half-plane and adding the crossings of the
+ * edges with its boundary line. Vertices on the line are kept without adding crossings, so the result
+ * has no repeated vertices. Results with fewer than 3 vertices (the polygon is outside or only
+ * touches the line) are returned empty. No heap allocation is performed.
+ * The polygon is given as a contiguous array of points/vertices moving counterclockwise.
+ * \param polygon Pointer to the first vertex of the polygon
+ * \param polygonSize Number of vertices of the polygon
+ * \param normal Outward normal of the half-plane (need not be normalized)
+ * \param offset Value of DotProduct(normal, p) on the boundary line of the half-plane
+ * \param clipped Buffer of at least polygonSize + 1 points receiving the vertices of the clipped
+ * polygon moving counterclockwise. A polygon crossing the line more than twice, i.e. not convex or
+ * with signs alternating by rounding, may not fit and throws std::invalid_argument instead.
+ * \return Number of vertices written to the buffer
+ */
+size_t clip_convex_polygon(const Point* polygon, size_t polygonSize, const Vector& normal, double offset, Point* clipped);
+
+/*!
+ * Clips a convex polygon against the half-plane of the points p with DotProduct(normal, p) <= offset
+ * \param polygon Vector of Point for the polygon moving counterclockwise
+ * \param normal Outward normal of the half-plane (need not be normalized)
+ * \param offset Value of DotProduct(normal, p) on the boundary line of the half-plane
+ * \return The vertices of the clipped polygon moving counterclockwise, empty when nothing is left
+ */
+std::vector<Point> clip_convex_polygon(const std::vector<Point>& polygon, const Vector& normal, double offset);
+
+/*!
+ * Clips a convex polygon against an axis-aligned rectangle with the Sutherland-Hodgman algorithm,
+ * i.e. successively against the four half-planes of the rectangle. The crossings with the sides
+ * of the rectangle lie exactly on them, so the polygons clipped by neighbouring tiles share their
+ * vertices along the common side.
+ * \param polygon Vector of Point for the polygon moving counterclockwise
+ * \param rectangle The clipping rectangle
+ * \return The vertices of the clipped polygon moving counterclockwise, empty when nothing is left
+ */
+std::vector<Point> clip_convex_polygon(const std::vector<Point>& polygon, const BoundingBox& rectangle);
+
+/*!
+ * Clips many convex polygons against the same axis-aligned rectangle, e.g. a tile or a viewport,
+ * on all the threads of a pool. The bounding box of every polygon is found first: polygons outside
+ * the rectangle are dropped and polygons inside it are not clipped but copied in one block to the
+ * output, so only the polygons crossing the sides are clipped with Sutherland-Hodgman. Every task
+ * clips into its own buffer, and the buffers are gathered into the output after the offsets are known.
+ * The buffers are sized for any polygon, so a non-convex entry is clipped as Sutherland-Hodgman does
+ * (with edges along the sides where it leaves and reenters the rectangle) without overflowing them.
+ * \param polygons The polygons packed in CSR form
+ * \param rectangle The clipping rectangle
+ * \param pool The thread pool clipping the polygons
+ * \return The clipped polygons, in the order of the input, where the polygons with nothing left are empty,
+ * allocated from the memory resource of the input batch
+ */
+PolygonBatch clip_convex_polygons(const PolygonBatch& polygons, const BoundingBox& rectangle, WorkStealingThreadPool& pool);
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef CONTINUOUS_COLLISION_H
+#define CONTINUOUS_COLLISION_H
+
+#include "polygon_operations/thread_pool.h"
+#include "polygon_operations/utilities.h"
+
+/*!
+ * Rigid motion of a polygon with constant velocities, where at time t every vertex v is moved to
+ * rotationCenter + R(angularVelocity * t) (v - rotationCenter) + linearVelocity * t
+ */
+struct PolygonMotion
+{
+    /// Velocity of the translation
+    Vector linearVelocity = Vector(0.0, 0.0);
+
+    /// Counterclockwise rotation speed in radians per unit of time
+    double angularVelocity = 0.0;
+
+    /// Center of the rotation at time 0
+    Point rotationCenter = Point(0.0, 0.0);
+};
+
+/*!
+ * Result of a time of impact query between two moving convex polygons
+ */
+struct TimeOfImpact
+{
+    /// Whether the polygons touch during the time interval, or may touch when the advancement did not converge
+    bool hit = false;
+
+    /// First time of contact when hit, the last time the polygons are known to be apart when not converged,
+    /// the end of the interval otherwise
+    double time = 0.0;
+
+    /// Unit contact normal pointing from the first polygon to the second one when hit, the closest
+    /// direction of the polygons at the returned time when not converged
+    Vector normal = Vector(0.0, 0.0);
+
+    /// Whether the advancement reached contact or proved its absence within the maximum number of steps
+    bool converged = true;
+
+    /// Number of advancement steps performed
+    size_t iterations = 0;
+};
+
+/*!
+ * Finds the first time of contact of two moving convex polygons with conservative advancement,
+ * so that polygons moving fast enough to pass through each other between two snapshots are not missed.
+ * At every step the distance d and the closest direction n of the polygons are found with GJK (warm
+ * started from the previous step), and the time advances by d / s, where s bounds the approach speed
+ * of the polygons along n: the relative linear velocity along n plus |angularVelocity| times the
+ * largest distance of a vertex from the rotation center for each polygon. The polygons cannot touch
+ * before the next step, and they never touch when s is not positive. Contact is reported when the
+ * distance drops below distanceTolerance. Polygons intersecting at time 0 have contact at time 0, with
+ * the normal opposite to their minimum translation vector. When the maximum number of steps is
+ * reached first, e.g. for polygons grazing each other, the result is conservative: a hit that did
+ * not converge, at the last time the polygons are known to be apart, so that a simulation stopping
+ * the motion there never lets them pass through each other.
+ * The polygons are given as vectors of points/vertices moving counterclockwise at time 0.
+ * \param polygon1 Vector of Point for the first polygon
+ * \param motion1 Motion of the first polygon
+ * \param polygon2 Vector of Point for the second polygon
+ * \param motion2 Motion of the second polygon
+ * \param duration Length of the time interval starting at time 0
+ * \param distanceTolerance Distance below which the polygons are considered touching
+ * \param maximumIterations Maximum number of advancement steps, after which a hit that did not converge is reported
+ * \return The time of impact and the contact normal
+ */
+TimeOfImpact time_of_impact(const std::vector<Point>& polygon1, const PolygonMotion& motion1,
+                            const std::vector<Point>& polygon2, const PolygonMotion& motion2,
+                            double duration, double distanceTolerance = 1e-9, size_t maximumIterations = 100);
+
+/*!
+ * Finds the times of impact of the candidate pairs of a broad phase on all the threads of a pool
+ * \param polygons The polygons at time 0 as vectors of points/vertices moving counterclockwise
+ * \param motions The motion of every polygon
+ * \param candidatePairs Pairs of indices of polygons to be tested
+ * \param duration Length of the time interval starting at time 0
+ * \param pool The thread pool executing the queries
+ * \param distanceTolerance Distance below which the polygons are considered touching
+ * \param maximumIterations Maximum number of advancement steps of every pair, as in time_of_impact
+ * \return The time of impact of every candidate pair, in the order of the pairs
+ */
+std::vector<TimeOfImpact> time_of_impact_batch(const std::vector<std::vector<Point>>& polygons,
+                                               const std::vector<PolygonMotion>& motions,
+                                               const std::vector<PolygonPair>& candidatePairs,
+                                               double duration, WorkStealingThreadPool& pool,
+                                               double distanceTolerance = 1e-9, size_t maximumIterations = 100);
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef CONVEX_DISTANCE_H
+#define CONVEX_DISTANCE_H
+
+#include "polygon_operations/utilities.h"
+
+/*!
+ * Minimum distance between two convex polygons and the closest points realizing it
+ */
+struct PolygonDistance
+{
+    /// Minimum distance between the two polygons (0 when they intersect)
+    double distance = 0.0;
+
+    /// Point of the first polygon closest to the second polygon (unspecified when they intersect)
+    Point witness1 = Point(0.0, 0.0);
+
+    /// Point of the second polygon closest to the first polygon (unspecified when they intersect)
+    Point witness2 = Point(0.0, 0.0);
+};
+
+/*!
+ * Finds the minimum distance between two convex polygons with O(n + m) complexity, where n and m
+ * are the numbers of vertices of the two polygons, with rotating calipers. Two calipers of opposite
+ * directions are rotated around the polygons by the smaller angle to the next edge of either polygon,
+ * which visits the edges of the Minkowski difference polygon1 - polygon2 in order. Every visited
+ * edge pairs an edge of one polygon with a vertex of the other one, and the distance is the minimum
+ * of their distances. No heap allocation is performed.
+ * The polygons are given as contiguous arrays of points/vertices moving counterclockwise.
+ * \param polygon1 Pointer to the first vertex of the first polygon
+ * \param polygon1Size Number of vertices of the first polygon
+ * \param polygon2 Pointer to the first vertex of the second polygon
+ * \param polygon2Size Number of vertices of the second polygon
+ * \return The distance and the witness points of the two polygons
+ */
+PolygonDistance convex_polygon_distance(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size);
+
+/*!
+ * Finds the minimum distance between two convex polygons with O(n + m) complexity using rotating calipers
+ * \param polygon1 Vector of Point for the first polygon moving counterclockwise
+ * \param polygon2 Vector of Point for the second polygon moving counterclockwise
+ * \return The distance and the witness points of the two polygons
+ */
+PolygonDistance convex_polygon_distance(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2);
+
+/*!
+ * Finds the minimum distance between two convex polygons without visiting all their vertices, for
+ * large polygons. The separation of the polygons along a direction, min(polygon2) - max(polygon1) of
+ * the projections, is concave over the directions where it is positive and its maximum is the distance.
+ * Starting from a separating direction given by gjk_query, the edge normals of each polygon are binary
+ * searched for the maximum, evaluating the separation with the O(logm) extreme_vertex_index on the
+ * other polygon, which is O(logn * logm) overall. The closest features are then the edges around
+ * the two maxima. The witness points are exact, unlike the ones of gjk_query, which stops within
+ * a tolerance.
+ * \param polygon1 Vector of Point for the first polygon moving counterclockwise
+ * \param polygon2 Vector of Point for the second polygon moving counterclockwise
+ * \return The distance and the witness points of the two polygons
+ */
+PolygonDistance convex_polygon_distance_logarithmic(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2);
+
+/*!
+ * Finds whether the distance between two convex polygons is smaller than a threshold, e.g. whether
+ * a safety margin is violated. The rotating calipers of convex_polygon_distance stop at the first
+ * vertex-edge pair closer than the threshold, or at the first edge of the Minkowski difference whose
+ * line is at least the threshold away from the origin, i.e. a separating axis with the margin.
+ * Intersecting polygons are closer than any positive threshold. No square root is computed.
+ * \param polygon1 Pointer to the first vertex of the first polygon
+ * \param polygon1Size Number of vertices of the first polygon
+ * \param polygon2 Pointer to the first vertex of the second polygon
+ * \param polygon2Size Number of vertices of the second polygon
+ * \param threshold The distance compared against
+ * \return Boolean indicating whether the distance is smaller than the threshold
+ */
+bool convex_polygons_closer_than(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size,
+                                 double threshold);
+
+/*!
+ * Finds whether the distance between two convex polygons is smaller than a threshold, stopping early
+ * \param polygon1 Vector of Point for the first polygon moving counterclockwise
+ * \param polygon2 Vector of Point for the second polygon moving counterclockwise
+ * \param threshold The distance compared against
+ * \return Boolean indicating whether the distance is smaller than the threshold
+ */
+bool convex_polygons_closer_than(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2, double threshold);
+
+#endif
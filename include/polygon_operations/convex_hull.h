@@ -1,6 +1,7 @@
 #ifndef CONVEX_HULL_H
 #define CONVEX_HULL_H
 
+#include "polygon_operations/arena.h"
 #include "polygon_operations/utilities.h"
 
 /*!
@@ -10,9 +11,55 @@
  * starting from the point at the bottom of the stack. If an empty stack is
  * return, then it was not possible to come up with a convex hull of the points
  * given.
+ * The orientation tests deciding the polar order and the turns use the fast predicate by
+ * default, and the adaptive predicate gives the exact hull of nearly collinear points, e.g.
+ * dense grids, at a small extra cost. The mixed precision predicate gives the same hull as the
+ * adaptive one and first discards the points strictly inside the quadrilateral of the extreme
+ * points in x and y with the batched float orientation tests of orient2d_signs.
+ * The points are taken by value in order to be sorted, so a vector given with std::move is
+ * sorted in place without being copied.
  * \param  points  A vector of Point
+ * \param  predicate The predicate deciding the orientation of three points
  * \return A stack of points composing the convex hull
  */
-std::stack<Point> convex_hull_from_points(std::vector<Point> points);
+std::stack<Point> convex_hull_from_points(std::vector<Point> points, OrientationPredicate predicate = OrientationPredicate::Fast);
+
+/*!
+ * Computes the convex hull of a number of points in 2D in place, with the Graham scan of the stack
+ * variant running inside the given buffer, which the caller gives up, e.g. a memory-mapped array.
+ * The points are reordered so that the vertices of the hull come first, and no memory is allocated.
+ * \param points Pointer to the points, which are reordered
+ * \param pointsNumber The number of points
+ * \param predicate The predicate deciding the orientation of three points
+ * \return The number of vertices of the convex hull, which occupy the beginning of the buffer moving
+ * counterclockwise starting from the lowest point, i.e. the stack of the stack variant from the bottom to the top
+ */
+size_t convex_hull_from_points(Point* points, size_t pointsNumber, OrientationPredicate predicate = OrientationPredicate::Fast);
+
+/*!
+ * Computes the convex hull of a number of points in 2D with the Graham scan of the stack variant,
+ * leaving the points untouched and writing the hull to an output buffer.
+ * \param points Pointer to the points
+ * \param pointsNumber The number of points
+ * \param convexHull Output buffer with room for pointsNumber points, which is also used as scratch
+ * \param predicate The predicate deciding the orientation of three points
+ * \return The number of vertices of the convex hull written moving counterclockwise starting from the lowest point
+ */
+size_t convex_hull_from_points(const Point* points, size_t pointsNumber, Point* convexHull,
+                               OrientationPredicate predicate = OrientationPredicate::Fast);
+
+/*!
+ * Computes the convex hull of a number of points in 2D with the Graham scan of the stack variant,
+ * allocating the hull from a memory resource, e.g. a MonotonicArena, so that no call to malloc
+ * is made in a batch job using arenas.
+ * \param points Pointer to the points
+ * \param pointsNumber The number of points
+ * \param resource The memory resource of the returned vector
+ * \param predicate The predicate deciding the orientation of three points
+ * \return The vertices of the convex hull moving counterclockwise starting from the lowest point,
+ * i.e. the stack of the stack variant from the bottom to the top
+ */
+std::pmr::vector<Point> convex_hull_from_points(const Point* points, size_t pointsNumber, std::pmr::memory_resource* resource,
+                                                OrientationPredicate predicate = OrientationPredicate::Fast);
 
 #endif
@@ -0,0 +1,39 @@
+#ifndef CONVEX_INTERSECTION_H
+#define CONVEX_INTERSECTION_H
+
+#include "polygon_operations/utilities.h"
+
+/*!
+ * Computes the intersection polygon of two convex polygons with O(n + m) complexity, where n and m
+ * are the numbers of vertices of the two polygons, by advancing along the edges of both polygons
+ * as in O'Rourke, Chien, Olson and Naddor, "A new linear algorithm for intersecting convex polygons".
+ * When the boundaries do not cross, the result is the polygon contained inside the other one, if any.
+ * The result has fewer than 3 vertices (and zero area) when the polygons are disjoint or only touch.
+ * The side of an edge where a vertex lies is decided with the selected orientation predicate, and
+ * the adaptive one avoids wrong decisions for vertices on or very close to the edges of the other polygon.
+ * No heap allocation is performed.
+ * The polygons are given as contiguous arrays of points/vertices moving counterclockwise.
+ * \param polygon1 Pointer to the first vertex of the first polygon
+ * \param polygon1Size Number of vertices of the first polygon
+ * \param polygon2 Pointer to the first vertex of the second polygon
+ * \param polygon2Size Number of vertices of the second polygon
+ * \param intersection Buffer of at least polygon1Size + polygon2Size points receiving the vertices
+ * of the intersection moving counterclockwise
+ * \param predicate The predicate deciding the orientation of three points
+ * \return Number of vertices written to the buffer
+ */
+size_t convex_polygon_intersection(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size,
+                                   Point* intersection, OrientationPredicate predicate = OrientationPredicate::Fast);
+
+/*!
+ * Computes the intersection polygon of two convex polygons with O(n + m) complexity, as the
+ * pointer overload does, reusing the memory of the output vector between calls.
+ * \param polygon1 Vector of Point for the first polygon moving counterclockwise
+ * \param polygon2 Vector of Point for the second polygon moving counterclockwise
+ * \param intersection Vector replaced by the vertices of the intersection moving counterclockwise
+ * \param predicate The predicate deciding the orientation of three points
+ */
+void convex_polygon_intersection(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2,
+                                 std::vector<Point>& intersection, OrientationPredicate predicate = OrientationPredicate::Fast);
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef CONVEX_POLYGON_H
 #define CONVEX_POLYGON_H
 
+#include "polygon_operations/sat_kernel.h"
 #include "polygon_operations/utilities.h"
 #include <stack>
 
@@ -10,28 +11,75 @@
  * The polygon is given in a V-representation and more particularly as a
  * stack where the points are rotated counterclockwise starting from the
  * bottom point of the stack 
+ * Points on the boundary, including the vertices, are considered included, which is decided
+ * exactly for points computed on an edge when the adaptive orientation predicate is selected.
+ * The result is the one of the fixed-size polygons and of points_are_in_polygon.
+ * The stack is read through its underlying container without being copied.
  * \param pointInConsideration Point that we want to check whether it is inside the polygon
  * \param convexPolygon Stack of points 
+ * \param predicate The predicate deciding the side of the edges where the point lies
  * \return Boolean indicating whether the point is indeed included in the polygon
  */
-bool point_is_in_polygon(const Point& pointInConsideration, std::stack<Point> convexPolygon);
+bool point_is_in_polygon(const Point& pointInConsideration, const std::stack<Point>& convexPolygon,
+                         OrientationPredicate predicate = OrientationPredicate::Fast);
+
+/*!
+ * Finds whether a given point is contained inside a given convex polygon as point_is_in_polygon
+ * for a stack, viewing the vertices in a buffer that is not copied, e.g. a memory-mapped array.
+ * \param pointInConsideration Point that we want to check whether it is inside the polygon
+ * \param convexPolygon Pointer to the vertices of the polygon moving counterclockwise
+ * \param polygonSize Number of vertices of the polygon
+ * \param predicate The predicate deciding the side of the edges where the point lies
+ * \return Boolean indicating whether the point is indeed included in the polygon
+ */
+bool point_is_in_polygon(const Point& pointInConsideration, const Point* convexPolygon, size_t polygonSize,
+                         OrientationPredicate predicate = OrientationPredicate::Fast);
+
+/*!
+ * Finds which of a number of points are contained inside a given convex polygon with complexity
+ * O(nm) where n is the number of vertices of the polygon and m the number of points.
+ * All the points are tested against one edge at a time with orient2d_signs, which evaluates
+ * the mixed precision predicate with SIMD float arithmetic and re-evaluates only the ambiguous
+ * points exactly. Points on the boundary are considered included, as in point_is_in_polygon.
+ * \param points Vector of the points in consideration
+ * \param convexPolygon Vector of Point for the polygon moving counterclockwise
+ * \param predicate The predicate deciding the side of the edges where the points lie
+ * \return Vector of booleans indicating whether each point is included in the polygon
+ */
+std::vector<bool> points_are_in_polygon(const std::vector<Point>& points, const std::vector<Point>& convexPolygon,
+                                        OrientationPredicate predicate = OrientationPredicate::MixedPrecision);
+
+/*!
+ * Finds which of a number of points are contained inside a given convex polygon as the vector
+ * variant of points_are_in_polygon, viewing the points and the vertices without copying them and
+ * writing the results to an output buffer. The scratch buffers come from the thread arena.
+ * \param points Pointer to the points in consideration
+ * \param pointsNumber Number of points
+ * \param convexPolygon Pointer to the vertices of the polygon moving counterclockwise
+ * \param polygonSize Number of vertices of the polygon
+ * \param inside Output buffer with room for pointsNumber booleans indicating whether each point is included
+ * \param predicate The predicate deciding the side of the edges where the points lie
+ */
+void points_are_in_polygon(const Point* points, size_t pointsNumber, const Point* convexPolygon, size_t polygonSize,
+                           bool* inside, OrientationPredicate predicate = OrientationPredicate::MixedPrecision);
 
 /*!
  * Finds whether two polygons intersect with each other using Seperating Axis Theorem (SAP).
  * This function takes as arguments two polygons as stack of points/vertices moving clockwise 
- * as the stack is traversed from top to bottom. This function first transforms the
- * stack to vector (that is why the stack is passed by value).
+ * as the stack is traversed from top to bottom. This function first copies the underlying
+ * containers of the stacks, which are not contiguous, into per-thread buffers and then runs
+ * the allocation-free sat_do_intersect.
  * For more on SAP see <a href="http://web.archive.org/web/20141127210836/http://content.gpwiki.org/index.php/Polygon_Collision">here</a>.
  * \param polygon1 Stack of Point for the first polygon
  * \param polygon2 Stack of Point for the second polygon
  * \return Boolean indicating whether the two polygons intersect
  */
-bool do_intersect(std::stack<Point> polygon1, std::stack<Point> polygon2);
+bool do_intersect(const std::stack<Point>& polygon1, const std::stack<Point>& polygon2);
 
 /*!
  * Finds whether two polygons intersect with each other using Seperating Axis Theorem (SAP).
  * This function takes as arguments two polygons as a vector of points/vertices moving counterclockwise 
- * starting from the beginning of the vector.
+ * starting from the beginning of the vector. The test runs on the allocation-free sat_do_intersect.
  * For more on SAP see <a href="http://web.archive.org/web/20141127210836/http://content.gpwiki.org/index.php/Polygon_Collision">here</a>.
  * \param polygon1 Vector of Point for the first polygon
  * \param polygon2 Vector of Point for the second polygon
@@ -39,5 +87,109 @@ bool do_intersect(std::stack<Point> polygon1, std::stack<Point> polygon2);
  */
 bool do_intersect(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2);
 
+/*!
+ * Finds whether two polygons intersect with each other as the vector variant of do_intersect,
+ * viewing the vertices in buffers that are not copied, e.g. memory-mapped arrays.
+ * \param polygon1 Pointer to the vertices of the first polygon moving counterclockwise
+ * \param polygon1Size Number of vertices of the first polygon
+ * \param polygon2 Pointer to the vertices of the second polygon moving counterclockwise
+ * \param polygon2Size Number of vertices of the second polygon
+ * \return Boolean indicating whether the two polygons intersect
+ */
+bool do_intersect(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size);
+
+/*!
+ * Finds whether two polygons intersect with each other using Seperating Axis Theorem (SAP) and,
+ * when they do, the minimum translation vector separating them, computed in the same sweep over
+ * the axes by sat_minimum_translation.
+ * \param polygon1 Vector of Point for the first polygon moving counterclockwise
+ * \param polygon2 Vector of Point for the second polygon moving counterclockwise
+ * \param translation Set to the translation of polygon1 making the polygons touch when they intersect
+ * \return Boolean indicating whether the two polygons intersect
+ */
+bool do_intersect(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2, MinimumTranslation& translation);
+
+/*!
+ * Reference implementation of the Seperating Axis Theorem (SAP) test of do_intersect, which
+ * projects the vertices to normalized edge normals and stores the projections before finding
+ * their range. It is kept for validating and benchmarking the faster implementations.
+ * \param polygon1 Vector of Point for the first polygon
+ * \param polygon2 Vector of Point for the second polygon
+ * \return Boolean indicating whether the two polygons intersect
+ */
+bool do_intersect_reference(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2);
+
+/*!
+ * Finds the vertex of a convex polygon lying furthest along a given direction using
+ * binary search with O(logn) complexity where n is the number of vertices of the polygon.
+ * The polygon is given as a vector of points/vertices moving counterclockwise starting
+ * from the beginning of the vector. When an edge is perpendicular to the direction, any
+ * of its two vertices may be returned.
+ * \param convexPolygon Vector of Point for the polygon
+ * \param direction The direction along which the vertices are compared (need not be normalized)
+ * \return Index of the extreme vertex inside the vector
+ */
+size_t extreme_vertex_index(const std::vector<Point>& convexPolygon, const Vector& direction);
+
+/*!
+ * Finds the vertex of a convex polygon lying furthest along a given direction as the vector
+ * variant of extreme_vertex_index, viewing the vertices without copying them.
+ * \param convexPolygon Pointer to the vertices of the polygon moving counterclockwise
+ * \param polygonSize Number of vertices of the polygon
+ * \param direction The direction along which the vertices are compared (need not be normalized)
+ * \return Index of the extreme vertex inside the buffer
+ */
+size_t extreme_vertex_index(const Point* convexPolygon, size_t polygonSize, const Vector& direction);
+
+/*!
+ * Finds the vertex of a convex polygon lying furthest along a given direction starting from
+ * a hint vertex, e.g. the extreme vertex of a previous query along a similar direction.
+ * The neighbours of the hint are climbed for a few steps, which is O(1) for coherent queries,
+ * and then the O(logn) binary search of extreme_vertex_index is used as a fallback.
+ * \param convexPolygon Vector of Point for the polygon
+ * \param direction The direction along which the vertices are compared (need not be normalized)
+ * \param hintIndex Index of the vertex where the search starts
+ * \return Index of the extreme vertex inside the vector
+ */
+size_t extreme_vertex_index(const std::vector<Point>& convexPolygon, const Vector& direction, size_t hintIndex);
+
+/*!
+ * Finds the vertex of a convex polygon lying furthest along a given direction starting from
+ * a hint vertex as the vector variant of extreme_vertex_index, viewing the vertices without copying them.
+ * \param convexPolygon Pointer to the vertices of the polygon moving counterclockwise
+ * \param polygonSize Number of vertices of the polygon
+ * \param direction The direction along which the vertices are compared (need not be normalized)
+ * \param hintIndex Index of the vertex where the search starts
+ * \return Index of the extreme vertex inside the buffer
+ */
+size_t extreme_vertex_index(const Point* convexPolygon, size_t polygonSize, const Vector& direction, size_t hintIndex);
+
+/*!
+ * Finds whether two convex polygons intersect with each other with O(logn + logm) complexity
+ * where n and m are the numbers of vertices of the two polygons.
+ * The polygons are split into their lower and upper x-monotone chains and the vertical gaps
+ * lowerChain1 - upperChain2 and lowerChain2 - upperChain1 are minimized over the common x-range
+ * with a prune-and-search over the edges of both chains. The polygons intersect if and only if
+ * both minimum gaps are non-positive. Polygons that only touch are considered intersecting, as
+ * in the SAP implementation of do_intersect_reference.
+ * Both polygons are given as a vector of points/vertices moving counterclockwise starting from
+ * the beginning of the vector.
+ * \param polygon1 Vector of Point for the first polygon
+ * \param polygon2 Vector of Point for the second polygon
+ * \return Boolean indicating whether the two polygons intersect
+ */
+bool do_intersect_logarithmic(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2);
+
+/*!
+ * Finds whether two convex polygons intersect with each other with O(logn + logm) complexity
+ * as the vector variant of do_intersect_logarithmic, viewing the vertices without copying them.
+ * \param polygon1 Pointer to the vertices of the first polygon moving counterclockwise
+ * \param polygon1Size Number of vertices of the first polygon
+ * \param polygon2 Pointer to the vertices of the second polygon moving counterclockwise
+ * \param polygon2Size Number of vertices of the second polygon
+ * \return Boolean indicating whether the two polygons intersect
+ */
+bool do_intersect_logarithmic(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size);
+
 
 #endif
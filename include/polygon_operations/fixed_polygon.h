@@ -0,0 +1,302 @@
+#ifndef FIXED_POLYGON_H
+#define FIXED_POLYGON_H
+
+#include "polygon_operations/polygon_metrics.h"
+#include "polygon_operations/predicates.h"
+#include "polygon_operations/sat_kernel.h"
+#include "polygon_operations/utilities.h"
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <type_traits>
+
+/*!
+ * Kernels for polygons whose number of vertices is a template parameter. The loops over the
+ * vertices and the edges are expanded at compile time with fold expressions over index sequences,
+ * so that triangles and quadrilaterals are processed without loops, branches on the size or
+ * heap allocations.
+ */
+namespace FixedPolygon
+{
+    /// Copies N points into an array
+    template <size_t N, size_t... Indices>
+    constexpr std::array<Point, N> CopyVertices(const Point* vertices, std::index_sequence<Indices...>)
+    {
+        return {{vertices[Indices]...}};
+    }
+
+    /// Array of N copies of a point
+    template <size_t N, size_t... Indices>
+    constexpr std::array<Point, N> FilledVertices(const Point& vertex, std::index_sequence<Indices...>)
+    {
+        return {{(static_cast<void>(Indices), vertex)...}};
+    }
+
+    /// Index of the vertex following the vertex Index
+    template <size_t N, size_t Index>
+    constexpr size_t Next()
+    {
+        return (Index + 1 == N) ? 0 : Index + 1;
+    }
+
+    /// Projection extents of N vertices on an axis, computed as in projection_extents
+    template <size_t N, size_t... Indices>
+    constexpr ProjectionExtents Project(const Point* vertices, double axisX, double axisY, std::index_sequence<Indices...>)
+    {
+        ProjectionExtents extents = {std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity()};
+        ((extents.minimum = std::min(extents.minimum, axisX * vertices[Indices].x + axisY * vertices[Indices].y),
+          extents.maximum = std::max(extents.maximum, axisX * vertices[Indices].x + axisY * vertices[Indices].y)), ...);
+        return extents;
+    }
+
+    /// Whether the normal of the edge of edgesPolygon starting from the vertex EdgeId separates the two polygons
+    template <size_t N, size_t M, size_t EdgeId>
+    constexpr bool EdgeNormalSeparates(const Point* edgesPolygon, const Point* otherPolygon)
+    {
+        const Point& tail = edgesPolygon[EdgeId];
+        const Point& head = edgesPolygon[Next<N, EdgeId>()];
+        const double normalX = tail.y - head.y;
+        const double normalY = head.x - tail.x;
+        const ProjectionExtents extents1 = Project<N>(edgesPolygon, normalX, normalY, std::make_index_sequence<N>());
+        const ProjectionExtents extents2 = Project<M>(otherPolygon, normalX, normalY, std::make_index_sequence<M>());
+        return (extents2.maximum < extents1.minimum) || (extents1.maximum < extents2.minimum);
+    }
+
+    /// Whether a normal of the edges of edgesPolygon separates the two polygons, stopping at the first one
+    template <size_t N, size_t M, size_t... EdgeIds>
+    constexpr bool EdgesSeparate(const Point* edgesPolygon, const Point* otherPolygon, std::index_sequence<EdgeIds...>)
+    {
+        return (EdgeNormalSeparates<N, M, EdgeIds>(edgesPolygon, otherPolygon) || ...);
+    }
+
+    /// Separating axis test of two convex polygons with N and M vertices, testing the same axes as sat_do_intersect
+    template <size_t N, size_t M>
+    constexpr bool Intersect(const Point* polygon1, const Point* polygon2)
+    {
+        return !EdgesSeparate<N, M>(polygon1, polygon2, std::make_index_sequence<N>()) &&
+               !EdgesSeparate<M, N>(polygon2, polygon1, std::make_index_sequence<M>());
+    }
+
+    /// Whether the point is left of every edge or on it
+    template <size_t N, size_t... EdgeIds>
+    constexpr bool Contains(const Point* polygon, const Point& point, OrientationPredicate predicate,
+                            std::index_sequence<EdgeIds...>)
+    {
+        return ((orient2d(polygon[EdgeIds], polygon[Next<N, EdgeIds>()], point, predicate) >= 0.0) && ...);
+    }
+
+    /// Signed area with the shoelace formula
+    template <size_t N, size_t... EdgeIds>
+    constexpr double Area(const Point* polygon, std::index_sequence<EdgeIds...>)
+    {
+        return (... + (polygon[EdgeIds].x * polygon[Next<N, EdgeIds>()].y - polygon[Next<N, EdgeIds>()].x * polygon[EdgeIds].y)) / 2.0;
+    }
+
+    /// Metrics with the formulas of polygon_metrics, the edges being taken relative to the first vertex
+    template <size_t N, size_t... EdgeIds>
+    PolygonMetrics Metrics(const Point* polygon, std::index_sequence<EdgeIds...>)
+    {
+        const Point& origin = polygon[0];
+        double area = 0.0, firstX = 0.0, firstY = 0.0, secondXX = 0.0, secondYY = 0.0, secondXY = 0.0, perimeter = 0.0;
+        const auto addEdge = [&](const Point& tail, const Point& head) {
+            const double x0 = tail.x - origin.x, y0 = tail.y - origin.y;
+            const double x1 = head.x - origin.x, y1 = head.y - origin.y;
+            const double cross = x0 * y1 - x1 * y0;
+            area += cross;
+            firstX += (x0 + x1) * cross;
+            firstY += (y0 + y1) * cross;
+            secondXX += (x0 * x0 + x0 * x1 + x1 * x1) * cross;
+            secondYY += (y0 * y0 + y0 * y1 + y1 * y1) * cross;
+            secondXY += (x0 * y1 + 2.0 * x0 * y0 + 2.0 * x1 * y1 + x1 * y0) * cross;
+            perimeter += std::sqrt((x1 - x0) * (x1 - x0) + (y1 - y0) * (y1 - y0));
+        };
+        (addEdge(polygon[EdgeIds], polygon[Next<N, EdgeIds>()]), ...);
+
+        PolygonMetrics metrics;
+        metrics.area = area / 2.0;
+        metrics.perimeter = perimeter;
+        if (metrics.area == 0.0)
+        {
+            metrics.centroid = Point((... + polygon[EdgeIds].x) / N, (... + polygon[EdgeIds].y) / N);
+            return metrics;
+        }
+        const double centroidX = firstX / (6.0 * metrics.area);
+        const double centroidY = firstY / (6.0 * metrics.area);
+        metrics.centroid = Point(origin.x + centroidX, origin.y + centroidY);
+        metrics.momentXX = secondXX / 12.0 - metrics.area * centroidX * centroidX;
+        metrics.momentYY = secondYY / 12.0 - metrics.area * centroidY * centroidY;
+        metrics.momentXY = secondXY / 24.0 - metrics.area * centroidX * centroidY;
+        return metrics;
+    }
+}
+
+/*!
+ * Convex polygon with a number of vertices N fixed at compile time, stored inline without heap
+ * allocation. The vertices move counterclockwise. Triangle and Quad name the most common sizes.
+ */
+template <size_t N>
+struct ConvexPolygonN
+{
+    static_assert(N >= 3, "Attempted to define a convex polygon with less than 3 points");
+
+    /// Vertices of the polygon moving counterclockwise
+    std::array<Point, N> vertices;
+
+    /// Construction from the N vertices moving counterclockwise
+    template <typename... Points, typename std::enable_if<sizeof...(Points) == N, int>::type = 0>
+    constexpr ConvexPolygonN(const Points&... points): vertices{{Point(points)...}} {}
+
+    /// Construction from a pointer to N vertices moving counterclockwise
+    explicit constexpr ConvexPolygonN(const Point* points): vertices(FixedPolygon::CopyVertices<N>(points, std::make_index_sequence<N>())) {}
+
+    /// Number of vertices
+    static constexpr size_t Size() {return N;}
+
+    /// Pointer to the first vertex
+    constexpr const Point* Data() const {return vertices.data();}
+
+    /// Vertex access
+    constexpr const Point& operator[](size_t vertexId) const {return vertices[vertexId];}
+};
+
+typedef ConvexPolygonN<3> Triangle;
+typedef ConvexPolygonN<4> Quad;
+
+/*!
+ * Finds whether two convex polygons with numbers of vertices fixed at compile time intersect with
+ * each other using the Separating Axis Theorem. The same axes are tested in the same order as in
+ * sat_do_intersect, which dispatches triangles and quadrilaterals to this function, with the loops
+ * over the axes and the vertices expanded at compile time. Polygons that only touch are considered
+ * intersecting. The test can be evaluated in constant expressions.
+ * \param polygon1 The first polygon
+ * \param polygon2 The second polygon
+ * \return Boolean indicating whether the two polygons intersect
+ */
+template <size_t N, size_t M>
+constexpr bool do_intersect(const ConvexPolygonN<N>& polygon1, const ConvexPolygonN<M>& polygon2)
+{
+    return FixedPolygon::Intersect<N, M>(polygon1.Data(), polygon2.Data());
+}
+
+/*!
+ * Finds whether a given point is contained inside a convex polygon with a number of vertices fixed
+ * at compile time, i.e. whether it is left of every edge or on it. Points on the boundary are
+ * considered included. The test can be evaluated in constant expressions with the fast predicate.
+ * \param point Point that we want to check whether it is inside the polygon
+ * \param polygon The polygon
+ * \param predicate The predicate deciding the side of the edges where the point lies
+ * \return Boolean indicating whether the point is included in the polygon
+ */
+template <size_t N>
+constexpr bool point_is_in_polygon(const Point& point, const ConvexPolygonN<N>& polygon,
+                                   OrientationPredicate predicate = OrientationPredicate::Fast)
+{
+    return FixedPolygon::Contains<N>(polygon.Data(), point, predicate, std::make_index_sequence<N>());
+}
+
+/*!
+ * Computes the signed area of a polygon with a number of vertices fixed at compile time with the
+ * shoelace formula. The area can be evaluated in constant expressions.
+ * \param polygon The polygon
+ * \return The area, positive for polygons moving counterclockwise
+ */
+template <size_t N>
+constexpr double polygon_area(const ConvexPolygonN<N>& polygon)
+{
+    return FixedPolygon::Area<N>(polygon.Data(), std::make_index_sequence<N>());
+}
+
+/*!
+ * Computes the area, centroid, perimeter and second moments of a polygon with a number of vertices
+ * fixed at compile time, with the formulas of polygon_metrics expanded over the edges at compile time.
+ * polygon_metrics dispatches triangles and quadrilaterals to this function.
+ * \param polygon The polygon
+ * \return The metrics of the polygon
+ */
+template <size_t N>
+PolygonMetrics polygon_metrics(const ConvexPolygonN<N>& polygon)
+{
+    return FixedPolygon::Metrics<N>(polygon.Data(), std::make_index_sequence<N>());
+}
+
+/*!
+ * Polygon keeping up to inlineCapacity vertices inline and moving them to the heap only when more
+ * vertices are added, so that the triangles, quadrilaterals and other small polygons making up most
+ * workloads are built and copied without heap allocation. The vertices move counterclockwise.
+ */
+class SmallPolygon
+{
+public:
+    /// Number of vertices stored without heap allocation
+    static const size_t inlineCapacity = 16;
+
+    /// Construction of an empty polygon
+    SmallPolygon();
+
+    /// Construction from a pointer to the vertices
+    SmallPolygon(const Point* vertices, size_t verticesNumber);
+
+    /// Construction from a vector of the vertices
+    explicit SmallPolygon(const std::vector<Point>& vertices);
+
+    /// Construction from a polygon with a fixed number of vertices
+    template <size_t N>
+    explicit SmallPolygon(const ConvexPolygonN<N>& polygon): SmallPolygon(polygon.Data(), N) {}
+
+    /// Appends a vertex, moving all the vertices to the heap when the inline capacity is exceeded
+    void Add(const Point& vertex);
+
+    /// Removes all the vertices
+    void Clear();
+
+    /// Number of vertices
+    size_t Size() const {return size;}
+
+    /// Whether the vertices are stored inline
+    bool IsInline() const {return heapVertices.empty();}
+
+    /// Pointer to the first vertex
+    const Point* Data() const {return IsInline() ? inlineVertices.data() : heapVertices.data();}
+
+    /// Vertex access
+    const Point& operator[](size_t vertexId) const {return Data()[vertexId];}
+
+    /// Copies the vertices into a vector
+    std::vector<Point> ToVector() const {return std::vector<Point>(Data(), Data() + size);}
+
+private:
+    std::array<Point, inlineCapacity> inlineVertices;
+    std::vector<Point> heapVertices;
+    size_t size;
+};
+
+/*!
+ * Finds whether two convex polygons intersect with each other with sat_do_intersect, which runs
+ * the kernels of ConvexPolygonN for triangles and quadrilaterals.
+ * \param polygon1 The first polygon
+ * \param polygon2 The second polygon
+ * \return Boolean indicating whether the two polygons intersect
+ */
+bool do_intersect(const SmallPolygon& polygon1, const SmallPolygon& polygon2);
+
+/*!
+ * Finds whether a given point is contained inside a convex polygon, i.e. whether it is left of
+ * every edge or on it, running the kernels of ConvexPolygonN for triangles and quadrilaterals.
+ * \param point Point that we want to check whether it is inside the polygon
+ * \param polygon The polygon
+ * \param predicate The predicate deciding the side of the edges where the point lies
+ * \return Boolean indicating whether the point is included in the polygon
+ */
+bool point_is_in_polygon(const Point& point, const SmallPolygon& polygon,
+                         OrientationPredicate predicate = OrientationPredicate::Fast);
+
+/*!
+ * Computes the area, centroid, perimeter and second moments of a polygon with polygon_metrics,
+ * which runs the kernels of ConvexPolygonN for triangles and quadrilaterals.
+ * \param polygon The polygon
+ * \return The metrics of the polygon
+ */
+PolygonMetrics polygon_metrics(const SmallPolygon& polygon);
+
+#endif
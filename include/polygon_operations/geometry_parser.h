@@ -0,0 +1,72 @@
+#ifndef GEOMETRY_PARSER_H
+#define GEOMETRY_PARSER_H
+
+#include "polygon_operations/polygon_batch.h"
+#include "polygon_operations/thread_pool.h"
+#include <cstdint>
+
+/// Type of a parsed geometry, with the value of its WKB code
+enum class GeometryType : uint8_t { Point = 1, Polygon = 3, MultiPoint = 4 };
+
+/*!
+ * Geometries parsed from WKT or WKB, packed in CSR form like a PolygonBatch so that every
+ * geometry is passed as a pointer and a size to e.g. convex_hull_from_points or do_intersect
+ * without copying. Geometry i has the points from offsets[i] to offsets[i + 1]:
+ * - a POINT has its point, or none when it is empty
+ * - a MULTIPOINT has its points
+ * - a POLYGON has the vertices of its exterior ring moving counterclockwise, without the closing
+ *   vertex repeating the first one. The interior rings are skipped, since the polygons of the
+ *   library have no holes.
+ * The Z and M coordinates are skipped.
+ */
+struct GeometryBatch
+{
+    /*!
+     * Constructs an empty batch
+     * \param resource The memory resource of the buffers
+     */
+    explicit GeometryBatch(std::pmr::memory_resource* resource = std::pmr::get_default_resource()):
+        points(resource), types(resource) {}
+
+    /// Points of all the geometries
+    PolygonBatch points;
+
+    /// Type of every geometry
+    std::pmr::vector<GeometryType> types;
+
+    /// Number of geometries
+    size_t Size() const {return types.size();}
+};
+
+/*!
+ * Parses the WKT geometries of a text, e.g. a file with one geometry per line, appending them to a batch.
+ * The geometries are POINT, MULTIPOINT and POLYGON, separated by whitespace, with optional Z, M or ZM
+ * dimensions. The numbers are parsed with std::from_chars straight from the text into the batch.
+ * \param text The text, which does not need to be null-terminated
+ * \param length The number of characters of the text
+ * \param geometries The batch receiving the geometries
+ */
+void parse_wkt(const char* text, size_t length, GeometryBatch& geometries);
+
+/*!
+ * Parses the WKT geometries of a text as parse_wkt does, on all the threads of a pool. The text
+ * is split into chunks at line breaks, so a geometry must not span several lines. The chunks are
+ * parsed into batches of their own, which are concatenated in the order of the text.
+ * \param text The text, which does not need to be null-terminated
+ * \param length The number of characters of the text
+ * \param geometries The batch receiving the geometries
+ * \param pool The thread pool parsing the chunks
+ */
+void parse_wkt(const char* text, size_t length, GeometryBatch& geometries, WorkStealingThreadPool& pool);
+
+/*!
+ * Parses a sequence of concatenated WKB geometries, appending them to a batch.
+ * The geometries are Point, MultiPoint and Polygon in either byte order, with the Z, M and ZM
+ * dimensions of ISO WKB and EWKB (whose SRID is skipped). An empty point has NaN coordinates.
+ * \param data The bytes of the geometries
+ * \param length The number of bytes
+ * \param geometries The batch receiving the geometries
+ */
+void parse_wkb(const uint8_t* data, size_t length, GeometryBatch& geometries);
+
+#endif
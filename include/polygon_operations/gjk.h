@@ -0,0 +1,72 @@
+#ifndef GJK_H
+#define GJK_H
+
+#include "polygon_operations/utilities.h"
+
+/*!
+ * Cache of a GJK query for a single pair of polygons, kept by the caller between successive
+ * queries (e.g. simulation ticks). It stores the vertex indices of the final simplex, so the
+ * next query for the same pair starts from the previous solution instead of from scratch.
+ * The indices stay meaningful as long as the polygons keep the same vertices, e.g. when they
+ * are translated or rotated between the queries.
+ */
+struct GJKCache
+{
+    /// Number of vertices of the cached simplex (0 means that the cache is empty)
+    size_t simplexSize = 0;
+
+    /// Indices of the simplex vertices inside the first polygon
+    size_t indices1[3] = {0, 0, 0};
+
+    /// Indices of the simplex vertices inside the second polygon
+    size_t indices2[3] = {0, 0, 0};
+};
+
+/*!
+ * Result of a GJK query between two convex polygons
+ */
+struct GJKResult
+{
+    /// Whether the two polygons intersect (touching polygons are considered intersecting)
+    bool intersect;
+
+    /// Minimum distance between the two polygons (0 when they intersect)
+    double distance;
+
+    /// Point of the first polygon closest to the second polygon
+    Point witness1;
+
+    /// Point of the second polygon closest to the first polygon
+    Point witness2;
+
+    /// Number of support queries performed
+    size_t iterations;
+};
+
+/*!
+ * Finds whether two convex polygons intersect and their minimum distance using the
+ * Gilbert-Johnson-Keerthi (GJK) algorithm. The closest point of the Minkowski difference
+ * polygon1 - polygon2 to the origin is searched with a simplex of at most 3 vertices that is
+ * refined with support queries. Each support query is a hill climb from the previous simplex
+ * vertex with an O(logn) binary search fallback (see extreme_vertex_index).
+ * When the cache of the previous query of the same pair is given, the search starts from the
+ * cached simplex, so that coherent queries usually terminate in one or two iterations.
+ * Both polygons are given as a vector of points/vertices moving counterclockwise starting from
+ * the beginning of the vector.
+ * \param polygon1 Vector of Point for the first polygon
+ * \param polygon2 Vector of Point for the second polygon
+ * \param cache Cache of the pair which is read at the start and updated at the end of the query
+ * \return The intersection flag, the distance and the witness points of the two polygons
+ */
+GJKResult gjk_query(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2, GJKCache& cache);
+
+/*!
+ * Finds whether two convex polygons intersect and their minimum distance using the GJK algorithm
+ * without warm starting (see the overload with a GJKCache).
+ * \param polygon1 Vector of Point for the first polygon
+ * \param polygon2 Vector of Point for the second polygon
+ * \return The intersection flag, the distance and the witness points of the two polygons
+ */
+GJKResult gjk_query(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2);
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef MINKOWSKI_H
+#define MINKOWSKI_H
+
+#include "polygon_operations/thread_pool.h"
+#include "polygon_operations/utilities.h"
+
+/*!
+ * Computes the Minkowski sum {a + b} of two convex polygons with O(n + m) complexity, where n and m
+ * are the numbers of vertices of the two polygons, by merging their edges sorted by angle starting
+ * from their bottom vertices. Parallel edges are merged, so the sum has at most n + m vertices.
+ * Points and segments (polygons of 1 or 2 vertices) are accepted too. No heap allocation is performed.
+ * The polygons are given as contiguous arrays of points/vertices moving counterclockwise.
+ * \param polygon1 Pointer to the first vertex of the first polygon
+ * \param polygon1Size Number of vertices of the first polygon
+ * \param polygon2 Pointer to the first vertex of the second polygon
+ * \param polygon2Size Number of vertices of the second polygon
+ * \param sum Buffer of at least polygon1Size + polygon2Size points receiving the vertices of the
+ * sum moving counterclockwise from its bottom vertex
+ * \return Number of vertices written to the buffer
+ */
+size_t minkowski_sum(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size, Point* sum);
+
+/*!
+ * Computes the Minkowski sum {a + b} of two convex polygons with O(n + m) complexity
+ * \param polygon1 Vector of Point for the first polygon moving counterclockwise
+ * \param polygon2 Vector of Point for the second polygon moving counterclockwise
+ * \return The vertices of the sum moving counterclockwise from its bottom vertex
+ */
+std::vector<Point> minkowski_sum(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2);
+
+/*!
+ * Computes the Minkowski difference {a - b} of two convex polygons with O(n + m) complexity, i.e.
+ * the Minkowski sum of the first polygon with the second polygon reflected through the origin.
+ * The polygons intersect if and only if the difference contains the origin, and translating the
+ * first polygon by t translates the difference by t, so the difference can be reused for
+ * intersection and penetration queries with minkowski_signed_distance.
+ * \param polygon1 Vector of Point for the first polygon moving counterclockwise
+ * \param polygon2 Vector of Point for the second polygon moving counterclockwise
+ * \return The vertices of the difference moving counterclockwise from its bottom vertex
+ */
+std::vector<Point> minkowski_difference(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2);
+
+/*!
+ * Inflates many obstacles by the same shape, computing the Minkowski sum of every obstacle with the
+ * shape on all the threads of a pool. The shape is rotated to start from its bottom vertex once.
+ * \param obstacles The obstacles as vectors of points/vertices moving counterclockwise
+ * \param shape The shape as a vector of points/vertices moving counterclockwise
+ * \param pool The thread pool computing the sums
+ * \return The sum of every obstacle with the shape
+ */
+std::vector<std::vector<Point>> minkowski_sum_batch(const std::vector<std::vector<Point>>& obstacles,
+                                                    const std::vector<Point>& shape,
+                                                    WorkStealingThreadPool& pool);
+
+/*!
+ * Computes the Minkowski difference of many obstacles with the same shape on all the threads of a
+ * pool, e.g. the configuration-space obstacles of a robot translating with its reference point at
+ * the origin of its shape.
+ * \param obstacles The obstacles as vectors of points/vertices moving counterclockwise
+ * \param shape The shape as a vector of points/vertices moving counterclockwise
+ * \param pool The thread pool computing the differences
+ * \return The difference of every obstacle with the shape
+ */
+std::vector<std::vector<Point>> minkowski_difference_batch(const std::vector<std::vector<Point>>& obstacles,
+                                                           const std::vector<Point>& shape,
+                                                           WorkStealingThreadPool& pool);
+
+/*!
+ * Finds the signed distance of the origin from the boundary of a convex polygon with O(n) complexity,
+ * which is negative when the origin is inside the polygon. For a Minkowski difference of two polygons
+ * the distance is the separation of the polygons, or minus their penetration depth, and translating
+ * the first polygon by -closestPoint makes the two polygons touch.
+ * \param convexPolygon Vector of Point for the polygon moving counterclockwise
+ * \param closestPoint Set to the point of the boundary closest to the origin
+ * \return The signed distance of the origin from the boundary
+ */
+double minkowski_signed_distance(const std::vector<Point>& convexPolygon, Point& closestPoint);
+
+#endif
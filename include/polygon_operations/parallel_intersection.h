@@ -0,0 +1,34 @@
+#ifndef PARALLEL_INTERSECTION_H
+#define PARALLEL_INTERSECTION_H
+
+#include "polygon_operations/thread_pool.h"
+#include "polygon_operations/utilities.h"
+
+/*!
+ * Confirms a list of candidate pairs with do_intersect on all the threads of a pool.
+ * The pairs are split into contiguous chunks of similar estimated cost, where a pair of polygons
+ * with n and m vertices costs (n + m)^2 like the separating axis test, and every thread appends
+ * the intersecting pairs of its chunks to its own buffer. The buffers are concatenated at the end.
+ * \param polygons The polygons as vectors of points/vertices moving counterclockwise
+ * \param candidatePairs Pairs of indices of polygons to be tested
+ * \param pool The thread pool executing the tests
+ * \return The intersecting pairs, in unspecified order
+ */
+std::vector<PolygonPair> parallel_do_intersect(const std::vector<std::vector<Point>>& polygons,
+                                               const std::vector<PolygonPair>& candidatePairs,
+                                               WorkStealingThreadPool& pool);
+
+/*!
+ * Finds all the intersecting pairs between two sets of polygons on all the threads of a pool.
+ * Every polygon of the first set is tested against all the polygons of the second set, and the
+ * polygons of the first set are split into contiguous chunks of similar estimated cost.
+ * \param polygons1 The first set of polygons as vectors of points/vertices moving counterclockwise
+ * \param polygons2 The second set of polygons as vectors of points/vertices moving counterclockwise
+ * \param pool The thread pool executing the tests
+ * \return The intersecting pairs with the index in the first set first, in unspecified order
+ */
+std::vector<PolygonPair> parallel_do_intersect(const std::vector<std::vector<Point>>& polygons1,
+                                               const std::vector<std::vector<Point>>& polygons2,
+                                               WorkStealingThreadPool& pool);
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef POLYGON_BATCH_H
+#define POLYGON_BATCH_H
+
+#include "polygon_operations/utilities.h"
+#include <memory_resource>
+
+/*!
+ * Many polygons packed in compressed sparse row (CSR) form, i.e. the vertices of all the polygons
+ * in one contiguous buffer, where polygon i has the vertices from offsets[i] to offsets[i + 1].
+ * Batch operations stream over the buffer instead of chasing one heap block per polygon.
+ * Both buffers are allocated from a memory resource, e.g. a MonotonicArena reset after every batch.
+ * As for all std::pmr containers, a copy uses the default resource while a move keeps the resource.
+ */
+struct PolygonBatch
+{
+    /*!
+     * Constructs an empty batch
+     * \param resource The memory resource of the buffers
+     */
+    explicit PolygonBatch(std::pmr::memory_resource* resource = std::pmr::get_default_resource()):
+        vertices(resource), offsets(1, 0, resource) {}
+
+    /// Vertices of all the polygons, each polygon moving counterclockwise
+    std::pmr::vector<Point> vertices;
+
+    /// Start of every polygon inside vertices, followed by the total number of vertices
+    std::pmr::vector<size_t> offsets;
+
+    /// Memory resource of the buffers
+    std::pmr::memory_resource* Resource() const {return vertices.get_allocator().resource();}
+
+    /// Number of polygons
+    size_t Size() const {return offsets.size() - 1;}
+
+    /// Number of vertices of a polygon
+    size_t PolygonSize(size_t polygonId) const {return offsets[polygonId + 1] - offsets[polygonId];}
+
+    /// Pointer to the first vertex of a polygon
+    const Point* Polygon(size_t polygonId) const {return vertices.data() + offsets[polygonId];}
+
+    /// Appends a polygon at the end of the batch
+    void Add(const std::vector<Point>& polygon)
+    {
+        vertices.insert(vertices.end(), polygon.begin(), polygon.end());
+        offsets.push_back(vertices.size());
+    }
+
+    /// Copies a polygon of the batch into a vector
+    std::vector<Point> ToVector(size_t polygonId) const
+    {
+        return std::vector<Point>(vertices.begin() + offsets[polygonId], vertices.begin() + offsets[polygonId + 1]);
+    }
+};
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef POLYGON_METRICS_H
+#define POLYGON_METRICS_H
+
+#include "polygon_operations/polygon_batch.h"
+#include "polygon_operations/thread_pool.h"
+#include "polygon_operations/utilities.h"
+
+/*!
+ * Area, centroid, perimeter and second moments of area of a polygon
+ */
+struct PolygonMetrics
+{
+    /// Signed area, positive for polygons moving counterclockwise
+    double area = 0.0;
+
+    /// Centroid of the area, or the mean of the vertices when the area is 0
+    Point centroid = Point(0.0, 0.0);
+
+    /// Length of the boundary
+    double perimeter = 0.0;
+
+    /// Integral of (x - centroid.x)^2 over the area
+    double momentXX = 0.0;
+
+    /// Integral of (y - centroid.y)^2 over the area
+    double momentYY = 0.0;
+
+    /// Integral of (x - centroid.x) * (y - centroid.y) over the area
+    double momentXY = 0.0;
+};
+
+/*!
+ * Computes the area, centroid, perimeter and second moments of a simple polygon in a single pass
+ * over its edges with the shoelace formulas. Every edge adds its cross product, weighted by the
+ * polynomials of its endpoints giving the first and second moments, and its length to the sums.
+ * The edges are processed 4 at a time with AVX (2 with SSE2) when the library is compiled for it,
+ * and the coordinates are taken relative to the first vertex to limit the cancellation.
+ * The polygon is given as a contiguous array of points/vertices.
+ * \param polygon Pointer to the first vertex of the polygon
+ * \param polygonSize Number of vertices of the polygon
+ * \return The metrics of the polygon, all 0 for an empty polygon
+ */
+PolygonMetrics polygon_metrics(const Point* polygon, size_t polygonSize);
+
+/*!
+ * Computes the area, centroid, perimeter and second moments of a simple polygon in a single pass
+ * \param polygon Vector of Point for the polygon, e.g. a convex hull converted with StackToVectorFromBottom
+ * \return The metrics of the polygon, all 0 for an empty polygon
+ */
+PolygonMetrics polygon_metrics(const std::vector<Point>& polygon);
+
+/*!
+ * Computes the metrics of many polygons on all the threads of a pool
+ * \param polygons The polygons packed in CSR form
+ * \param pool The thread pool computing the metrics
+ * \return The metrics of every polygon, in the order of the batch
+ */
+std::vector<PolygonMetrics> polygon_metrics_batch(const PolygonBatch& polygons, WorkStealingThreadPool& pool);
+
+#endif
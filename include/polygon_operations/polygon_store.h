@@ -0,0 +1,128 @@
+#ifndef POLYGON_STORE_H
+#define POLYGON_STORE_H
+
+#include "polygon_operations/polygon_batch.h"
+#include <cstdint>
+#include <string>
+
+/*!
+ * Binary file of many convex polygons, mapped into memory so that opening it takes O(1) time
+ * regardless of the number of polygons. The file is little-endian and made of sections aligned
+ * to 64 bytes:
+ * - a header of 64 bytes: the magic "POLYSTOR", the version and the flags (uint32), the number
+ *   of polygons, the number of vertices and the byte offsets of the four sections below (uint64),
+ *   where an absent section has offset 0
+ * - the offsets of the polygons in CSR form, as in PolygonBatch (polygons + 1 uint64)
+ * - the vertices of all the polygons moving counterclockwise (vertices * 2 doubles, x then y)
+ * - optionally, the bounding boxes of the polygons (polygons * 4 doubles, minX, minY, maxX, maxY)
+ * - optionally, the unnormalized normals of the edges, one per vertex for the edge starting from
+ *   it, as computed by the SAT kernel (vertices * 2 doubles)
+ */
+namespace PolygonStoreFormat
+{
+    /// Version written in the header, incremented when the layout changes
+    const uint32_t version = 1;
+
+    /// Alignment of every section inside the file
+    const uint64_t alignment = 64;
+
+    /// Flags of the header marking the optional sections
+    const uint32_t hasBoundingBoxes = 1;
+    const uint32_t hasEdgeNormals = 2;
+}
+
+/*!
+ * Optional sections of a polygon store
+ */
+struct PolygonStoreOptions
+{
+    /// Cache the bounding boxes of the polygons, e.g. for a broad phase
+    bool boundingBoxes = true;
+
+    /// Cache the normals of the edges, e.g. for separating axis tests
+    bool edgeNormals = false;
+};
+
+/*!
+ * Writes a batch of polygons into a polygon store file
+ * \param path The path of the file, which is replaced atomically: the store is written to a temporary
+ * file in the same directory, flushed to the disk and renamed over the path, so that a reader never
+ * maps a partially written store and a failed write leaves the previous file intact
+ * \param batch The polygons, each with its vertices moving counterclockwise
+ * \param options The optional sections to write
+ */
+void write_polygon_store(const std::string& path, const PolygonBatch& batch, const PolygonStoreOptions& options = PolygonStoreOptions());
+
+/*!
+ * Read-only view of a polygon store file mapped into memory. Opening checks the header and the
+ * sizes of the sections but not the polygons, so the pages are read lazily by the queries and
+ * shared among all the processes opening the same file. The views of the polygons, as in
+ * PolygonBatch, point inside the mapping and are passed directly to the queries taking pointers,
+ * e.g. point_is_in_polygon or do_intersect. They are valid as long as the store is.
+ * Opening trusts the offsets between the first and the last one: a corrupted or crafted file can
+ * make the views point outside the mapping. Files from untrusted sources must be checked with
+ * Validate before any query.
+ */
+class PolygonStore
+{
+public:
+    /*!
+     * Maps a polygon store file into memory
+     * \param path The path of the file
+     */
+    explicit PolygonStore(const std::string& path);
+    ~PolygonStore();
+
+    PolygonStore(PolygonStore&& other) noexcept;
+    PolygonStore& operator=(PolygonStore&& other) noexcept;
+    PolygonStore(const PolygonStore&) = delete;
+    PolygonStore& operator=(const PolygonStore&) = delete;
+
+    /// Number of polygons
+    size_t Size() const {return polygonsNumber;}
+
+    /// Number of vertices of all the polygons
+    size_t VerticesNumber() const {return verticesNumber;}
+
+    /// Number of vertices of a polygon
+    size_t PolygonSize(size_t polygonId) const {return offsets[polygonId + 1] - offsets[polygonId];}
+
+    /// Pointer to the first vertex of a polygon
+    const Point* Polygon(size_t polygonId) const {return vertices + offsets[polygonId];}
+
+    /// Whether the bounding boxes are stored
+    bool HasBoundingBoxes() const {return boxes != nullptr;}
+
+    /// Bounding box of a polygon, when stored
+    const BoundingBox& Box(size_t polygonId) const {return boxes[polygonId];}
+
+    /// Whether the normals of the edges are stored
+    bool HasEdgeNormals() const {return normals != nullptr;}
+
+    /// Normals of the edges of a polygon, when stored, where normal i is the one of the edge starting from vertex i
+    const Point* EdgeNormals(size_t polygonId) const {return normals + offsets[polygonId];}
+
+    /*!
+     * Checks in O(n) that the offsets of the polygons never decrease and stay within the vertices,
+     * so that every view of a polygon, its bounding box and its normals lie inside the mapping
+     */
+    void Validate() const;
+
+    /// Copies the polygons into a batch
+    PolygonBatch ToBatch(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const;
+
+private:
+    /// Unmaps the file
+    void Close();
+
+    void* mapping = nullptr;
+    size_t mappingSize = 0;
+    size_t polygonsNumber = 0;
+    size_t verticesNumber = 0;
+    const uint64_t* offsets = nullptr;
+    const Point* vertices = nullptr;
+    const BoundingBox* boxes = nullptr;
+    const Point* normals = nullptr;
+};
+
+#endif
@@ -0,0 +1,242 @@
+#ifndef PREDICATES_H
+#define PREDICATES_H
+
+#include "polygon_operations/utilities.h"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+/*!
+ * Computes the orientation determinant (b - a) x (c - a) in plain double arithmetic, which is
+ * positive when a, b and c are rotated counterclockwise, negative when they are rotated clockwise
+ * and zero when they are collinear. Rounding may give the wrong sign for nearly collinear points.
+ * \param a The first point
+ * \param b The second point
+ * \param c The third point
+ * \return The rounded determinant
+ */
+constexpr double orient2d_fast(const Point& a, const Point& b, const Point& c)
+{
+    return (b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y);
+}
+
+/*!
+ * Applies the semi-static error bound filter of Shewchuk, "Adaptive Precision Floating-Point
+ * Arithmetic and Fast Robust Geometric Predicates", to the orientation determinant: the rounded
+ * determinant has the exact sign when its magnitude exceeds (3 + 16eps)eps times the sum of the
+ * magnitudes of its two products, where eps = 2^-53. The products are taken relative to c, which
+ * gives the same determinant. Products of opposite signs cannot cancel and always pass the test.
+ * \param a The first point
+ * \param b The second point
+ * \param c The third point
+ * \param determinant Set to the rounded determinant
+ * \return Boolean indicating whether the sign of the rounded determinant is certified
+ */
+inline bool orient2d_filter(const Point& a, const Point& b, const Point& c, double& determinant)
+{
+    const double epsilon = std::numeric_limits<double>::epsilon() / 2.0;
+    const double errorBound = (3.0 + 16.0 * epsilon) * epsilon;
+
+    const double left = (a.x - c.x) * (b.y - c.y);
+    const double right = (a.y - c.y) * (b.x - c.x);
+    determinant = left - right;
+    return std::fabs(determinant) >= errorBound * (std::fabs(left) + std::fabs(right));
+}
+
+/*!
+ * Computes the orientation determinant (b - a) x (c - a) exactly with expansion arithmetic: the
+ * products of the determinant are split into error-free pairs of doubles and summed exactly. Two
+ * products relative to c suffice when the differences of the coordinates are exact, and otherwise
+ * the six products of the expanded determinant are summed.
+ * The inputs must not overflow or underflow when multiplied.
+ * \param a The first point
+ * \param b The second point
+ * \param c The third point
+ * \return The largest component of the exact determinant, which has its sign
+ */
+double orient2d_exact(const Point& a, const Point& b, const Point& c);
+
+/*!
+ * Computes the orientation determinant (b - a) x (c - a) with the exact sign. The rounded
+ * determinant is returned when orient2d_filter certifies it, which is the case for all but
+ * nearly collinear points, and otherwise it is computed by orient2d_exact.
+ * The inputs must not overflow or underflow when multiplied.
+ * \param a The first point
+ * \param b The second point
+ * \param c The third point
+ * \return A value with the sign of the exact determinant and approximately its magnitude
+ */
+inline double orient2d_adaptive(const Point& a, const Point& b, const Point& c)
+{
+    double determinant = 0.0;
+    if (orient2d_filter(a, b, c, determinant))
+        return determinant;
+    return orient2d_exact(a, b, c);
+}
+
+/*!
+ * Computes the orientation determinant (b - a) x (c - a) with the selected predicate. A scalar
+ * float test is no faster than the double filter, so the mixed precision predicate uses
+ * orient2d_adaptive for single determinants and float arithmetic only in orient2d_signs.
+ * \param a The first point
+ * \param b The second point
+ * \param c The third point
+ * \param predicate The predicate deciding the orientation
+ * \return The determinant, with the exact sign for the adaptive predicate
+ */
+constexpr double orient2d(const Point& a, const Point& b, const Point& c, OrientationPredicate predicate)
+{
+    switch (predicate)
+    {
+        case OrientationPredicate::Adaptive:
+        case OrientationPredicate::MixedPrecision:
+            return orient2d_adaptive(a, b, c);
+        default:
+            return orient2d_fast(a, b, c);
+    }
+}
+
+/*!
+ * Calls a kernel instantiated for a predicate selected at run time. Loops testing orientations at
+ * every step, e.g. the comparator of a sort, are written as generic kernels taking the predicate as
+ * a std::integral_constant and testing with an OrientationKernel, so that the predicate is selected
+ * once per call instead of at every test and the tests are inlined into the loops.
+ * \param predicate The predicate deciding the orientation
+ * \param kernel Generic callable taking std::integral_constant<OrientationPredicate, predicate>
+ * \return The result of the kernel
+ */
+template<typename Kernel>
+decltype(auto) dispatch_predicate(OrientationPredicate predicate, Kernel&& kernel)
+{
+    switch (predicate)
+    {
+        case OrientationPredicate::Adaptive:
+            return kernel(std::integral_constant<OrientationPredicate, OrientationPredicate::Adaptive>());
+        case OrientationPredicate::MixedPrecision:
+            return kernel(std::integral_constant<OrientationPredicate, OrientationPredicate::MixedPrecision>());
+        default:
+            return kernel(std::integral_constant<OrientationPredicate, OrientationPredicate::Fast>());
+    }
+}
+
+/*!
+ * Static error bound of the orientation determinant computed by orient2d_fast for any three points
+ * inside a bounding box. The error bound of orient2d_filter is relative to the sum of the magnitudes
+ * of the two products, which is at most twice the product of the width and the height of the box,
+ * and the constant is raised slightly to cover the rounding of the bound itself. A non-finite box
+ * gives a bound that certifies no determinant.
+ * \param box The bounding box of the points
+ * \return The bound, above which the magnitude of the rounded determinant certifies its sign
+ */
+inline double orient2d_static_bound(const BoundingBox& box)
+{
+    const double epsilon = std::numeric_limits<double>::epsilon() / 2.0;
+    const double errorBound = (3.0 + 32.0 * epsilon) * epsilon;
+    return 2.0 * errorBound * ((box.maxX - box.minX) * (box.maxY - box.minY));
+}
+
+/*!
+ * Orientation tests with a predicate fixed at compile time, for the kernels templated on the
+ * predicate (see dispatch_predicate). A kernel constructed with the bounding box of all the points
+ * it tests certifies the rounded determinant of the exact predicates with orient2d_static_bound.
+ * The determinant is compared with the bound and its opposite, so that a certified sign costs the
+ * single comparison of the fast predicate, and only the uncertified determinants go through
+ * orient2d_adaptive. Without a box, the exact predicates always use orient2d_adaptive.
+ * ThreePointOrientation keeps the rounding of the fast predicate of the function of the same name,
+ * with the determinant relative to Q.
+ * \tparam predicate The predicate deciding the orientation
+ */
+template<OrientationPredicate predicate>
+class OrientationKernel
+{
+public:
+    /// Kernel for any points
+    OrientationKernel() = default;
+
+    /// Kernel for the points inside a bounding box
+    explicit OrientationKernel(const BoundingBox& box) : staticBound(orient2d_static_bound(box)) {}
+
+    /// Sign of the orientation determinant, positive when c is on the left of the line from a to b
+    int Sign(const Point& a, const Point& b, const Point& c) const
+    {
+        const double determinant = orient2d_fast(a, b, c);
+        if (predicate == OrientationPredicate::Fast)
+            return (determinant > 0.0) - (determinant < 0.0);
+
+        // Comparing with the bound on both sides gives the certified signs with a single test
+        if (determinant > staticBound)
+            return 1;
+        if (determinant < -staticBound)
+            return -1;
+        const double adaptiveDeterminant = orient2d_adaptive(a, b, c);
+        return (adaptiveDeterminant > 0.0) - (adaptiveDeterminant < 0.0);
+    }
+
+    /// 0 for collinear points, 1 for points rotated clockwise and 2 for points rotated counterclockwise
+    int ThreePointOrientation(const Point &P, const Point &Q, const Point &R) const
+    {
+        if ((P==Q) || (Q==R) || (R==P))
+            throw std::invalid_argument("Attempted to compute the orientation of three points when at least two of them are identical");
+
+        // The determinant relative to Q has the same static error bound as the one of orient2d, and
+        // the opposite sign, so that it is positive for clockwise points
+        double value = (Q.y - P.y) * (R.x - Q.x) - (Q.x - P.x) * (R.y - Q.y);
+        if (predicate != OrientationPredicate::Fast)
+        {
+            if (value > staticBound)
+                return 1;
+            if (value < -staticBound)
+                return 2;
+            value = -orient2d_adaptive(P, Q, R);
+        }
+
+        if (value == 0)
+            return 0;               // collinear
+        return (value > 0) ? 1 : 2; // clock or counterclock wise
+    }
+
+    /// Whether P, Q and R are rotated counterclockwise, or Q is nearer to P for collinear points
+    bool CompareOrientation(const Point &P, const Point &Q, const Point &R) const
+    {
+        const int threePointOrientation = ThreePointOrientation(P, Q, R);
+        // If three points are collinear, then the nearest point should be placed first
+        if (threePointOrientation == 0)
+            return (EuclideanDistance(P, Q) <= EuclideanDistance(P, R));
+
+        return threePointOrientation == 2;
+    }
+
+    /// Whether a point is not strictly on the left of the edge from tail to head
+    bool IsPointRightToTheEdge(const Point &tail, const Point &head, const Point &examinedPoint) const
+    {
+        return !(ThreePointOrientation(tail, head, examinedPoint) == 2); // counterclockwise
+    }
+
+private:
+    double staticBound = std::numeric_limits<double>::infinity();
+};
+
+/*!
+ * Computes the signs of the orientation determinants (b - a) x (points[i] - a) of a number of
+ * points with respect to the line through a and b, e.g. for testing many points against an edge.
+ * With the mixed precision predicate the determinants are evaluated with SIMD float arithmetic,
+ * 8 points per iteration with AVX and 4 with SSE2, on the differences points[i] - a and b - a
+ * rounded to float. A float sign is certified when the magnitude of the determinant exceeds
+ * (4 + 64eps)eps times the sum of the magnitudes of its two products, with eps = 2^-24, plus a
+ * tiny absolute term covering underflow. Only the points whose float sign is not certified are
+ * re-evaluated with orient2d_adaptive, so the signs are exact.
+ * \param a The first point of the line
+ * \param b The second point of the line
+ * \param points Pointer to the points
+ * \param pointsNumber The number of points
+ * \param signs Buffer of pointsNumber values set to 1 for points left of the line, -1 for points right
+ * of it and 0 for points on it
+ * \param predicate The predicate deciding the orientation
+ * \return The number of points whose sign was not certified by the first filter of the predicate,
+ * which is 0 for the fast predicate
+ */
+size_t orient2d_signs(const Point& a, const Point& b, const Point* points, size_t pointsNumber, signed char* signs,
+                      OrientationPredicate predicate);
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef ROTATED_BOX_H
+#define ROTATED_BOX_H
+
+#include "polygon_operations/thread_pool.h"
+#include "polygon_operations/utilities.h"
+
+/*!
+ * Rotated rectangles in structure-of-arrays layout, where box i has its center at
+ * (centerX[i], centerY[i]), sides width[i] and height[i] and is rotated counterclockwise
+ * by angle[i] radians around its center. Boxes with non-positive sides have zero area.
+ */
+struct RotatedBoxes
+{
+    std::vector<double> centerX;
+    std::vector<double> centerY;
+    std::vector<double> width;
+    std::vector<double> height;
+    std::vector<double> angle;
+
+    /// Number of boxes, which throws when the parameter arrays have different sizes
+    size_t Size() const;
+};
+
+/*!
+ * Computes the corners of a rotated box
+ * \param boxes The boxes
+ * \param boxId The index of the box
+ * \return The four corners moving counterclockwise
+ */
+std::vector<Point> rotated_box_corners(const RotatedBoxes& boxes, size_t boxId);
+
+/*!
+ * Computes the intersection over union (IoU) of two rotated boxes, i.e. the area of their
+ * intersection divided by the area of their union, which is 0 for disjoint boxes.
+ * \param boxes1 The boxes containing the first box
+ * \param boxId1 The index of the first box
+ * \param boxes2 The boxes containing the second box
+ * \param boxId2 The index of the second box
+ * \return The IoU of the two boxes
+ */
+double rotated_box_iou(const RotatedBoxes& boxes1, size_t boxId1, const RotatedBoxes& boxes2, size_t boxId2);
+
+/*!
+ * Computes the IoU of every box of a set with every box of another set on all the threads of a pool.
+ * The corners and the axis-aligned bounding boxes of all the boxes are computed once, every box of
+ * the first set is tested against four boxes of the second set at a time for overlapping bounding
+ * boxes with SIMD instructions (AVX when enabled at compile time, SSE2 otherwise), and only the
+ * overlapping pairs are intersected with convex_polygon_intersection.
+ * \param boxes1 The first set of N boxes
+ * \param boxes2 The second set of M boxes
+ * \param pool The thread pool computing the rows of the matrix
+ * \param iou Replaced by the N x M matrix in row-major order, where iou[i * M + j] is the IoU of
+ * box i of the first set and box j of the second set
+ */
+void rotated_box_iou_matrix(const RotatedBoxes& boxes1, const RotatedBoxes& boxes2, WorkStealingThreadPool& pool,
+                            std::vector<double>& iou);
+
+/*!
+ * Greedy non-maximum suppression of rotated boxes: the boxes are visited in decreasing score and a
+ * box is kept if its IoU with every kept box does not exceed a threshold. Every box is compared only
+ * with the boxes kept so far, starting with a SIMD test of their bounding boxes, and the comparisons
+ * stop at the first suppressing box, so the IoU matrix is never computed completely.
+ * \param boxes The boxes
+ * \param scores The score of every box
+ * \param iouThreshold Boxes with a larger IoU with a kept box are suppressed
+ * \return The indices of the kept boxes in decreasing score
+ */
+std::vector<size_t> rotated_nms(const RotatedBoxes& boxes, const std::vector<double>& scores, double iouThreshold);
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef SAT_KERNEL_H
+#define SAT_KERNEL_H
+
+#include "polygon_operations/utilities.h"
+
+/*!
+ * Range of the projections of the vertices of a polygon on an axis
+ */
+struct ProjectionExtents
+{
+    double minimum;
+    double maximum;
+};
+
+/*!
+ * Minimum translation vector separating two intersecting polygons
+ */
+struct MinimumTranslation
+{
+    /// Unit direction along which the first polygon has to be moved
+    Vector direction = Vector(0.0, 0.0);
+
+    /// Length of the translation, i.e. the penetration depth of the polygons
+    double depth = 0.0;
+};
+
+/*!
+ * Computes the minimum and the maximum projection of the vertices of a polygon on an axis
+ * in a single pass over the vertices without storing the projections. Polygons with many
+ * vertices are processed with SIMD instructions (AVX when enabled at compile time, SSE2 otherwise).
+ * \param vertices Pointer to the first vertex of the polygon
+ * \param verticesNumber Number of vertices of the polygon
+ * \param axis The axis of the projections, which does not need to be normalized
+ * \return The minimum and maximum projection (scaled by the norm of the axis)
+ */
+ProjectionExtents projection_extents(const Point* vertices, size_t verticesNumber, const Vector& axis);
+
+/*!
+ * Finds whether two polygons intersect with each other using Seperating Axis Theorem (SAP)
+ * without any heap allocation. The edge normals are not normalized, since the overlap of the
+ * projection ranges does not depend on the length of the axis, and the range of each polygon
+ * is computed with projection_extents. This is the engine behind both do_intersect overloads.
+ * The polygons are given as contiguous arrays of points/vertices moving counterclockwise.
+ * \param polygon1 Pointer to the first vertex of the first polygon
+ * \param polygon1Size Number of vertices of the first polygon
+ * \param polygon2 Pointer to the first vertex of the second polygon
+ * \param polygon2Size Number of vertices of the second polygon
+ * \return Boolean indicating whether the two polygons intersect
+ */
+bool sat_do_intersect(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size);
+
+/*!
+ * Searches for an edge whose normal separates two polygons, as sat_do_intersect does, but
+ * starting from a given edge instead of the first one, e.g. the separating edge of the
+ * previous test of the same pair. The edges are numbered with the edges of the first polygon
+ * first, where edge i starts from vertex i, followed by the edges of the second polygon.
+ * \param polygon1 Pointer to the first vertex of the first polygon
+ * \param polygon1Size Number of vertices of the first polygon
+ * \param polygon2 Pointer to the first vertex of the second polygon
+ * \param polygon2Size Number of vertices of the second polygon
+ * \param firstEdge The edge tested first (0 is used when it is out of range)
+ * \param separatingEdge Set to the separating edge when one is found
+ * \return Boolean indicating whether a separating edge was found, i.e. the polygons do not intersect
+ */
+bool sat_find_separating_edge(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size,
+                              size_t firstEdge, size_t& separatingEdge);
+
+/*!
+ * Finds whether two polygons intersect with each other using Seperating Axis Theorem (SAP), as
+ * sat_do_intersect does, and tracks the axis of minimum overlap in the same sweep over the axes.
+ * For intersecting convex polygons that axis gives the minimum translation vector, i.e. moving the
+ * first polygon by depth along direction makes the polygons touch. The overlaps along the
+ * unnormalized edge normals are compared without divisions or square roots, so the extra cost over
+ * the boolean test is a few multiplications per axis.
+ * \param polygon1 Pointer to the first vertex of the first polygon
+ * \param polygon1Size Number of vertices of the first polygon
+ * \param polygon2 Pointer to the first vertex of the second polygon
+ * \param polygon2Size Number of vertices of the second polygon
+ * \param translation Set to the minimum translation vector when the polygons intersect
+ * \return Boolean indicating whether the two polygons intersect
+ */
+bool sat_minimum_translation(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size,
+                             MinimumTranslation& translation);
+
+#endif
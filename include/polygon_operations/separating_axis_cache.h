@@ -0,0 +1,115 @@
+#ifndef SEPARATING_AXIS_CACHE_H
+#define SEPARATING_AXIS_CACHE_H
+
+#include "polygon_operations/utilities.h"
+#include <cstdint>
+
+/*!
+ * Outcome of the last test of a pair of polygons
+ */
+struct CachedPairState
+{
+    /// Whether the polygons were overlapping
+    bool overlapping;
+
+    /// Id of the polygon owning the separating edge (meaningful when not overlapping)
+    size_t edgePolygonId;
+
+    /// Index of the separating edge, starting from vertex edgeIndex of that polygon
+    size_t edgeIndex;
+};
+
+/*!
+ * Statistics of a SeparatingAxisCache
+ */
+struct SeparatingAxisCacheStatistics
+{
+    /// Number of lookups
+    size_t lookups = 0;
+
+    /// Number of lookups that found the pair
+    size_t hits = 0;
+
+    /// Number of stores where the cached separating edge still separated the pair
+    size_t axisReuses = 0;
+
+    /// Number of pairs replaced in order to store another pair
+    size_t evictions = 0;
+
+    /// Fraction of the lookups that found the pair
+    double HitRate() const { return (lookups == 0) ? 0.0 : static_cast<double>(hits) / lookups; }
+};
+
+/*!
+ * Bounded cache of the separating axes of pairs of polygons for repeated tests of the same pairs,
+ * e.g. in a collision loop running every frame. It is keyed by the unordered pair of polygon ids.
+ * The entries are stored in a fixed array of 4-way buckets allocated at construction, so memory
+ * never grows; when a bucket is full, its least recently used pair is evicted.
+ * The cache is not thread safe; use one cache per thread.
+ */
+class SeparatingAxisCache
+{
+public:
+    /// Construct a cache holding at least capacity pairs
+    explicit SeparatingAxisCache(size_t capacity);
+
+    /// Find the state of a pair, returning false when the pair is not cached
+    bool Lookup(size_t polygon1Id, size_t polygon2Id, CachedPairState& state);
+
+    /// Store the state of a pair, evicting the least recently used pair of its bucket if required
+    void Store(size_t polygon1Id, size_t polygon2Id, const CachedPairState& state);
+
+    /// Remove all the pairs while keeping the statistics
+    void Clear();
+
+    /// Maximum number of pairs held
+    size_t Capacity() const { return entries.size(); }
+
+    /// Number of pairs currently held
+    size_t Size() const { return size; }
+
+    const SeparatingAxisCacheStatistics& Statistics() const { return statistics; }
+
+    void ResetStatistics() { statistics = SeparatingAxisCacheStatistics(); }
+
+private:
+    struct Entry
+    {
+        size_t lowerId = 0;
+        size_t upperId = 0;
+        CachedPairState state = {true, 0, 0};
+        uint64_t lastUse = 0;   // 0 means that the entry is empty
+    };
+
+    static const size_t bucketSize = 4;
+
+    /// Find the entry of a pair inside its bucket, or nullptr
+    Entry* Find(size_t lowerId, size_t upperId);
+
+    Entry* Bucket(size_t lowerId, size_t upperId);
+
+    std::vector<Entry> entries;
+    size_t bucketMask;
+    size_t size = 0;
+    uint64_t clock = 0;
+    SeparatingAxisCacheStatistics statistics;
+};
+
+/*!
+ * Finds whether two polygons intersect with each other using Seperating Axis Theorem (SAP), consulting
+ * the state of the previous test of the same pair. If the pair was separated, the previous separating
+ * edge is tested first, which usually resolves the test with a single projection, and the search
+ * continues from its neighbouring edges otherwise. The new state is stored in the cache.
+ * Both polygons are given as a vector of points/vertices moving counterclockwise starting from
+ * the beginning of the vector.
+ * \param polygon1 Vector of Point for the first polygon
+ * \param polygon1Id Id of the first polygon
+ * \param polygon2 Vector of Point for the second polygon
+ * \param polygon2Id Id of the second polygon
+ * \param cache The cache of the pair states
+ * \return Boolean indicating whether the two polygons intersect
+ */
+bool do_intersect(const std::vector<Point>& polygon1, size_t polygon1Id,
+                  const std::vector<Point>& polygon2, size_t polygon2Id, SeparatingAxisCache& cache);
+
+#endif
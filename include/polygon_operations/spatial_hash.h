@@ -0,0 +1,83 @@
+#ifndef SPATIAL_HASH_H
+#define SPATIAL_HASH_H
+
+#include "polygon_operations/broad_phase.h"
+#include <cstdint>
+
+/*!
+ * Uniform-grid spatial hashing broad phase finding all the intersecting pairs among a set of
+ * convex polygons, suited to dense sets of similarly sized polygons.
+ * The bounding box of every polygon is inserted into all the grid cells it covers, where the
+ * cells are hashed by their integer coordinates and binned with counting sort. Two polygons
+ * sharing several cells are reported only from the cell containing the lower-left corner of
+ * the intersection of their bounding boxes, so no global set of pairs is needed.
+ * A polygon covering more cells than a given maximum, e.g. an outlier much larger than the cell
+ * size, is not inserted into the grid but kept in an overflow list tested against all the others.
+ * All buffers are kept between the calls, so rebuilding the grid every frame reuses their memory.
+ * The polygons are identified by their index inside the vector passed at every call.
+ */
+class SpatialHashGrid
+{
+public:
+    /*!
+     * Construct a grid with a given cell size
+     * \param cellSize The side of the square cells, or 0 for tuning it at every call to the mean
+     * extent (the larger side of the bounding box) of the polygons
+     * \param maximumCellsPerPolygon The maximum number of cells a polygon is inserted into, beyond
+     * which it is moved to the overflow list
+     */
+    explicit SpatialHashGrid(double cellSize = 0.0, size_t maximumCellsPerPolygon = 64);
+
+    /*!
+     * Finds the pairs of polygons whose bounding boxes overlap
+     * \param polygons The polygons as vectors of points/vertices moving counterclockwise, with finite coordinates
+     * \return The candidate pairs, with the lower index first (valid until the next call)
+     */
+    const std::vector<PolygonPair>& FindCandidatePairs(const std::vector<std::vector<Point>>& polygons);
+
+    /*!
+     * Finds the pairs of intersecting polygons, confirming the candidate pairs with do_intersect
+     * \param polygons The polygons as vectors of points/vertices moving counterclockwise, with finite coordinates
+     * \return The intersecting pairs, with the lower index first (valid until the next call)
+     */
+    const std::vector<PolygonPair>& FindIntersectingPairs(const std::vector<std::vector<Point>>& polygons);
+
+    /// Cell size used by the last call
+    double CellSize() const { return cellSize; }
+
+    /// Number of polygons moved to the overflow list by the last call
+    size_t OverflowSize() const { return overflowIds.size(); }
+
+    /// Timings and counters of the last call, where moves is the number of binned cell entries
+    const BroadPhaseTimings& LastTimings() const { return timings; }
+
+private:
+    struct CellEntry
+    {
+        int64_t cellX;
+        int64_t cellY;
+        size_t polygonId;
+    };
+
+    /// Integer coordinate of the cell containing a coordinate
+    int64_t CellCoordinate(double coordinate) const;
+
+    /// Bucket of the hash table of a cell
+    size_t CellBucket(int64_t cellX, int64_t cellY) const;
+
+    double requestedCellSize;
+    double cellSize;
+    size_t maximumCellsPerPolygon;
+    size_t bucketMask = 0;
+    std::vector<BoundingBox> boxes;
+    std::vector<size_t> overflowIds;
+    std::vector<bool> isOverflow;
+    std::vector<CellEntry> unbinnedEntries;
+    std::vector<CellEntry> entries;
+    std::vector<size_t> bucketStarts;
+    std::vector<PolygonPair> candidatePairs;
+    std::vector<PolygonPair> intersectingPairs;
+    BroadPhaseTimings timings;
+};
+
+#endif
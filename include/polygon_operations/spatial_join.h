@@ -0,0 +1,67 @@
+#ifndef SPATIAL_JOIN_H
+#define SPATIAL_JOIN_H
+
+#include "polygon_operations/thread_pool.h"
+#include "polygon_operations/utilities.h"
+#include <ostream>
+
+/*!
+ * Counters of a spatial join
+ */
+struct SpatialJoinStatistics
+{
+    /// Number of grid partitions containing polygons of both collections
+    size_t partitions = 0;
+
+    /// Number of pairs with overlapping bounding boxes
+    size_t candidatePairs = 0;
+
+    /// Number of candidate pairs confirmed by do_intersect
+    size_t intersectingPairs = 0;
+};
+
+/// Receives a batch of intersecting pairs of a spatial join, with the index in the first collection first
+typedef std::function<void(const std::vector<PolygonPair>& pairs)> SpatialJoinCallback;
+
+/*!
+ * Finds all the intersecting pairs between two collections of convex polygons and streams them to a callback.
+ * Both collections are partitioned by a uniform grid over their common bounding box, where every
+ * polygon belongs to all the partitions covered by its bounding box. The partitions are joined in
+ * parallel with a sweep over the bounding boxes sorted by their lower x, and a pair is reported only
+ * by the partition containing the lower-left corner of the intersection of the two bounding boxes,
+ * so pairs spanning several partitions are reported once.
+ * Every thread buffers up to batchSize pairs before passing them to the callback, which is never
+ * called concurrently, so the pairs are never held in memory at once.
+ * \param polygons1 The first collection as vectors of points/vertices moving counterclockwise
+ * \param polygons2 The second collection as vectors of points/vertices moving counterclockwise
+ * \param pool The thread pool joining the partitions
+ * \param callback The function receiving the batches of intersecting pairs, in unspecified order
+ * \param partitionsPerSide The number of grid partitions along each axis, or 0 for choosing it from
+ * the number of polygons and their mean extent
+ * \param batchSize The number of pairs buffered by every thread before calling the callback
+ * \return The counters of the join
+ */
+SpatialJoinStatistics spatial_join(const std::vector<std::vector<Point>>& polygons1,
+                                   const std::vector<std::vector<Point>>& polygons2,
+                                   WorkStealingThreadPool& pool,
+                                   const SpatialJoinCallback& callback,
+                                   size_t partitionsPerSide = 0,
+                                   size_t batchSize = 4096);
+
+/*!
+ * Finds all the intersecting pairs between two collections of convex polygons and writes them to
+ * a stream, one pair per line as the two indices separated by a space
+ * \param polygons1 The first collection as vectors of points/vertices moving counterclockwise
+ * \param polygons2 The second collection as vectors of points/vertices moving counterclockwise
+ * \param pool The thread pool joining the partitions
+ * \param output The stream receiving the intersecting pairs, in unspecified order
+ * \param partitionsPerSide The number of grid partitions along each axis, or 0 for choosing it automatically
+ * \return The counters of the join
+ */
+SpatialJoinStatistics spatial_join(const std::vector<std::vector<Point>>& polygons1,
+                                   const std::vector<std::vector<Point>>& polygons2,
+                                   WorkStealingThreadPool& pool,
+                                   std::ostream& output,
+                                   size_t partitionsPerSide = 0);
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef SWEEP_AND_PRUNE_H
+#define SWEEP_AND_PRUNE_H
+
+#include "polygon_operations/broad_phase.h"
+
+/*!
+ * Sweep-and-prune broad phase finding all the intersecting pairs among a set of convex polygons.
+ * The bounding boxes of the polygons are kept sorted by their minimum x coordinate and the
+ * sorted intervals are swept, so that only pairs overlapping along x are tested for overlap
+ * along y. The order is kept between the calls and repaired with insertion sort, which is
+ * close to linear when the polygons move slightly between the frames. When the number of
+ * polygons changes, the order is rebuilt from scratch.
+ * The polygons are identified by their index inside the vector passed at every call.
+ */
+class SweepAndPrune
+{
+public:
+    /*!
+     * Finds the pairs of polygons whose bounding boxes overlap
+     * \param polygons The polygons as vectors of points/vertices moving counterclockwise
+     * \return The candidate pairs, with the lower index first (valid until the next call)
+     */
+    const std::vector<PolygonPair>& FindCandidatePairs(const std::vector<std::vector<Point>>& polygons);
+
+    /*!
+     * Finds the pairs of intersecting polygons, confirming the candidate pairs with do_intersect
+     * \param polygons The polygons as vectors of points/vertices moving counterclockwise
+     * \return The intersecting pairs, with the lower index first (valid until the next call)
+     */
+    const std::vector<PolygonPair>& FindIntersectingPairs(const std::vector<std::vector<Point>>& polygons);
+
+    /// Timings and counters of the last call
+    const BroadPhaseTimings& LastTimings() const { return timings; }
+
+private:
+    struct Interval
+    {
+        BoundingBox box;
+        size_t polygonId;
+    };
+
+    /// Intervals sorted by the minimum x coordinate of their boxes
+    std::vector<Interval> intervals;
+    std::vector<PolygonPair> candidatePairs;
+    std::vector<PolygonPair> intersectingPairs;
+    BroadPhaseTimings timings;
+};
+
+#endif
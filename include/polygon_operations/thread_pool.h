@@ -0,0 +1,73 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*!
+ * Pool of worker threads executing batches of indexed tasks with work stealing.
+ * The tasks of a batch are split into contiguous ranges, one per worker. Every worker
+ * executes the tasks of its own range from the front and, when it runs out of tasks,
+ * steals the back half of the range of another worker. Callers should therefore create
+ * tasks of similar cost and several times more tasks than threads.
+ * A pool executes one batch at a time: Run must not be called concurrently from several threads,
+ * nor re-entrantly from inside a task, which would deadlock waiting for its own workers.
+ */
+class WorkStealingThreadPool
+{
+public:
+    /// Construct a pool with the given number of threads (0 means one per hardware thread)
+    explicit WorkStealingThreadPool(size_t threadsNumber = 0);
+
+    ~WorkStealingThreadPool();
+
+    WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&) = delete;
+
+    /// Number of worker threads
+    size_t ThreadsNumber() const { return workers.size(); }
+
+    /*!
+     * Executes the tasks 0, ..., tasksNumber-1 and returns when all of them are completed.
+     * If tasks throw, the tasks not started yet on any worker are skipped, and the first exception is
+     * rethrown once the tasks already running are completed.
+     * \param tasksNumber Number of tasks
+     * \param task Function called with the task id and the id of the executing thread (0 to ThreadsNumber()-1)
+     */
+    void Run(size_t tasksNumber, const std::function<void(size_t taskId, size_t threadId)>& task);
+
+private:
+    /// Range of task ids still to be executed by a worker
+    struct TaskRange
+    {
+        std::mutex mutex;
+        size_t begin = 0;
+        size_t end = 0;
+    };
+
+    void WorkerLoop(size_t threadId);
+
+    /// Take the next task of a worker, stealing from the other workers when its range is empty
+    bool NextTask(size_t threadId, size_t& taskId);
+
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<TaskRange>> ranges;
+
+    std::mutex mutex;
+    std::condition_variable batchStarted;
+    std::condition_variable batchFinished;
+    const std::function<void(size_t, size_t)>* currentTask = nullptr;
+    size_t batch = 0;
+    size_t runningWorkers = 0;
+    bool stopping = false;
+    std::atomic<bool> cancelled{false};
+    std::exception_ptr firstException;
+};
+
+#endif
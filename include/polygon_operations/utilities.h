@@ -3,7 +3,8 @@
 
 #include <vector>
 #include <stack>
-#include <algorithm>    // std::reverse
+#include <algorithm>
+#include <utility>      // std::pair
 
 /*!
  * Class representing a 2D point
@@ -14,10 +15,10 @@ struct Point
     double y;
 
     /// Unique constructor for 2D point
-    Point(double X, double Y): x(X), y(Y) {}
+    constexpr Point(double X, double Y): x(X), y(Y) {}
 
     /// Equality operator for two points
-    bool operator==(const Point& p2) const {return (x == p2.x && y == p2.y);}
+    constexpr bool operator==(const Point& p2) const {return (x == p2.x && y == p2.y);}
 
 };
 
@@ -40,14 +41,49 @@ struct Vector: public Point
     double operator*(const Vector &p2) {return x*p2.x + y*p2.y;}
 };
 
+/*!
+ * Axis-aligned bounding box
+ */
+struct BoundingBox
+{
+    double minX;
+    double minY;
+    double maxX;
+    double maxY;
+
+    /// Whether two boxes overlap (touching boxes are considered overlapping)
+    bool Overlaps(const BoundingBox& other) const
+    {
+        return (minX <= other.maxX) && (other.minX <= maxX) && (minY <= other.maxY) && (other.minY <= maxY);
+    }
+};
+
+/// Pair of polygon indices, with the lower index first
+typedef std::pair<size_t, size_t> PolygonPair;
+
+/*!
+ * Predicate deciding the orientation of three points. Fast evaluates the determinant in plain
+ * double arithmetic, whose sign may be wrong for nearly collinear points, while Adaptive gives
+ * the exact sign with orient2d_adaptive at a small extra cost. MixedPrecision also gives the exact
+ * sign, evaluating the determinant in float with a certified error bound first, which doubles the
+ * lanes of the batched tests of orient2d_signs (see predicates.h).
+ */
+enum class OrientationPredicate { Fast, Adaptive, MixedPrecision };
+
 /// Function that computes the Euclidean distance between two points
 double EuclideanDistance(const Point& p1, const Point& p2);
 
 /// Function that computes the Euclidean distance between two points
 double DotProduct(const Point& p1, const Point& p2);
 
+/// Function that computes the axis-aligned bounding box of a non-empty set of points
+BoundingBox ComputeBoundingBox(const std::vector<Point>& points);
+
 /// Function that checks if the given points are all collinear
-bool CheckPointsCollinear(const std::vector<Point> points);
+bool CheckPointsCollinear(const std::vector<Point>& points, OrientationPredicate predicate = OrientationPredicate::Fast);
+
+/// Function that checks if the given points are all collinear, viewing them without copying
+bool CheckPointsCollinear(const Point* points, size_t pointsNumber, OrientationPredicate predicate = OrientationPredicate::Fast);
 
 /*!
  * Find the orientation of the ordered triplet (P, Q, R).
@@ -57,9 +93,10 @@ bool CheckPointsCollinear(const std::vector<Point> points);
  * \param  P  The first point considered
  * \param  Q  The second point considered
  * \param  R  The second point considered
+ * \param  predicate The predicate deciding the orientation
  * \return Integer indicating the rotation order of the points
  */
-int ThreePointOrientation(const Point &P, const Point &Q, const Point &R);
+int ThreePointOrientation(const Point &P, const Point &Q, const Point &R, OrientationPredicate predicate = OrientationPredicate::Fast);
 
 /*!
  * Comparison function indicating whether the three points are rotated counterclowise.
@@ -67,41 +104,50 @@ int ThreePointOrientation(const Point &P, const Point &Q, const Point &R);
  * \param  P  The first point considered
  * \param  Q  The second point considered
  * \param  R  The third point considered
+ * \param  predicate The predicate deciding the orientation
  * \return Boolean: True when P,Q,R are rotated counterclockwise
 */
-bool CompareOrientation(const Point& P, const Point& Q, const Point& R);
+bool CompareOrientation(const Point& P, const Point& Q, const Point& R, OrientationPredicate predicate = OrientationPredicate::Fast);
 
 /*!
  * Find whether a point is on the right of a vector formed by two points.
  * \param  tail The tail of the vector
  * \param  Qhead The head of the vector
  * \param  examinedPoint The point that needs to be check
+ * \param  predicate The predicate deciding the orientation
  * \return Boolean: True when R point is strictly on the right of the PQ edge
 */
-bool IsPointRightToTheEdge(const Point &tail, const Point &head, const Point &examinedPoint);
+bool IsPointRightToTheEdge(const Point &tail, const Point &head, const Point &examinedPoint,
+                           OrientationPredicate predicate = OrientationPredicate::Fast);
 
+/// Copy of a stack into a vector starting from the top of the stack
 template<class T> 
-std::vector<T> StackToVectorFromTop(std::stack<T> stackToCopy)
+std::vector<T> StackToVectorFromTop(const std::stack<T>& stackToCopy)
 {
+    std::stack<T> stack = stackToCopy;
     std::vector<T> vectorFromStack;
-    const auto stackSize = stackToCopy.size();
-    vectorFromStack.reserve(stackSize);
-
-    for (size_t iter = 0; iter < stackSize; ++iter)
+    vectorFromStack.reserve(stack.size());
+    while (!stack.empty())
     {
-        vectorFromStack.emplace_back(stackToCopy.top());
-        stackToCopy.pop();
+        vectorFromStack.emplace_back(stack.top());
+        stack.pop();
     }
-
     return vectorFromStack;
 }
 
+/// Copy of a stack into a vector starting from the bottom of the stack
 template<class T> 
-std::vector<T> StackToVectorFromBottom(std::stack<T> stackToCopy)
+std::vector<T> StackToVectorFromBottom(const std::stack<T>& stackToCopy)
 {
     std::vector<T> vectorFromStack = StackToVectorFromTop(stackToCopy);
     std::reverse(vectorFromStack.begin(), vectorFromStack.end());
     return vectorFromStack;
 }
 
+/// Copy of a stack of points into a vector starting from the top of the stack, reading the stack without popping a copy of it
+std::vector<Point> StackToVectorFromTop(const std::stack<Point>& stackToCopy);
+
+/// Copy of a stack of points into a vector starting from the bottom of the stack, reading the stack without popping a copy of it
+std::vector<Point> StackToVectorFromBottom(const std::stack<Point>& stackToCopy);
+
 #endif
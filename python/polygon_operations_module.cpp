@@ -0,0 +1,556 @@
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include "polygon_operations/convex_hull.h"
+#include "polygon_operations/convex_polygon.h"
+#include "polygon_operations/polygon_metrics.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+// An (n, 2) C-contiguous float64 array is viewed as an array of points without copying
+static_assert(sizeof(Point) == 2 * sizeof(double) && std::is_standard_layout<Point>::value,
+              "Point must have the layout of two doubles");
+
+namespace Python
+{
+    /// Number of columns of the metrics: area, centroid x, centroid y, perimeter, momentXX, momentYY, momentXY
+    const Py_ssize_t metricsColumns = 7;
+
+    /// numpy.asarray, or nullptr when NumPy is not installed
+    PyObject* numpyAsarray = nullptr;
+
+    /*!
+     * Array returned to Python, owning a buffer of float64 or bool exported through the buffer
+     * protocol, so that numpy.asarray wraps it without copying
+     */
+    struct ArrayObject
+    {
+        PyObject_HEAD
+        char* data;
+        const char* format;
+        Py_ssize_t itemSize;
+        int dimensions;
+        Py_ssize_t shape[2];
+        Py_ssize_t strides[2];
+    };
+
+    /// Type of the arrays, value-initialized so that every slot is null until PyInit_polygon_operations sets it
+    PyTypeObject ArrayType = {};
+
+    void ArrayDealloc(PyObject* self)
+    {
+        PyMem_RawFree(reinterpret_cast<ArrayObject*>(self)->data);
+        Py_TYPE(self)->tp_free(self);
+    }
+
+    int ArrayGetBuffer(PyObject* self, Py_buffer* view, int flags)
+    {
+        ArrayObject* array = reinterpret_cast<ArrayObject*>(self);
+        view->buf = array->data;
+        view->obj = self;
+        Py_INCREF(self);
+        view->len = array->itemSize * array->shape[0] * ((array->dimensions == 2) ? array->shape[1] : 1);
+        view->readonly = 0;
+        view->itemsize = array->itemSize;
+        view->format = (flags & PyBUF_FORMAT) ? const_cast<char*>(array->format) : nullptr;
+        view->ndim = array->dimensions;
+        view->shape = array->shape;
+        view->strides = array->strides;
+        view->suboffsets = nullptr;
+        view->internal = nullptr;
+        return 0;
+    }
+
+    PyBufferProcs ArrayBufferProcs = {ArrayGetBuffer, nullptr};
+
+    /*!
+     * Allocates a C-contiguous array of rows x columns items, or of rows items when columns is 0
+     * \return The array, or nullptr with a Python exception set
+     */
+    ArrayObject* NewArray(const char* format, Py_ssize_t itemSize, Py_ssize_t rows, Py_ssize_t columns)
+    {
+        ArrayObject* array = PyObject_New(ArrayObject, &ArrayType);
+        if (array == nullptr)
+            return nullptr;
+
+        const Py_ssize_t items = rows * ((columns == 0) ? 1 : columns);
+        // Allocate at least one item, since malloc(0) may return nullptr
+        array->data = static_cast<char*>(PyMem_RawMalloc(std::max<Py_ssize_t>(items, 1) * itemSize));
+        array->format = format;
+        array->itemSize = itemSize;
+        array->dimensions = (columns == 0) ? 1 : 2;
+        array->shape[0] = rows;
+        array->shape[1] = columns;
+        array->strides[0] = ((columns == 0) ? 1 : columns) * itemSize;
+        array->strides[1] = itemSize;
+        if (array->data == nullptr)
+        {
+            Py_DECREF(array);
+            PyErr_NoMemory();
+            return nullptr;
+        }
+        return array;
+    }
+
+    /// Converts an array to a NumPy array sharing its buffer when NumPy is installed
+    PyObject* WrapArray(ArrayObject* array)
+    {
+        if ((array == nullptr) || (numpyAsarray == nullptr))
+            return reinterpret_cast<PyObject*>(array);
+
+        PyObject* wrapped = PyObject_CallOneArg(numpyAsarray, reinterpret_cast<PyObject*>(array));
+        Py_DECREF(array);
+        return wrapped;
+    }
+
+    /// Format character of a buffer, without the native byte order prefixes
+    char FormatCode(const char* format)
+    {
+        if (format == nullptr)
+            return 'B';
+        if ((*format == '@') || (*format == '='))
+            ++format;
+#if PY_LITTLE_ENDIAN
+        if (*format == '<')
+            ++format;
+#else
+        if ((*format == '>') || (*format == '!'))
+            ++format;
+#endif
+        return ((format[0] != '\0') && (format[1] == '\0')) ? format[0] : '\0';
+    }
+
+    /*!
+     * Buffer of an object exporting the buffer protocol, e.g. a NumPy array, released on destruction
+     */
+    class Buffer
+    {
+    public:
+        Buffer(): buffer(), acquired(false) {}
+        ~Buffer()
+        {
+            if (acquired)
+                PyBuffer_Release(&buffer);
+        }
+
+        Buffer(const Buffer&) = delete;
+        Buffer& operator=(const Buffer&) = delete;
+
+        /// Acquires the C-contiguous buffer of an object, or returns false with a Python exception set
+        bool Acquire(PyObject* object, const char* name)
+        {
+            if (PyObject_GetBuffer(object, &buffer, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0)
+            {
+                PyErr_Format(PyExc_TypeError, "%s must be a C-contiguous array, e.g. numpy.ascontiguousarray(%s)", name, name);
+                return false;
+            }
+            acquired = true;
+            return true;
+        }
+
+        const Py_buffer& Get() const {return buffer;}
+
+    private:
+        Py_buffer buffer;
+        bool acquired;
+    };
+
+    /*!
+     * Points of an (n, 2) float64 or float32 array. The float64 arrays are viewed in place, while
+     * the float32 arrays are converted to double, which the kernels use, without holding the GIL.
+     */
+    class PointsView
+    {
+    public:
+        PointsView(): buffer(), pointsNumber(0), isFloat(false), converted() {}
+
+        /// Acquires the points of an object, or returns false with a Python exception set
+        bool Acquire(PyObject* object, const char* name)
+        {
+            if (!buffer.Acquire(object, name))
+                return false;
+
+            const Py_buffer& view = buffer.Get();
+            const char code = FormatCode(view.format);
+            if (((code != 'd') && (code != 'f')) || (view.ndim != 2) || (view.shape[1] != 2))
+            {
+                PyErr_Format(PyExc_TypeError, "%s must be an (n, 2) array of float64 or float32", name);
+                return false;
+            }
+            pointsNumber = static_cast<size_t>(view.shape[0]);
+            isFloat = (code == 'f');
+            return true;
+        }
+
+        /// Number of points
+        size_t Size() const {return pointsNumber;}
+
+        /// Pointer to the points, converting the float32 arrays on the first call
+        const Point* Data()
+        {
+            if (!isFloat)
+                return static_cast<const Point*>(buffer.Get().buf);
+
+            if (converted.size() != pointsNumber)
+            {
+                const float* values = static_cast<const float*>(buffer.Get().buf);
+                converted.reserve(pointsNumber);
+                for (size_t pointId = 0; pointId < pointsNumber; ++pointId)
+                    converted.emplace_back(values[2 * pointId], values[2 * pointId + 1]);
+            }
+            return converted.data();
+        }
+
+    private:
+        Buffer buffer;
+        size_t pointsNumber;
+        bool isFloat;
+        std::vector<Point> converted;
+    };
+
+    /*!
+     * Offsets of polygons packed in compressed sparse row (CSR) form, as in PolygonBatch: polygon i
+     * has the vertices from offsets[i] to offsets[i + 1]. The int64 arrays are viewed in place.
+     */
+    class OffsetsView
+    {
+    public:
+        OffsetsView(): buffer(), offsets(nullptr), offsetsNumber(0), converted() {}
+
+        /// Acquires and validates the offsets of an object, or returns false with a Python exception set
+        bool Acquire(PyObject* object, const char* name, size_t verticesNumber)
+        {
+            if (!buffer.Acquire(object, name))
+                return false;
+
+            const Py_buffer& view = buffer.Get();
+            const char code = FormatCode(view.format);
+            if ((view.ndim != 1) || (view.shape[0] < 1) || !std::strchr("qQlLiI", code) || (code == '\0'))
+            {
+                PyErr_Format(PyExc_TypeError, "%s must be a non-empty 1D array of int64 or int32", name);
+                return false;
+            }
+
+            offsetsNumber = static_cast<size_t>(view.shape[0]);
+            if (view.itemsize == sizeof(int64_t))
+            {
+                offsets = static_cast<const int64_t*>(view.buf);
+            }
+            else
+            {
+                const bool isSigned = (code == 'i') || (code == 'l');
+                converted.resize(offsetsNumber);
+                for (size_t offsetId = 0; offsetId < offsetsNumber; ++offsetId)
+                {
+                    converted[offsetId] = isSigned ? static_cast<const int32_t*>(view.buf)[offsetId]
+                                                   : static_cast<const uint32_t*>(view.buf)[offsetId];
+                }
+                offsets = converted.data();
+            }
+
+            for (size_t offsetId = 0; offsetId < offsetsNumber; ++offsetId)
+            {
+                const bool decreasing = (offsetId > 0) && (offsets[offsetId] < offsets[offsetId - 1]);
+                if ((offsets[offsetId] < 0) || decreasing || (static_cast<uint64_t>(offsets[offsetId]) > verticesNumber))
+                {
+                    PyErr_Format(PyExc_ValueError, "%s must be non-decreasing offsets inside the vertices", name);
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// Number of polygons
+        size_t Size() const {return offsetsNumber - 1;}
+
+        /// First vertex of a polygon
+        size_t Begin(size_t polygonId) const {return static_cast<size_t>(offsets[polygonId]);}
+
+        /// Number of vertices of a polygon
+        size_t PolygonSize(size_t polygonId) const {return static_cast<size_t>(offsets[polygonId + 1] - offsets[polygonId]);}
+
+    private:
+        Buffer buffer;
+        const int64_t* offsets;
+        size_t offsetsNumber;
+        std::vector<int64_t> converted;
+    };
+
+    /// Parses the name of an orientation predicate, or returns false with a Python exception set
+    bool ParsePredicate(const char* name, OrientationPredicate& predicate)
+    {
+        if (std::strcmp(name, "fast") == 0)
+            predicate = OrientationPredicate::Fast;
+        else if (std::strcmp(name, "adaptive") == 0)
+            predicate = OrientationPredicate::Adaptive;
+        else if (std::strcmp(name, "mixed_precision") == 0)
+            predicate = OrientationPredicate::MixedPrecision;
+        else
+        {
+            PyErr_Format(PyExc_ValueError, "Unknown predicate '%s', expected 'fast', 'adaptive' or 'mixed_precision'", name);
+            return false;
+        }
+        return true;
+    }
+
+    /*!
+     * Runs a computation without holding the GIL, so that other Python threads run meanwhile.
+     * The exceptions of the library are turned into Python exceptions once the GIL is taken again.
+     * \return Whether the computation succeeded, otherwise a Python exception is set
+     */
+    template<class Function>
+    bool RunWithoutGil(Function function)
+    {
+        PyObject* exceptionType = nullptr;
+        std::string message;
+        Py_BEGIN_ALLOW_THREADS
+        try
+        {
+            function();
+        }
+        catch (const std::invalid_argument& exception)
+        {
+            exceptionType = PyExc_ValueError;
+            message = exception.what();
+        }
+        catch (const std::bad_alloc&)
+        {
+            exceptionType = PyExc_MemoryError;
+        }
+        catch (const std::exception& exception)
+        {
+            exceptionType = PyExc_RuntimeError;
+            message = exception.what();
+        }
+        Py_END_ALLOW_THREADS
+
+        if (exceptionType != nullptr)
+            PyErr_SetString(exceptionType, message.c_str());
+        return exceptionType == nullptr;
+    }
+
+    PyObject* ConvexHull(PyObject*, PyObject* args, PyObject* kwargs)
+    {
+        static const char* keywords[] = {"points", "predicate", nullptr};
+        PyObject* pointsObject = nullptr;
+        const char* predicateName = "fast";
+        if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|s", const_cast<char**>(keywords), &pointsObject, &predicateName))
+            return nullptr;
+
+        OrientationPredicate predicate = OrientationPredicate::Fast;
+        PointsView points;
+        if (!ParsePredicate(predicateName, predicate) || !points.Acquire(pointsObject, "points"))
+            return nullptr;
+
+        // The hull has at most as many vertices as points, so the output buffer doubles as the scratch of the scan
+        ArrayObject* hull = NewArray("d", sizeof(double), static_cast<Py_ssize_t>(points.Size()), 2);
+        if (hull == nullptr)
+            return nullptr;
+
+        size_t hullSize = 0;
+        if (!RunWithoutGil([&]() {
+                hullSize = convex_hull_from_points(points.Data(), points.Size(), reinterpret_cast<Point*>(hull->data), predicate);
+            }))
+        {
+            Py_DECREF(hull);
+            return nullptr;
+        }
+        hull->shape[0] = static_cast<Py_ssize_t>(hullSize);
+        return WrapArray(hull);
+    }
+
+    PyObject* PointsInPolygon(PyObject*, PyObject* args, PyObject* kwargs)
+    {
+        static const char* keywords[] = {"points", "polygon", "predicate", nullptr};
+        PyObject* pointsObject = nullptr;
+        PyObject* polygonObject = nullptr;
+        const char* predicateName = "mixed_precision";
+        if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|s", const_cast<char**>(keywords), &pointsObject, &polygonObject, &predicateName))
+            return nullptr;
+
+        OrientationPredicate predicate = OrientationPredicate::MixedPrecision;
+        PointsView points;
+        PointsView polygon;
+        if (!ParsePredicate(predicateName, predicate) || !points.Acquire(pointsObject, "points") || !polygon.Acquire(polygonObject, "polygon"))
+            return nullptr;
+
+        ArrayObject* inside = NewArray("?", sizeof(bool), static_cast<Py_ssize_t>(points.Size()), 0);
+        if (inside == nullptr)
+            return nullptr;
+
+        if (!RunWithoutGil([&]() {
+                points_are_in_polygon(points.Data(), points.Size(), polygon.Data(), polygon.Size(),
+                                      reinterpret_cast<bool*>(inside->data), predicate);
+            }))
+        {
+            Py_DECREF(inside);
+            return nullptr;
+        }
+        return WrapArray(inside);
+    }
+
+    PyObject* DoIntersectBatch(PyObject*, PyObject* args, PyObject* kwargs)
+    {
+        static const char* keywords[] = {"vertices1", "offsets1", "vertices2", "offsets2", nullptr};
+        PyObject* vertices1Object = nullptr;
+        PyObject* offsets1Object = nullptr;
+        PyObject* vertices2Object = nullptr;
+        PyObject* offsets2Object = nullptr;
+        if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO", const_cast<char**>(keywords),
+                                         &vertices1Object, &offsets1Object, &vertices2Object, &offsets2Object))
+            return nullptr;
+
+        PointsView vertices1;
+        PointsView vertices2;
+        OffsetsView offsets1;
+        OffsetsView offsets2;
+        if (!vertices1.Acquire(vertices1Object, "vertices1") || !vertices2.Acquire(vertices2Object, "vertices2") ||
+            !offsets1.Acquire(offsets1Object, "offsets1", vertices1.Size()) || !offsets2.Acquire(offsets2Object, "offsets2", vertices2.Size()))
+            return nullptr;
+
+        // A single polygon in the second batch is tested against every polygon of the first one
+        const size_t polygonsNumber = offsets1.Size();
+        const bool broadcast = (offsets2.Size() == 1);
+        if (!broadcast && (offsets2.Size() != polygonsNumber))
+        {
+            PyErr_SetString(PyExc_ValueError, "The batches must have the same number of polygons, or the second one a single polygon");
+            return nullptr;
+        }
+
+        ArrayObject* intersecting = NewArray("?", sizeof(bool), static_cast<Py_ssize_t>(polygonsNumber), 0);
+        if (intersecting == nullptr)
+            return nullptr;
+
+        if (!RunWithoutGil([&]() {
+                const Point* polygons1 = vertices1.Data();
+                const Point* polygons2 = vertices2.Data();
+                bool* results = reinterpret_cast<bool*>(intersecting->data);
+                for (size_t polygonId = 0; polygonId < polygonsNumber; ++polygonId)
+                {
+                    const size_t otherId = broadcast ? 0 : polygonId;
+                    results[polygonId] = do_intersect(polygons1 + offsets1.Begin(polygonId), offsets1.PolygonSize(polygonId),
+                                                      polygons2 + offsets2.Begin(otherId), offsets2.PolygonSize(otherId));
+                }
+            }))
+        {
+            Py_DECREF(intersecting);
+            return nullptr;
+        }
+        return WrapArray(intersecting);
+    }
+
+    PyObject* PolygonMetricsBatch(PyObject*, PyObject* args, PyObject* kwargs)
+    {
+        static const char* keywords[] = {"vertices", "offsets", nullptr};
+        PyObject* verticesObject = nullptr;
+        PyObject* offsetsObject = nullptr;
+        if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO", const_cast<char**>(keywords), &verticesObject, &offsetsObject))
+            return nullptr;
+
+        PointsView vertices;
+        OffsetsView offsets;
+        if (!vertices.Acquire(verticesObject, "vertices") || !offsets.Acquire(offsetsObject, "offsets", vertices.Size()))
+            return nullptr;
+
+        ArrayObject* metrics = NewArray("d", sizeof(double), static_cast<Py_ssize_t>(offsets.Size()), metricsColumns);
+        if (metrics == nullptr)
+            return nullptr;
+
+        if (!RunWithoutGil([&]() {
+                const Point* polygons = vertices.Data();
+                double* row = reinterpret_cast<double*>(metrics->data);
+                for (size_t polygonId = 0; polygonId < offsets.Size(); ++polygonId, row += metricsColumns)
+                {
+                    const PolygonMetrics polygonMetrics = polygon_metrics(polygons + offsets.Begin(polygonId), offsets.PolygonSize(polygonId));
+                    row[0] = polygonMetrics.area;
+                    row[1] = polygonMetrics.centroid.x;
+                    row[2] = polygonMetrics.centroid.y;
+                    row[3] = polygonMetrics.perimeter;
+                    row[4] = polygonMetrics.momentXX;
+                    row[5] = polygonMetrics.momentYY;
+                    row[6] = polygonMetrics.momentXY;
+                }
+            }))
+        {
+            Py_DECREF(metrics);
+            return nullptr;
+        }
+        return WrapArray(metrics);
+    }
+
+    PyMethodDef methods[] = {
+        {"convex_hull", reinterpret_cast<PyCFunction>(reinterpret_cast<void(*)(void)>(ConvexHull)), METH_VARARGS | METH_KEYWORDS,
+         "convex_hull(points, predicate='fast')\n--\n\n"
+         "Convex hull of an (n, 2) array of points, as an (k, 2) float64 array of the vertices moving\n"
+         "counterclockwise from the lowest one. The predicate is 'fast', 'adaptive' or 'mixed_precision'."},
+        {"points_in_polygon", reinterpret_cast<PyCFunction>(reinterpret_cast<void(*)(void)>(PointsInPolygon)), METH_VARARGS | METH_KEYWORDS,
+         "points_in_polygon(points, polygon, predicate='mixed_precision')\n--\n\n"
+         "Whether each point of an (n, 2) array lies inside a convex polygon given as an (m, 2) array of\n"
+         "vertices moving counterclockwise, as an (n,) bool array. Points on the boundary are inside."},
+        {"do_intersect_batch", reinterpret_cast<PyCFunction>(reinterpret_cast<void(*)(void)>(DoIntersectBatch)), METH_VARARGS | METH_KEYWORDS,
+         "do_intersect_batch(vertices1, offsets1, vertices2, offsets2)\n--\n\n"
+         "Whether polygon i of the first batch intersects polygon i of the second one, or the single polygon\n"
+         "of the second batch, as a bool array. A batch is an (n, 2) array of the vertices of all the convex\n"
+         "polygons moving counterclockwise and the offsets where every polygon starts, followed by n."},
+        {"polygon_metrics_batch", reinterpret_cast<PyCFunction>(reinterpret_cast<void(*)(void)>(PolygonMetricsBatch)), METH_VARARGS | METH_KEYWORDS,
+         "polygon_metrics_batch(vertices, offsets)\n--\n\n"
+         "Metrics of a batch of polygons as a (p, 7) float64 array with the columns area, centroid x,\n"
+         "centroid y, perimeter, momentXX, momentYY and momentXY."},
+        {nullptr, nullptr, 0, nullptr}
+    };
+
+    PyModuleDef module = {
+        PyModuleDef_HEAD_INIT,
+        "polygon_operations",
+        "Operations with convex polygons over arrays of points, e.g. NumPy arrays, viewed without copying.\n"
+        "The computations release the GIL, so Python threads can run queries in parallel.",
+        -1,
+        methods,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr
+    };
+}
+
+PyMODINIT_FUNC PyInit_polygon_operations()
+{
+    const PyVarObject head = {PyObject_HEAD_INIT(nullptr) 0};
+    Python::ArrayType.ob_base = head;
+    Python::ArrayType.tp_name = "polygon_operations.Array";
+    Python::ArrayType.tp_basicsize = sizeof(Python::ArrayObject);
+    Python::ArrayType.tp_dealloc = Python::ArrayDealloc;
+    Python::ArrayType.tp_as_buffer = &Python::ArrayBufferProcs;
+    Python::ArrayType.tp_flags = Py_TPFLAGS_DEFAULT;
+    Python::ArrayType.tp_doc = "Array exporting its buffer, e.g. to numpy.asarray";
+    if (PyType_Ready(&Python::ArrayType) < 0)
+        return nullptr;
+
+    PyObject* module = PyModule_Create(&Python::module);
+    if (module == nullptr)
+        return nullptr;
+
+    Py_INCREF(&Python::ArrayType);
+    if (PyModule_AddObject(module, "Array", reinterpret_cast<PyObject*>(&Python::ArrayType)) < 0)
+    {
+        Py_DECREF(&Python::ArrayType);
+        Py_DECREF(module);
+        return nullptr;
+    }
+
+    // The results are returned as NumPy arrays when NumPy is installed
+    PyObject* numpy = PyImport_ImportModule("numpy");
+    if (numpy != nullptr)
+    {
+        Python::numpyAsarray = PyObject_GetAttrString(numpy, "asarray");
+        Py_DECREF(numpy);
+    }
+    PyErr_Clear();
+
+    return module;
+}
@@ -0,0 +1,152 @@
+#include "polygon_operations/arena.h"
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace Arena
+{
+    /// Size of the huge pages the chunks are rounded to
+    const size_t hugePageSize = size_t(2) << 20;
+
+    bool UseHugePages(const ArenaOptions& options)
+    {
+#if defined(__linux__)
+        return options.hugePages;
+#else
+        return false;
+#endif
+    }
+
+    /// Size of the chunk requested from the system for a request of at least the given size
+    size_t ChunkSize(const ArenaOptions& options, size_t minimumSize)
+    {
+        const size_t size = std::max(options.chunkSize, minimumSize);
+        if (UseHugePages(options))
+            return (size + hugePageSize - 1) / hugePageSize * hugePageSize;
+        return size;
+    }
+}
+
+MonotonicArena::MonotonicArena(const ArenaOptions& options): options(options), chunks(), currentChunk(0), offset(0)
+{
+}
+
+MonotonicArena::~MonotonicArena()
+{
+    for (const Chunk& chunk : chunks)
+        FreeChunk(chunk);
+}
+
+void MonotonicArena::Reset()
+{
+    currentChunk = 0;
+    offset = 0;
+    ReleaseOversizeChunks(0);
+}
+
+void MonotonicArena::Rewind(const Marker& marker)
+{
+    currentChunk = marker.chunk;
+    offset = marker.offset;
+    // The first chunk is still in use unless the marker is at its beginning
+    if (currentChunk == 0)
+        ReleaseOversizeChunks((offset == 0) ? 0 : 1);
+}
+
+size_t MonotonicArena::BytesReserved() const
+{
+    size_t bytes = 0;
+    for (const Chunk& chunk : chunks)
+        bytes += chunk.size;
+    return bytes;
+}
+
+size_t MonotonicArena::BytesUsed() const
+{
+    size_t bytes = offset;
+    for (size_t chunkId = 0; (chunkId < currentChunk) && (chunkId < chunks.size()); ++chunkId)
+        bytes += chunks[chunkId].size;
+    return bytes;
+}
+
+MonotonicArena::Chunk MonotonicArena::AllocateChunk(size_t minimumSize) const
+{
+    const size_t size = Arena::ChunkSize(options, minimumSize);
+#if defined(__linux__)
+    if (Arena::UseHugePages(options))
+    {
+        void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED)
+            throw std::bad_alloc();
+        // Only a hint: the kernel falls back to normal pages when huge pages are unavailable
+        madvise(memory, size, MADV_HUGEPAGE);
+        return {static_cast<char*>(memory), size};
+    }
+#endif
+    return {static_cast<char*>(::operator new(size)), size};
+}
+
+void MonotonicArena::FreeChunk(const Chunk& chunk) const
+{
+#if defined(__linux__)
+    if (Arena::UseHugePages(options))
+    {
+        munmap(chunk.memory, chunk.size);
+        return;
+    }
+#endif
+    ::operator delete(chunk.memory);
+}
+
+void MonotonicArena::ReleaseOversizeChunks(size_t firstChunk)
+{
+    const size_t regularSize = Arena::ChunkSize(options, options.chunkSize);
+    size_t keptChunks = firstChunk;
+    for (size_t chunkId = firstChunk; chunkId < chunks.size(); ++chunkId)
+    {
+        if (chunks[chunkId].size > regularSize)
+            FreeChunk(chunks[chunkId]);
+        else
+            chunks[keptChunks++] = chunks[chunkId];
+    }
+    chunks.resize(keptChunks, {nullptr, 0});
+}
+
+void* MonotonicArena::do_allocate(size_t bytes, size_t alignment)
+{
+    while (true)
+    {
+        if (currentChunk < chunks.size())
+        {
+            const Chunk& chunk = chunks[currentChunk];
+            const uintptr_t base = reinterpret_cast<uintptr_t>(chunk.memory);
+            const size_t aligned = ((base + offset + alignment - 1) & ~(uintptr_t(alignment) - 1)) - base;
+            if ((aligned <= chunk.size) && (bytes <= chunk.size - aligned))
+            {
+                offset = aligned + bytes;
+                return chunk.memory + aligned;
+            }
+            // The chunks after the current one are reused after a reset, skipping the ones that are too small
+            if (currentChunk + 1 < chunks.size())
+            {
+                ++currentChunk;
+                offset = 0;
+                continue;
+            }
+        }
+
+        chunks.push_back(AllocateChunk(bytes + alignment));
+        currentChunk = chunks.size() - 1;
+        offset = 0;
+    }
+}
+
+MonotonicArena& thread_local_arena()
+{
+    thread_local MonotonicArena arena;
+    return arena;
+}
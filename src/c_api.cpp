@@ -0,0 +1,188 @@
+#include "polygon_operations/c_api.h"
+#include "polygon_operations/convex_hull.h"
+#include "polygon_operations/convex_polygon.h"
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+// The arrays of doubles are viewed as arrays of points without copying
+static_assert(sizeof(Point) == 2 * sizeof(double) && std::is_standard_layout<Point>::value,
+              "Point must have the layout of two doubles");
+static_assert(sizeof(bool) == sizeof(uint8_t), "bool must have the size of a byte");
+
+namespace CApi
+{
+    /// Message of the last error of every thread
+    std::string& LastErrorMessage()
+    {
+        thread_local std::string message;
+        return message;
+    }
+
+    /// Fails with an invalid argument
+    po_status InvalidArgument(const char* message)
+    {
+        LastErrorMessage() = message;
+        return PO_INVALID_ARGUMENT;
+    }
+
+    /*!
+     * Runs a function of the library, turning its exceptions into status codes
+     * \return PO_OK, or the status of the exception
+     */
+    template<class Function>
+    po_status Guard(Function function) noexcept
+    {
+        try
+        {
+            LastErrorMessage().clear();
+            function();
+            return PO_OK;
+        }
+        catch (const std::invalid_argument& exception)
+        {
+            LastErrorMessage() = exception.what();
+            return PO_INVALID_ARGUMENT;
+        }
+        catch (const std::bad_alloc&)
+        {
+            LastErrorMessage() = "Out of memory";
+            return PO_OUT_OF_MEMORY;
+        }
+        catch (const std::exception& exception)
+        {
+            LastErrorMessage() = exception.what();
+            return PO_INTERNAL_ERROR;
+        }
+        catch (...)
+        {
+            LastErrorMessage() = "Unknown error";
+            return PO_INTERNAL_ERROR;
+        }
+    }
+
+    /// Whether a predicate of the C ABI is valid
+    bool IsValid(po_predicate predicate)
+    {
+        return (predicate == PO_PREDICATE_FAST) || (predicate == PO_PREDICATE_ADAPTIVE) || (predicate == PO_PREDICATE_MIXED_PRECISION);
+    }
+
+    OrientationPredicate ToPredicate(po_predicate predicate)
+    {
+        switch (predicate)
+        {
+            case PO_PREDICATE_ADAPTIVE:
+                return OrientationPredicate::Adaptive;
+            case PO_PREDICATE_MIXED_PRECISION:
+                return OrientationPredicate::MixedPrecision;
+            default:
+                return OrientationPredicate::Fast;
+        }
+    }
+
+    /// Whether the offsets of a batch are non-decreasing starting from 0
+    bool OffsetsAreValid(const uint64_t* offsets, size_t itemsNumber)
+    {
+        if (offsets[0] != 0)
+            return false;
+        for (size_t itemId = 0; itemId < itemsNumber; ++itemId)
+        {
+            if (offsets[itemId + 1] < offsets[itemId])
+                return false;
+        }
+        return true;
+    }
+
+    const Point* ToPoints(const double* coordinates)
+    {
+        return reinterpret_cast<const Point*>(coordinates);
+    }
+
+    Point* ToPoints(double* coordinates)
+    {
+        return reinterpret_cast<Point*>(coordinates);
+    }
+}
+
+int po_abi_version(void)
+{
+    return PO_ABI_VERSION;
+}
+
+const char* po_last_error_message(void)
+{
+    return CApi::LastErrorMessage().c_str();
+}
+
+po_status po_convex_hull(const double* points, size_t pointsNumber, po_predicate predicate, double* hull, size_t* hullSize)
+{
+    if ((points == nullptr) || (hull == nullptr) || (hullSize == nullptr))
+        return CApi::InvalidArgument("Attempted to compute a convex hull with a null pointer");
+    if (!CApi::IsValid(predicate))
+        return CApi::InvalidArgument("Attempted to compute a convex hull with an unknown predicate");
+
+    return CApi::Guard([&]() {
+        *hullSize = convex_hull_from_points(CApi::ToPoints(points), pointsNumber, CApi::ToPoints(hull), CApi::ToPredicate(predicate));
+    });
+}
+
+po_status po_convex_hulls(const double* points, const uint64_t* offsets, size_t setsNumber, po_predicate predicate,
+                          double* hulls, uint64_t* hullOffsets)
+{
+    if ((offsets == nullptr) || (hullOffsets == nullptr) || ((setsNumber > 0) && ((points == nullptr) || (hulls == nullptr))))
+        return CApi::InvalidArgument("Attempted to compute convex hulls with a null pointer");
+    if (!CApi::IsValid(predicate))
+        return CApi::InvalidArgument("Attempted to compute convex hulls with an unknown predicate");
+    if (!CApi::OffsetsAreValid(offsets, setsNumber))
+        return CApi::InvalidArgument("Attempted to compute convex hulls with offsets that are not non-decreasing from 0");
+
+    return CApi::Guard([&]() {
+        hullOffsets[0] = 0;
+        for (size_t setId = 0; setId < setsNumber; ++setId)
+        {
+            const size_t hullSize = convex_hull_from_points(CApi::ToPoints(points) + offsets[setId], offsets[setId + 1] - offsets[setId],
+                                                            CApi::ToPoints(hulls) + hullOffsets[setId], CApi::ToPredicate(predicate));
+            hullOffsets[setId + 1] = hullOffsets[setId] + hullSize;
+        }
+    });
+}
+
+po_status po_points_in_polygon(const double* points, size_t pointsNumber, const double* polygon, size_t polygonSize,
+                               po_predicate predicate, uint8_t* inside)
+{
+    if ((polygon == nullptr) || ((pointsNumber > 0) && ((points == nullptr) || (inside == nullptr))))
+        return CApi::InvalidArgument("Attempted to test points against a polygon with a null pointer");
+    if (!CApi::IsValid(predicate))
+        return CApi::InvalidArgument("Attempted to test points against a polygon with an unknown predicate");
+
+    return CApi::Guard([&]() {
+        points_are_in_polygon(CApi::ToPoints(points), pointsNumber, CApi::ToPoints(polygon), polygonSize,
+                              reinterpret_cast<bool*>(inside), CApi::ToPredicate(predicate));
+    });
+}
+
+po_status po_do_intersect_pairs(const double* vertices, const uint64_t* offsets, size_t polygonsNumber,
+                                const uint64_t* pairs, size_t pairsNumber, uint8_t* intersecting)
+{
+    if ((offsets == nullptr) || ((pairsNumber > 0) && ((vertices == nullptr) || (pairs == nullptr) || (intersecting == nullptr))))
+        return CApi::InvalidArgument("Attempted to intersect pairs of polygons with a null pointer");
+    if (!CApi::OffsetsAreValid(offsets, polygonsNumber))
+        return CApi::InvalidArgument("Attempted to intersect pairs of polygons with offsets that are not non-decreasing from 0");
+    for (size_t pairId = 0; pairId < 2 * pairsNumber; ++pairId)
+    {
+        if (pairs[pairId] >= polygonsNumber)
+            return CApi::InvalidArgument("Attempted to intersect a pair of polygons with an index out of range");
+    }
+
+    return CApi::Guard([&]() {
+        const Point* polygons = CApi::ToPoints(vertices);
+        for (size_t pairId = 0; pairId < pairsNumber; ++pairId)
+        {
+            const uint64_t polygon1 = pairs[2 * pairId];
+            const uint64_t polygon2 = pairs[2 * pairId + 1];
+            intersecting[pairId] = do_intersect(polygons + offsets[polygon1], offsets[polygon1 + 1] - offsets[polygon1],
+                                                polygons + offsets[polygon2], offsets[polygon2 + 1] - offsets[polygon2]);
+        }
+    });
+}
@@ -0,0 +1,226 @@
+#include "polygon_operations/clipping.h"
+#include "polygon_operations/arena.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace Clipping
+{
+    /// Number of tasks created per thread by the batch variant
+    const size_t tasksPerThread = 16;
+
+    /*!
+     * Largest number of vertices written by one pass for any polygon, convex or not. Every kept vertex
+     * adds at most one crossing and a crossing needs a vertex outside before it, so a polygon whose
+     * vertices alternate between the sides of the line gives inputSize + inputSize / 2 vertices,
+     * while a convex one gives at most inputSize + 1 (unless rounding makes its signs alternate).
+     */
+    size_t PassCapacity(size_t inputSize)
+    {
+        return inputSize + inputSize / 2 + 1;
+    }
+
+    /// Largest number of vertices of the intermediate and final results of clipping against a rectangle
+    size_t RectangleCapacity(size_t polygonSize)
+    {
+        return PassCapacity(PassCapacity(PassCapacity(PassCapacity(polygonSize))));
+    }
+
+    /*!
+     * One Sutherland-Hodgman pass, keeping the vertices with a non-positive signed distance from the
+     * clipping line and adding the crossings of the edges with a strict change of sign
+     * \param input The vertices of the polygon
+     * \param inputSize Number of vertices of the polygon
+     * \param output Buffer receiving the vertices, which must not overlap the input
+     * \param outputCapacity Number of points of the output buffer, never exceeded when at least PassCapacity(inputSize)
+     * \param distance Function returning the signed distance of a point, positive outside
+     * \param crossing Function returning the crossing of an edge from its tail, head and parameter
+     * \return Number of vertices written to the output
+     */
+    template<typename SignedDistance, typename Crossing>
+    size_t ClipPass(const Point* input, size_t inputSize, Point* output, size_t outputCapacity, SignedDistance distance, Crossing crossing)
+    {
+        if (inputSize == 0)
+            return 0;
+
+        size_t count = 0;
+        const Point* previous = &input[inputSize - 1];
+        double previousDistance = distance(*previous);
+        for (size_t vertexId = 0; vertexId < inputSize; ++vertexId)
+        {
+            const Point& current = input[vertexId];
+            const double currentDistance = distance(current);
+            const bool crosses = ((previousDistance < 0.0) && (currentDistance > 0.0)) || ((previousDistance > 0.0) && (currentDistance < 0.0));
+            const bool kept = (currentDistance <= 0.0);
+            if (count + crosses + kept > outputCapacity)
+                throw std::invalid_argument("Attempted to clip a polygon crossing the line more than twice into a too small buffer");
+
+            if (crosses)
+                output[count++] = crossing(*previous, current, previousDistance / (previousDistance - currentDistance));
+            if (kept)
+                output[count++] = current;
+
+            previous = &current;
+            previousDistance = currentDistance;
+        }
+        return count;
+    }
+
+    /// Crossing with a vertical line, placed exactly on it
+    Point VerticalCrossing(const Point& tail, const Point& head, double t, double x)
+    {
+        return Point(x, tail.y + t * (head.y - tail.y));
+    }
+
+    /// Crossing with a horizontal line, placed exactly on it
+    Point HorizontalCrossing(const Point& tail, const Point& head, double t, double y)
+    {
+        return Point(tail.x + t * (head.x - tail.x), y);
+    }
+
+    /*!
+     * Clips a polygon against a rectangle, ping-ponging between the output and a scratch buffer
+     * of at least RectangleCapacity(polygonSize) points each
+     * \return Number of vertices written to the output, 0 when fewer than 3 are left
+     */
+    size_t ClipToRectangle(const Point* polygon, size_t polygonSize, const BoundingBox& rectangle, Point* output, Point* scratch)
+    {
+        const size_t capacity = RectangleCapacity(polygonSize);
+        size_t count = ClipPass(polygon, polygonSize, scratch, capacity,
+                                [&](const Point& p) { return rectangle.minX - p.x; },
+                                [&](const Point& tail, const Point& head, double t) { return VerticalCrossing(tail, head, t, rectangle.minX); });
+        count = ClipPass(scratch, count, output, capacity,
+                         [&](const Point& p) { return p.x - rectangle.maxX; },
+                         [&](const Point& tail, const Point& head, double t) { return VerticalCrossing(tail, head, t, rectangle.maxX); });
+        count = ClipPass(output, count, scratch, capacity,
+                         [&](const Point& p) { return rectangle.minY - p.y; },
+                         [&](const Point& tail, const Point& head, double t) { return HorizontalCrossing(tail, head, t, rectangle.minY); });
+        count = ClipPass(scratch, count, output, capacity,
+                         [&](const Point& p) { return p.y - rectangle.maxY; },
+                         [&](const Point& tail, const Point& head, double t) { return HorizontalCrossing(tail, head, t, rectangle.maxY); });
+
+        return (count < 3) ? 0 : count;
+    }
+
+    /// Bounding box of a non-empty array of points
+    BoundingBox ArrayBoundingBox(const Point* points, size_t pointsNumber)
+    {
+        BoundingBox box{points[0].x, points[0].y, points[0].x, points[0].y};
+        for (size_t pointId = 1; pointId < pointsNumber; ++pointId)
+        {
+            box.minX = std::min(box.minX, points[pointId].x);
+            box.minY = std::min(box.minY, points[pointId].y);
+            box.maxX = std::max(box.maxX, points[pointId].x);
+            box.maxY = std::max(box.maxY, points[pointId].y);
+        }
+        return box;
+    }
+
+    bool Contains(const BoundingBox& outer, const BoundingBox& inner)
+    {
+        return (outer.minX <= inner.minX) && (inner.maxX <= outer.maxX) && (outer.minY <= inner.minY) && (inner.maxY <= outer.maxY);
+    }
+}
+
+size_t clip_convex_polygon(const Point* polygon, size_t polygonSize, const Vector& normal, double offset, Point* clipped)
+{
+    const size_t count = Clipping::ClipPass(polygon, polygonSize, clipped, polygonSize + 1,
+                                            [&](const Point& p) { return DotProduct(normal, p) - offset; },
+                                            [](const Point& tail, const Point& head, double t) {
+                                                return Point(tail.x + t * (head.x - tail.x), tail.y + t * (head.y - tail.y));
+                                            });
+    return (count < 3) ? 0 : count;
+}
+
+std::vector<Point> clip_convex_polygon(const std::vector<Point>& polygon, const Vector& normal, double offset)
+{
+    std::vector<Point> clipped(Clipping::PassCapacity(polygon.size()), Point(0.0, 0.0));
+    const size_t count = Clipping::ClipPass(polygon.data(), polygon.size(), clipped.data(), clipped.size(),
+                                            [&](const Point& p) { return DotProduct(normal, p) - offset; },
+                                            [](const Point& tail, const Point& head, double t) {
+                                                return Point(tail.x + t * (head.x - tail.x), tail.y + t * (head.y - tail.y));
+                                            });
+    clipped.resize((count < 3) ? 0 : count, Point(0.0, 0.0));
+    return clipped;
+}
+
+std::vector<Point> clip_convex_polygon(const std::vector<Point>& polygon, const BoundingBox& rectangle)
+{
+    std::vector<Point> clipped(Clipping::RectangleCapacity(polygon.size()), Point(0.0, 0.0));
+    ArenaScope scope;
+    std::pmr::vector<Point> scratch(clipped.size(), Point(0.0, 0.0), scope.Resource());
+    clipped.resize(Clipping::ClipToRectangle(polygon.data(), polygon.size(), rectangle, clipped.data(), scratch.data()), Point(0.0, 0.0));
+    return clipped;
+}
+
+PolygonBatch clip_convex_polygons(const PolygonBatch& polygons, const BoundingBox& rectangle, WorkStealingThreadPool& pool)
+{
+    const size_t polygonsNumber = polygons.Size();
+    PolygonBatch clipped(polygons.Resource());
+    clipped.offsets.assign(polygonsNumber + 1, 0);
+    if (polygonsNumber == 0)
+        return clipped;
+
+    // First pass: clip the polygons crossing the sides into the buffer of their task
+    const size_t tasksNumber = std::min(polygonsNumber, pool.ThreadsNumber() * Clipping::tasksPerThread);
+    std::vector<std::vector<Point>> taskVertices(tasksNumber);
+    std::vector<std::vector<Point>> threadScratch(pool.ThreadsNumber());
+    std::vector<char> passThrough(polygonsNumber, 0);
+    pool.Run(tasksNumber, [&](size_t task, size_t threadId) {
+        std::vector<Point>& vertices = taskVertices[task];
+        std::vector<Point>& scratch = threadScratch[threadId];
+        const size_t lastPolygon = polygonsNumber * (task + 1) / tasksNumber;
+        for (size_t polygonId = polygonsNumber * task / tasksNumber; polygonId < lastPolygon; ++polygonId)
+        {
+            const Point* polygon = polygons.Polygon(polygonId);
+            const size_t polygonSize = polygons.PolygonSize(polygonId);
+            if (polygonSize == 0)
+                continue;
+
+            const BoundingBox box = Clipping::ArrayBoundingBox(polygon, polygonSize);
+            if (Clipping::Contains(rectangle, box))
+            {
+                passThrough[polygonId] = 1;
+                clipped.offsets[polygonId + 1] = polygonSize;
+                continue;
+            }
+            if (!rectangle.Overlaps(box))
+                continue;
+
+            const size_t start = vertices.size();
+            // Sized for any polygon, so that a non-convex entry or rounding near a side cannot overflow
+            const size_t capacity = Clipping::RectangleCapacity(polygonSize);
+            vertices.resize(start + capacity, Point(0.0, 0.0));
+            scratch.resize(std::max(scratch.size(), capacity), Point(0.0, 0.0));
+            const size_t count = Clipping::ClipToRectangle(polygon, polygonSize, rectangle, vertices.data() + start, scratch.data());
+            vertices.resize(start + count, Point(0.0, 0.0));
+            clipped.offsets[polygonId + 1] = count;
+        }
+    });
+
+    // The sizes stored after every polygon become the offsets
+    for (size_t polygonId = 0; polygonId < polygonsNumber; ++polygonId)
+        clipped.offsets[polygonId + 1] += clipped.offsets[polygonId];
+
+    // Second pass: gather the clipped polygons and copy the polygons inside in one block
+    clipped.vertices.resize(clipped.offsets.back(), Point(0.0, 0.0));
+    pool.Run(tasksNumber, [&](size_t task, size_t) {
+        const Point* clippedVertex = taskVertices[task].data();
+        const size_t lastPolygon = polygonsNumber * (task + 1) / tasksNumber;
+        for (size_t polygonId = polygonsNumber * task / tasksNumber; polygonId < lastPolygon; ++polygonId)
+        {
+            Point* destination = clipped.vertices.data() + clipped.offsets[polygonId];
+            const size_t count = clipped.PolygonSize(polygonId);
+            if (passThrough[polygonId])
+            {
+                std::copy(polygons.Polygon(polygonId), polygons.Polygon(polygonId) + count, destination);
+            }
+            else
+            {
+                std::copy(clippedVertex, clippedVertex + count, destination);
+                clippedVertex += count;
+            }
+        }
+    });
+
+    return clipped;
+}
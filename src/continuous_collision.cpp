@@ -0,0 +1,164 @@
+#include "polygon_operations/continuous_collision.h"
+#include "polygon_operations/gjk.h"
+#include "polygon_operations/sat_kernel.h"
+#include <cmath>
+#include <stdexcept>
+
+namespace ContinuousCollision
+{
+    /// Number of tasks created per thread by the batch variant
+    const size_t tasksPerThread = 16;
+
+    /// Largest distance of a vertex from the rotation center, bounding the speed of the vertices due to the rotation
+    double RotationRadius(const std::vector<Point>& polygon, const PolygonMotion& motion)
+    {
+        if (motion.angularVelocity == 0.0)
+            return 0.0;
+
+        double squaredRadius = 0.0;
+        for (const auto& vertex : polygon)
+        {
+            const Vector arm(motion.rotationCenter, vertex);
+            squaredRadius = std::max(squaredRadius, DotProduct(arm, arm));
+        }
+        return std::sqrt(squaredRadius);
+    }
+
+    /// Writes the vertices of a polygon at a given time into a buffer of the same size
+    void PolygonAtTime(const std::vector<Point>& polygon, const PolygonMotion& motion, double time, std::vector<Point>& moved)
+    {
+        const double cosine = std::cos(motion.angularVelocity * time);
+        const double sine = std::sin(motion.angularVelocity * time);
+        const double centerX = motion.rotationCenter.x + motion.linearVelocity.x * time;
+        const double centerY = motion.rotationCenter.y + motion.linearVelocity.y * time;
+        for (size_t vertexId = 0; vertexId < polygon.size(); ++vertexId)
+        {
+            const double armX = polygon[vertexId].x - motion.rotationCenter.x;
+            const double armY = polygon[vertexId].y - motion.rotationCenter.y;
+            moved[vertexId] = Point(centerX + cosine * armX - sine * armY, centerY + sine * armX + cosine * armY);
+        }
+    }
+
+    /*!
+     * Conservative advancement reusing the buffers of the moved polygons, so that batches of queries
+     * do not allocate once the buffers are large enough
+     */
+    TimeOfImpact Advance(const std::vector<Point>& polygon1, const PolygonMotion& motion1,
+                         const std::vector<Point>& polygon2, const PolygonMotion& motion2,
+                         double duration, double distanceTolerance, size_t maximumIterations,
+                         std::vector<Point>& moved1, std::vector<Point>& moved2)
+    {
+        if ((polygon1.size() < 3) || (polygon2.size() < 3))
+            throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
+        if (maximumIterations == 0)
+            throw std::invalid_argument("Attempted to compute a time of impact with no advancement steps");
+
+        moved1.assign(polygon1.begin(), polygon1.end());
+        moved2.assign(polygon2.begin(), polygon2.end());
+        const double rotationSpeedBound = std::fabs(motion1.angularVelocity) * RotationRadius(polygon1, motion1) +
+                                          std::fabs(motion2.angularVelocity) * RotationRadius(polygon2, motion2);
+        const Vector relativeVelocity(motion1.linearVelocity.x - motion2.linearVelocity.x,
+                                      motion1.linearVelocity.y - motion2.linearVelocity.y);
+
+        TimeOfImpact impact;
+        GJKCache cache;
+        double time = 0.0;
+        while (true)
+        {
+            ++impact.iterations;
+            const GJKResult result = gjk_query(moved1, moved2, cache);
+
+            if (result.intersect && (time == 0.0))
+            {
+                // Initial overlap, the first polygon leaves along its minimum translation vector
+                MinimumTranslation translation;
+                sat_minimum_translation(moved1.data(), moved1.size(), moved2.data(), moved2.size(), translation);
+                impact.hit = true;
+                impact.time = 0.0;
+                impact.normal = Vector(-translation.direction.x, -translation.direction.y);
+                return impact;
+            }
+
+            if (result.intersect || (result.distance <= distanceTolerance))
+            {
+                // The normal of the previous step is kept when the witness points coincide
+                if (result.distance > 0.0)
+                    impact.normal = Vector((result.witness2.x - result.witness1.x) / result.distance,
+                                           (result.witness2.y - result.witness1.y) / result.distance);
+                impact.hit = true;
+                impact.time = time;
+                return impact;
+            }
+
+            impact.normal = Vector((result.witness2.x - result.witness1.x) / result.distance,
+                                   (result.witness2.y - result.witness1.y) / result.distance);
+            const double approachSpeedBound = DotProduct(relativeVelocity, impact.normal) + rotationSpeedBound;
+            if (approachSpeedBound <= 0.0)
+                break;
+
+            const double nextTime = time + result.distance / approachSpeedBound;
+            if (nextTime > duration)
+                break;
+
+            if (impact.iterations == maximumIterations)
+            {
+                // Out of steps, the polygons are only known to be apart until now
+                impact.hit = true;
+                impact.time = time;
+                impact.converged = false;
+                return impact;
+            }
+
+            time = nextTime;
+            PolygonAtTime(polygon1, motion1, time, moved1);
+            PolygonAtTime(polygon2, motion2, time, moved2);
+        }
+
+        impact.hit = false;
+        impact.time = duration;
+        impact.normal = Vector(0.0, 0.0);
+        return impact;
+    }
+}
+
+TimeOfImpact time_of_impact(const std::vector<Point>& polygon1, const PolygonMotion& motion1,
+                            const std::vector<Point>& polygon2, const PolygonMotion& motion2,
+                            double duration, double distanceTolerance, size_t maximumIterations)
+{
+    std::vector<Point> moved1 = {};
+    std::vector<Point> moved2 = {};
+    return ContinuousCollision::Advance(polygon1, motion1, polygon2, motion2, duration, distanceTolerance,
+                                        maximumIterations, moved1, moved2);
+}
+
+std::vector<TimeOfImpact> time_of_impact_batch(const std::vector<std::vector<Point>>& polygons,
+                                               const std::vector<PolygonMotion>& motions,
+                                               const std::vector<PolygonPair>& candidatePairs,
+                                               double duration, WorkStealingThreadPool& pool,
+                                               double distanceTolerance, size_t maximumIterations)
+{
+    if (motions.size() != polygons.size())
+        throw std::invalid_argument("Attempted to compute times of impact with a different number of motions");
+
+    std::vector<TimeOfImpact> impacts(candidatePairs.size());
+    if (candidatePairs.empty())
+        return impacts;
+
+    // Every thread keeps the buffers of its moved polygons across its tasks
+    std::vector<std::vector<Point>> threadMoved1(pool.ThreadsNumber());
+    std::vector<std::vector<Point>> threadMoved2(pool.ThreadsNumber());
+    const size_t tasksNumber = std::min(candidatePairs.size(), pool.ThreadsNumber() * ContinuousCollision::tasksPerThread);
+    pool.Run(tasksNumber, [&](size_t task, size_t threadId) {
+        const size_t lastPair = candidatePairs.size() * (task + 1) / tasksNumber;
+        for (size_t pairId = candidatePairs.size() * task / tasksNumber; pairId < lastPair; ++pairId)
+        {
+            const PolygonPair& pair = candidatePairs[pairId];
+            impacts[pairId] = ContinuousCollision::Advance(polygons[pair.first], motions[pair.first],
+                                                           polygons[pair.second], motions[pair.second],
+                                                           duration, distanceTolerance, maximumIterations,
+                                                           threadMoved1[threadId], threadMoved2[threadId]);
+        }
+    });
+
+    return impacts;
+}
@@ -0,0 +1,295 @@
+#include "polygon_operations/convex_distance.h"
+#include "polygon_operations/convex_polygon.h"
+#include "polygon_operations/gjk.h"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace Distance
+{
+    double Cross(const Point& a, const Point& b)
+    {
+        return a.x * b.y - a.y * b.x;
+    }
+
+    /// Index of the lowest vertex, with the lowest x among the lowest vertices
+    size_t BottomVertex(const Point* polygon, size_t polygonSize)
+    {
+        size_t bottom = 0;
+        for (size_t vertexId = 1; vertexId < polygonSize; ++vertexId)
+        {
+            if ((polygon[vertexId].y < polygon[bottom].y) ||
+                ((polygon[vertexId].y == polygon[bottom].y) && (polygon[vertexId].x < polygon[bottom].x)))
+                bottom = vertexId;
+        }
+        return bottom;
+    }
+
+    /// Index of the highest vertex, with the highest x among the highest vertices, i.e. the bottom vertex of the reflected polygon
+    size_t TopVertex(const Point* polygon, size_t polygonSize)
+    {
+        size_t top = 0;
+        for (size_t vertexId = 1; vertexId < polygonSize; ++vertexId)
+        {
+            if ((polygon[vertexId].y > polygon[top].y) ||
+                ((polygon[vertexId].y == polygon[top].y) && (polygon[vertexId].x > polygon[top].x)))
+                top = vertexId;
+        }
+        return top;
+    }
+
+    /*!
+     * Rotates the calipers around the two polygons, visiting the edges of the Minkowski difference
+     * polygon1 - polygon2 counterclockwise. The edge from tail1 - tail2 to head1 - head2 is passed to
+     * the visitor, where one of the two polygons stays at a vertex (tail == head) while the other
+     * one advances along an edge, or both advance along parallel edges.
+     * \return false when the visitor stopped the rotation by returning false
+     */
+    template<typename Visitor>
+    bool RotateCalipers(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size, Visitor visit)
+    {
+        if ((polygon1Size < 3) || (polygon2Size < 3))
+            throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
+
+        // The caliper of the first polygon starts below it and the one of the second polygon above it
+        const size_t start1 = BottomVertex(polygon1, polygon1Size);
+        const size_t start2 = TopVertex(polygon2, polygon2Size);
+        size_t i = 0;
+        size_t j = 0;
+        while ((i < polygon1Size) || (j < polygon2Size))
+        {
+            size_t nextI = i;
+            size_t nextJ = j;
+            if (i == polygon1Size)
+                ++nextJ;
+            else if (j == polygon2Size)
+                ++nextI;
+            else
+            {
+                // Rotate by the smaller angle, to the edge of the first polygon or the reversed edge of the second one
+                const Vector edge1(polygon1[(start1 + i) % polygon1Size], polygon1[(start1 + i + 1) % polygon1Size]);
+                const Vector edge2(polygon2[(start2 + j + 1) % polygon2Size], polygon2[(start2 + j) % polygon2Size]);
+                const double cross = Cross(edge1, edge2);
+                if (cross >= 0.0)
+                    ++nextI;
+                if (cross <= 0.0)
+                    ++nextJ;
+            }
+
+            if (!visit(polygon1[(start1 + i) % polygon1Size], polygon1[(start1 + nextI) % polygon1Size],
+                       polygon2[(start2 + j) % polygon2Size], polygon2[(start2 + nextJ) % polygon2Size]))
+                return false;
+
+            i = nextI;
+            j = nextJ;
+        }
+        return true;
+    }
+
+    /// Parameter of the point of the segment from a to b closest to the origin
+    double ClosestParameter(const Point& a, const Point& b)
+    {
+        const Vector edge(a, b);
+        const double squaredLength = DotProduct(edge, edge);
+        if (squaredLength == 0.0)
+            return 0.0;
+        return std::min(1.0, std::max(0.0, -DotProduct(a, edge) / squaredLength));
+    }
+
+    Point Interpolate(const Point& tail, const Point& head, double t)
+    {
+        return Point(tail.x + t * (head.x - tail.x), tail.y + t * (head.y - tail.y));
+    }
+
+    /// Keeps the closer of the current witness points and the closest points of a point and a segment
+    void UpdateClosest(const Point& point, const Point& tail, const Point& head, bool pointOnFirst,
+                       double& squaredDistance, PolygonDistance& closest)
+    {
+        const Point a(tail.x - point.x, tail.y - point.y);
+        const Point b(head.x - point.x, head.y - point.y);
+        const Point onSegment = Interpolate(tail, head, ClosestParameter(a, b));
+        const double candidate = DotProduct(Vector(point, onSegment), Vector(point, onSegment));
+        if (candidate < squaredDistance)
+        {
+            squaredDistance = candidate;
+            closest.witness1 = pointOnFirst ? point : onSegment;
+            closest.witness2 = pointOnFirst ? onSegment : point;
+        }
+    }
+
+    /*!
+     * Binary searches the edge normals of polygon1 for the maximum separation of the polygons, where the
+     * separation along a normal is the projection of polygon2 minus the one of polygon1.
+     * The separation is concave over the arc of directions where it is positive, which contains
+     * separatingDirection, and outside of the arc the position of the normal relative to
+     * separatingDirection tells on which side of the maximum it lies.
+     * \return Index of the edge whose normal gives the maximum separation among the edge normals
+     */
+    size_t MaximumSeparationEdge(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2,
+                                 const Vector& separatingDirection)
+    {
+        const size_t n = polygon1.size();
+        size_t hint = 0;
+        auto outwardNormal = [&](size_t edgeId) {
+            const Vector edge(polygon1[edgeId], polygon1[(edgeId + 1) % n]);
+            return Vector(edge.y, -edge.x);
+        };
+        auto separation = [&](size_t edgeId) {
+            const Vector normal = outwardNormal(edgeId);
+            hint = extreme_vertex_index(polygon2, Vector(-normal.x, -normal.y), hint);
+            return DotProduct(Vector(polygon1[edgeId], polygon2[hint]), normal) / std::sqrt(DotProduct(normal, normal));
+        };
+        auto beforeSeparatingDirection = [&](size_t edgeId) {
+            const Vector normal = outwardNormal(edgeId);
+            const double cross = Cross(separatingDirection, normal);
+            return (cross < 0.0) || ((cross == 0.0) && (DotProduct(separatingDirection, normal) < 0.0));
+        };
+
+        // The normals sorted by angle from the opposite of the separating direction
+        const size_t start = extreme_vertex_index(polygon1, Vector(-separatingDirection.x, -separatingDirection.y));
+        // Whether the maximum lies after the normal of the edge at the given position
+        auto maximumIsAfter = [&](size_t position) {
+            const size_t edgeId = (start + position) % n;
+            const double current = separation(edgeId);
+            if (current <= 0.0)
+                return beforeSeparatingDirection(edgeId);
+            if (position + 1 == n)
+                return false;
+            const double next = separation((edgeId + 1) % n);
+            return (next > 0.0) && (next > current);
+        };
+
+        size_t first = 0;
+        size_t last = n - 1;
+        while (first < last)
+        {
+            const size_t middle = (first + last) / 2;
+            if (maximumIsAfter(middle))
+                first = middle + 1;
+            else
+                last = middle;
+        }
+        return (start + first) % n;
+    }
+}
+
+PolygonDistance convex_polygon_distance(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size)
+{
+    double minimumSquaredDistance = std::numeric_limits<double>::infinity();
+    bool originInside = true;
+    PolygonDistance closest;
+    Distance::RotateCalipers(polygon1, polygon1Size, polygon2, polygon2Size,
+                             [&](const Point& tail1, const Point& head1, const Point& tail2, const Point& head2) {
+        const Point a(tail1.x - tail2.x, tail1.y - tail2.y);
+        const Point b(head1.x - head2.x, head1.y - head2.y);
+        // The origin lies on the outer side of an edge of the difference when the polygons are disjoint
+        originInside = originInside && (Distance::Cross(a, b) >= 0.0);
+
+        const double t = Distance::ClosestParameter(a, b);
+        const Point point = Distance::Interpolate(a, b, t);
+        const double squaredDistance = DotProduct(point, point);
+        if (squaredDistance < minimumSquaredDistance)
+        {
+            minimumSquaredDistance = squaredDistance;
+            closest.witness1 = Distance::Interpolate(tail1, head1, t);
+            closest.witness2 = Distance::Interpolate(tail2, head2, t);
+        }
+        return true;
+    });
+
+    closest.distance = originInside ? 0.0 : std::sqrt(minimumSquaredDistance);
+    return closest;
+}
+
+PolygonDistance convex_polygon_distance(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2)
+{
+    return convex_polygon_distance(polygon1.data(), polygon1.size(), polygon2.data(), polygon2.size());
+}
+
+PolygonDistance convex_polygon_distance_logarithmic(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2)
+{
+    if ((polygon1.size() < 3) || (polygon2.size() < 3))
+        throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
+
+    PolygonDistance closest;
+    const GJKResult result = gjk_query(polygon1, polygon2);
+    if (result.intersect)
+    {
+        closest.witness1 = result.witness1;
+        closest.witness2 = result.witness1;
+        return closest;
+    }
+
+    // The direction of the GJK witness points separates the polygons unless they are nearly touching
+    const Vector separatingDirection(result.witness1, result.witness2);
+    const double separation =
+        DotProduct(polygon2[extreme_vertex_index(polygon2, Vector(-separatingDirection.x, -separatingDirection.y))], separatingDirection) -
+        DotProduct(polygon1[extreme_vertex_index(polygon1, separatingDirection)], separatingDirection);
+    if (separation <= 0.0)
+        return convex_polygon_distance(polygon1, polygon2);
+
+    const size_t edge1 = Distance::MaximumSeparationEdge(polygon1, polygon2, separatingDirection);
+    const size_t edge2 = Distance::MaximumSeparationEdge(polygon2, polygon1, Vector(-separatingDirection.x, -separatingDirection.y));
+
+    // The closest features lie on the edges around the maxima of both polygons
+    const size_t n = polygon1.size();
+    const size_t m = polygon2.size();
+    double minimumSquaredDistance = std::numeric_limits<double>::infinity();
+    for (size_t offset1 = 0; offset1 < 3; ++offset1)
+    {
+        const Point& tail1 = polygon1[(edge1 + n - 1 + offset1) % n];
+        const Point& head1 = polygon1[(edge1 + offset1) % n];
+        for (size_t offset2 = 0; offset2 < 3; ++offset2)
+        {
+            const Point& tail2 = polygon2[(edge2 + m - 1 + offset2) % m];
+            const Point& head2 = polygon2[(edge2 + offset2) % m];
+            Distance::UpdateClosest(tail1, tail2, head2, true, minimumSquaredDistance, closest);
+            Distance::UpdateClosest(head1, tail2, head2, true, minimumSquaredDistance, closest);
+            Distance::UpdateClosest(tail2, tail1, head1, false, minimumSquaredDistance, closest);
+            Distance::UpdateClosest(head2, tail1, head1, false, minimumSquaredDistance, closest);
+        }
+    }
+
+    closest.distance = std::sqrt(minimumSquaredDistance);
+    return closest;
+}
+
+bool convex_polygons_closer_than(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size,
+                                 double threshold)
+{
+    if ((polygon1Size < 3) || (polygon2Size < 3))
+        throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
+    if (threshold <= 0.0)
+        return false;
+
+    const double squaredThreshold = threshold * threshold;
+    bool closer = false;
+    bool originInside = true;
+    const bool completed = Distance::RotateCalipers(polygon1, polygon1Size, polygon2, polygon2Size,
+                                                    [&](const Point& tail1, const Point& head1, const Point& tail2, const Point& head2) {
+        const Point a(tail1.x - tail2.x, tail1.y - tail2.y);
+        const Point b(head1.x - head2.x, head1.y - head2.y);
+        const Point point = Distance::Interpolate(a, b, Distance::ClosestParameter(a, b));
+        if (DotProduct(point, point) < squaredThreshold)
+        {
+            closer = true;
+            return false;
+        }
+
+        // The line of the edge separates the origin from the difference by at least the threshold
+        const double cross = Distance::Cross(a, b);
+        const Vector edge(a, b);
+        if ((cross < 0.0) && (cross * cross >= squaredThreshold * DotProduct(edge, edge)))
+            return false;
+
+        originInside = originInside && (cross >= 0.0);
+        return true;
+    });
+
+    return completed ? originInside : closer;
+}
+
+bool convex_polygons_closer_than(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2, double threshold)
+{
+    return convex_polygons_closer_than(polygon1.data(), polygon1.size(), polygon2.data(), polygon2.size(), threshold);
+}
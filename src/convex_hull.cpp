@@ -1,63 +1,180 @@
 #include "polygon_operations/convex_hull.h"
-#include <functional>
+#include "polygon_operations/predicates.h"
 #include <algorithm>
 #include <stdexcept>
 
-// Pass by value in order to sort the vector later
-std::stack<Point> convex_hull_from_points(std::vector<Point> points)
+namespace Hull
 {
-    // It is not possible to compute a convex hull with less than 3 points
-    if (points.size() < 3)
-        throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
-
-    // Check if all points are collinear
-    bool allCollinear = CheckPointsCollinear(points);
-    if (allCollinear)
-        throw std::invalid_argument("Attempted to define a convex polygon when all points all collinear");
-
-    // Find the points with the lowest and the highest y value: O(n) complexity
-    // If more than one points have the lowest y value, then select the point with the lowest x value
-    Point lowestPoint = points[0];
-    int lowestDistanceFromBegin = 0;
-    for (auto point = points.begin(); point != points.end(); ++point)
+    /*!
+     * Removes the points lying strictly inside the quadrilateral of the lowest, rightmost, highest
+     * and leftmost points (Akl-Toussaint heuristic), which cannot be vertices of the convex hull.
+     * The batched orientation tests of the mixed precision predicate give exact signs, so the points
+     * on the boundary of the quadrilateral are kept. The scratch buffers come from the thread arena.
+     * \return The number of points kept at the beginning of the array
+     */
+    size_t CullInteriorPoints(Point* points, size_t pointsNumber)
     {
-        if ((lowestPoint.y > point->y) || (lowestPoint.y == point->y && lowestPoint.x > point->x))
+        size_t lowest = 0, rightmost = 0, highest = 0, leftmost = 0;
+        for (size_t pointId = 1; pointId < pointsNumber; ++pointId)
         {
-            lowestPoint = *point;
-            lowestDistanceFromBegin = std::distance(points.begin(), point);
+            if (points[pointId].y < points[lowest].y)
+                lowest = pointId;
+            if (points[pointId].x > points[rightmost].x)
+                rightmost = pointId;
+            if (points[pointId].y > points[highest].y)
+                highest = pointId;
+            if (points[pointId].x < points[leftmost].x)
+                leftmost = pointId;
         }
+
+        ArenaScope scope;
+        // Corners moving counterclockwise, without repetitions
+        std::pmr::vector<Point> corners(scope.Resource());
+        for (size_t corner : {lowest, rightmost, highest, leftmost})
+        {
+            if (corners.empty() || !(corners.back() == points[corner]))
+                corners.push_back(points[corner]);
+        }
+        if (corners.size() > 1 && corners.front() == corners.back())
+            corners.pop_back();
+        if (corners.size() < 3)
+            return pointsNumber;
+
+        std::pmr::vector<signed char> signs(pointsNumber, 0, scope.Resource());
+        std::pmr::vector<char> interior(pointsNumber, 1, scope.Resource());
+        for (size_t cornerId = 0; cornerId < corners.size(); ++cornerId)
+        {
+            const Point& tail = corners[cornerId];
+            const Point& head = corners[(cornerId + 1 == corners.size()) ? 0 : cornerId + 1];
+            orient2d_signs(tail, head, points, pointsNumber, signs.data(), OrientationPredicate::MixedPrecision);
+            for (size_t pointId = 0; pointId < pointsNumber; ++pointId)
+                interior[pointId] &= static_cast<char>(signs[pointId] > 0);
+        }
+
+        size_t kept = 0;
+        for (size_t pointId = 0; pointId < pointsNumber; ++pointId)
+        {
+            if (!interior[pointId])
+                points[kept++] = points[pointId];
+        }
+        return kept;
     }
-    // Erase the lowestPoint
-    points.erase(points.begin()+lowestDistanceFromBegin);
-
-    // Function that compares the polar angle with respect to the lowest point
-    auto compareWithLowestPoint =  std::bind(CompareOrientation, lowestPoint, std::placeholders::_1, std::placeholders::_2);
-    
-    // Sort the remaining points by their polar angle: O(nlogn) complexity
-    std::sort(points.begin(), points.end(), compareWithLowestPoint);
-
-    // Stack containing the convex hull, where the points are oriented counter-clockwise
-    std::stack<Point> convexHull = {};
-
-    convexHull.push(lowestPoint);
-    convexHull.push(points[0]);
-    convexHull.push(points[1]);
-
-    // Rearrange the points inside the stack: O(n) complexity
-    for (size_t pointId = 2; pointId < points.size(); ++pointId) {
-        Point top = convexHull.top();
-        convexHull.pop();
-
-        // Keep removing the top element of the stack while the angle formed by
-        // next-on-top, top and point-in-question makes a non-counterclockwise turn
-        while (ThreePointOrientation(convexHull.top(), top, points[pointId]) != 2)
+
+    /*!
+     * Sort and scan of the Graham scan, instantiated for every predicate so that the orientation
+     * tests are inlined into the comparator of the sort and into the scan, where the exact
+     * predicates are mostly certified by the static error bound of the bounding box of the points
+     * \return The number of vertices of the hull
+     */
+    template<OrientationPredicate predicate>
+    size_t SortAndScan(Point* points, size_t pointsNumber)
+    {
+        // Find the points with the lowest and the highest y value: O(n) complexity
+        // If more than one points have the lowest y value, then select the point with the lowest x value
+        // The bounding box of the points gives the static error bound of the exact predicates
+        Point lowestPoint = points[0];
+        size_t lowestDistanceFromBegin = 0;
+        BoundingBox box{points[0].x, points[0].y, points[0].x, points[0].y};
+        for (size_t pointId = 0; pointId < pointsNumber; ++pointId)
         {
-            top = convexHull.top();
-            convexHull.pop();
+            if ((lowestPoint.y > points[pointId].y) || (lowestPoint.y == points[pointId].y && lowestPoint.x > points[pointId].x))
+            {
+                lowestPoint = points[pointId];
+                lowestDistanceFromBegin = pointId;
+            }
+            if (predicate != OrientationPredicate::Fast)
+            {
+                box.minX = std::min(box.minX, points[pointId].x);
+                box.maxX = std::max(box.maxX, points[pointId].x);
+                box.maxY = std::max(box.maxY, points[pointId].y);
+            }
         }
-        convexHull.push(top);
-        convexHull.push(points[pointId]);
+        box.minY = lowestPoint.y;
+        const OrientationKernel<predicate> orientation(box);
+        // Move the lowestPoint to the beginning, keeping the order of the other points
+        std::rotate(points, points + lowestDistanceFromBegin, points + lowestDistanceFromBegin + 1);
+
+        // Sort the remaining points by their polar angle: O(nlogn) complexity
+        std::sort(points + 1, points + pointsNumber, [&lowestPoint, &orientation](const Point& Q, const Point& R) {
+            return orientation.CompareOrientation(lowestPoint, Q, R);
+        });
+
+        // Keep only the farthest of the points on the first ray from the lowest point, which the sort
+        // places first from the nearest, so that the scan never pops the lowest point from the stack
+        size_t firstRayEnd = 2;
+        while ((firstRayEnd < pointsNumber) && (orientation.ThreePointOrientation(lowestPoint, points[1], points[firstRayEnd]) == 0))
+            ++firstRayEnd;
+        // Only reached with the rounded signs of the fast predicate, since the points are not all collinear
+        if (firstRayEnd == pointsNumber)
+            throw std::invalid_argument("Attempted to define a convex polygon when all points all collinear");
+        std::move(points + firstRayEnd - 1, points + pointsNumber, points + 1);
+        pointsNumber -= firstRayEnd - 2;
+
+        // The first hullSize points are the stack, where the points are oriented counter-clockwise
+        size_t hullSize = 3;
+
+        // Rearrange the points inside the stack: O(n) complexity
+        for (size_t pointId = 3; pointId < pointsNumber; ++pointId) {
+            Point top = points[--hullSize];
+
+            // Keep removing the top element of the stack while the angle formed by
+            // next-on-top, top and point-in-question makes a non-counterclockwise turn
+            // The bound on the stack only matters for the rounded signs of the fast predicate
+            while ((hullSize > 1) && (orientation.ThreePointOrientation(points[hullSize - 1], top, points[pointId]) != 2))
+                top = points[--hullSize];
+
+            // The stack never grows past the point in question
+            points[hullSize++] = top;
+            points[hullSize++] = points[pointId];
+        }
+
+        return hullSize;
+    }
+
+    /*!
+     * Graham scan over an array of points, which is reordered so that the vertices of the hull
+     * moving counterclockwise from the lowest point occupy its beginning. The stack of the scan
+     * grows in the prefix of the array that has already been consumed, so no memory is allocated
+     * apart from the scratch buffers of the culling, which come from the thread arena.
+     * \return The number of vertices of the hull
+     */
+    size_t GrahamScan(Point* points, size_t pointsNumber, OrientationPredicate predicate)
+    {
+        // Check if all points are collinear, which also rejects less than 3 points
+        bool allCollinear = CheckPointsCollinear(points, pointsNumber, predicate);
+        if (allCollinear)
+            throw std::invalid_argument("Attempted to define a convex polygon when all points all collinear");
+
+        // Discard most of the interior points with the batched float orientation tests
+        if (predicate == OrientationPredicate::MixedPrecision)
+            pointsNumber = CullInteriorPoints(points, pointsNumber);
+
+        return dispatch_predicate(predicate, [&](auto kernel) { return SortAndScan<decltype(kernel)::value>(points, pointsNumber); });
     }
+}
 
+// Pass by value in order to sort the vector later
+std::stack<Point> convex_hull_from_points(std::vector<Point> points, OrientationPredicate predicate)
+{
+    const size_t hullSize = Hull::GrahamScan(points.data(), points.size(), predicate);
+    return std::stack<Point>(std::deque<Point>(points.begin(), points.begin() + hullSize));
+}
+
+size_t convex_hull_from_points(Point* points, size_t pointsNumber, OrientationPredicate predicate)
+{
+    return Hull::GrahamScan(points, pointsNumber, predicate);
+}
+
+size_t convex_hull_from_points(const Point* points, size_t pointsNumber, Point* convexHull, OrientationPredicate predicate)
+{
+    std::copy(points, points + pointsNumber, convexHull);
+    return Hull::GrahamScan(convexHull, pointsNumber, predicate);
+}
+
+std::pmr::vector<Point> convex_hull_from_points(const Point* points, size_t pointsNumber, std::pmr::memory_resource* resource,
+                                                OrientationPredicate predicate)
+{
+    std::pmr::vector<Point> convexHull(points, points + pointsNumber, resource);
+    convexHull.erase(convexHull.begin() + Hull::GrahamScan(convexHull.data(), convexHull.size(), predicate), convexHull.end());
     return convexHull;
-}
\ No newline at end of file
+}
@@ -0,0 +1,317 @@
+#include "polygon_operations/convex_intersection.h"
+#include "polygon_operations/predicates.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace Intersection
+{
+    /// Polygon whose boundary is currently traversed inside the other polygon
+    enum class Inside { Unknown, Polygon1, Polygon2 };
+
+    /// Kind of intersection between two segments
+    enum class SegmentIntersection { None, Proper, Vertex, Collinear };
+
+    /// Whether c lies on the segment ab, given that the three points are collinear
+    bool Between(const Point& a, const Point& b, const Point& c)
+    {
+        if (a.x != b.x)
+            return ((a.x <= c.x) && (c.x <= b.x)) || ((a.x >= c.x) && (c.x >= b.x));
+        return ((a.y <= c.y) && (c.y <= b.y)) || ((a.y >= c.y) && (c.y >= b.y));
+    }
+
+    /// Intersection of two parallel segments, where p and q are set to the ends of the common part
+    template<OrientationPredicate predicate>
+    SegmentIntersection IntersectParallelSegments(const Point& a, const Point& b, const Point& c, const Point& d, Point& p, Point& q,
+                                                  const OrientationKernel<predicate>& orientation)
+    {
+        if (orientation.Sign(a, b, c) != 0)
+            return SegmentIntersection::None;
+
+        if (Between(a, b, c) && Between(a, b, d)) { p = c; q = d; }
+        else if (Between(c, d, a) && Between(c, d, b)) { p = a; q = b; }
+        else if (Between(a, b, c) && Between(c, d, b)) { p = c; q = b; }
+        else if (Between(a, b, c) && Between(c, d, a)) { p = c; q = a; }
+        else if (Between(a, b, d) && Between(c, d, b)) { p = d; q = b; }
+        else if (Between(a, b, d) && Between(c, d, a)) { p = d; q = a; }
+        else return SegmentIntersection::None;
+
+        return SegmentIntersection::Collinear;
+    }
+
+    /// Intersection of the segments ab and cd, where p is set to the intersection point
+    template<OrientationPredicate predicate>
+    SegmentIntersection IntersectSegments(const Point& a, const Point& b, const Point& c, const Point& d, Point& p, Point& q,
+                                          const OrientationKernel<predicate>& orientation)
+    {
+        const double denominator = a.x * (d.y - c.y) + b.x * (c.y - d.y) + d.x * (b.y - a.y) + c.x * (a.y - b.y);
+        if (denominator == 0.0)
+            return IntersectParallelSegments(a, b, c, d, p, q, orientation);
+
+        SegmentIntersection code = SegmentIntersection::None;
+        double numerator = a.x * (d.y - c.y) + c.x * (a.y - d.y) + d.x * (c.y - a.y);
+        if ((numerator == 0.0) || (numerator == denominator))
+            code = SegmentIntersection::Vertex;
+        const double s = numerator / denominator;
+
+        numerator = -(a.x * (c.y - b.y) + b.x * (a.y - c.y) + c.x * (b.y - a.y));
+        if ((numerator == 0.0) || (numerator == denominator))
+            code = SegmentIntersection::Vertex;
+        const double t = numerator / denominator;
+
+        if ((0.0 < s) && (s < 1.0) && (0.0 < t) && (t < 1.0))
+            code = SegmentIntersection::Proper;
+        else if ((s < 0.0) || (s > 1.0) || (t < 0.0) || (t > 1.0))
+            code = SegmentIntersection::None;
+
+        p = Point(a.x + s * (b.x - a.x), a.y + s * (b.y - a.y));
+        return code;
+    }
+
+    /// Whether a point is inside or on the boundary of a convex polygon
+    template<OrientationPredicate predicate>
+    bool ContainsPoint(const Point* polygon, size_t polygonSize, const Point& point, const OrientationKernel<predicate>& orientation)
+    {
+        for (size_t vertexId = 0; vertexId < polygonSize; ++vertexId)
+        {
+            if (orientation.Sign(polygon[vertexId], polygon[(vertexId + 1 == polygonSize) ? 0 : vertexId + 1], point) < 0)
+                return false;
+        }
+        return true;
+    }
+
+    /// Centroid of the first three vertices, which lies strictly inside the polygon unlike its vertices
+    Point InteriorPoint(const Point* polygon)
+    {
+        return Point((polygon[0].x + polygon[1].x + polygon[2].x) / 3.0, (polygon[0].y + polygon[1].y + polygon[2].y) / 3.0);
+    }
+
+    /// Twice the signed area of a polygon
+    double DoubleArea(const Point* polygon, size_t polygonSize)
+    {
+        double doubleArea = 0.0;
+        for (size_t vertexId = 0; vertexId < polygonSize; ++vertexId)
+        {
+            const Point& next = polygon[(vertexId + 1 == polygonSize) ? 0 : vertexId + 1];
+            doubleArea += polygon[vertexId].x * next.y - next.x * polygon[vertexId].y;
+        }
+        return doubleArea;
+    }
+
+    /// Output buffer of the intersection skipping repeated consecutive vertices
+    struct OutputBuffer
+    {
+        Point* vertices;
+        size_t capacity;
+        size_t size;
+
+        void Append(const Point& vertex)
+        {
+            if (((size > 0) && (vertices[size - 1] == vertex)) || (size == capacity))
+                return;
+            vertices[size++] = vertex;
+        }
+    };
+
+    /// Extends a bounding box with the vertices of a polygon
+    void ExtendBoundingBox(BoundingBox& box, const Point* polygon, size_t polygonSize)
+    {
+        // Two boxes for the even and the odd vertices halve the latency of the dependent min and max
+        BoundingBox oddBox = box;
+        size_t vertexId = 0;
+        for (; vertexId + 1 < polygonSize; vertexId += 2)
+        {
+            box.minX = std::min(box.minX, polygon[vertexId].x);
+            box.minY = std::min(box.minY, polygon[vertexId].y);
+            box.maxX = std::max(box.maxX, polygon[vertexId].x);
+            box.maxY = std::max(box.maxY, polygon[vertexId].y);
+            oddBox.minX = std::min(oddBox.minX, polygon[vertexId + 1].x);
+            oddBox.minY = std::min(oddBox.minY, polygon[vertexId + 1].y);
+            oddBox.maxX = std::max(oddBox.maxX, polygon[vertexId + 1].x);
+            oddBox.maxY = std::max(oddBox.maxY, polygon[vertexId + 1].y);
+        }
+        if (vertexId < polygonSize)
+        {
+            box.minX = std::min(box.minX, polygon[vertexId].x);
+            box.minY = std::min(box.minY, polygon[vertexId].y);
+            box.maxX = std::max(box.maxX, polygon[vertexId].x);
+            box.maxY = std::max(box.maxY, polygon[vertexId].y);
+        }
+        box.minX = std::min(box.minX, oddBox.minX);
+        box.minY = std::min(box.minY, oddBox.minY);
+        box.maxX = std::max(box.maxX, oddBox.maxX);
+        box.maxY = std::max(box.maxY, oddBox.maxY);
+    }
+
+    /// Bounding box of the vertices of two polygons
+    BoundingBox CommonBoundingBox(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size)
+    {
+        BoundingBox box{polygon1[0].x, polygon1[0].y, polygon1[0].x, polygon1[0].y};
+        ExtendBoundingBox(box, polygon1, polygon1Size);
+        ExtendBoundingBox(box, polygon2, polygon2Size);
+        return box;
+    }
+
+    /*!
+     * Traversal of the boundaries of two convex polygons, instantiated for every predicate so that the
+     * orientation tests are inlined, where the exact predicates are mostly certified by the static error
+     * bound of the bounding box of the polygons. The intersection points are not tested, so their
+     * rounding does not invalidate the bound.
+     */
+    template<OrientationPredicate predicate>
+    size_t Intersect(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size, Point* intersection)
+    {
+        const OrientationKernel<predicate> orientation = (predicate == OrientationPredicate::Fast) ? OrientationKernel<predicate>() :
+            OrientationKernel<predicate>(CommonBoundingBox(polygon1, polygon1Size, polygon2, polygon2Size));
+        OutputBuffer output = {intersection, polygon1Size + polygon2Size, 0};
+        Inside inside = Inside::Unknown;
+        bool firstIntersection = true;
+
+        // Edge a of polygon1 ends at vertex a, edge b of polygon2 ends at vertex b
+        size_t a = 0;
+        size_t b = 0;
+        size_t aAdvances = 0;
+        size_t bAdvances = 0;
+        auto advanceA = [&]() {
+            if (inside == Inside::Polygon1)
+                output.Append(polygon1[a]);
+            ++aAdvances;
+            a = (a + 1 == polygon1Size) ? 0 : a + 1;
+        };
+        auto advanceB = [&]() {
+            if (inside == Inside::Polygon2)
+                output.Append(polygon2[b]);
+            ++bAdvances;
+            b = (b + 1 == polygon2Size) ? 0 : b + 1;
+        };
+
+        do
+        {
+            const Point& aTail = polygon1[(a == 0) ? polygon1Size - 1 : a - 1];
+            const Point& aHead = polygon1[a];
+            const Point& bTail = polygon2[(b == 0) ? polygon2Size - 1 : b - 1];
+            const Point& bHead = polygon2[b];
+
+            const Vector edgeA(aTail, aHead);
+            const Vector edgeB(bTail, bHead);
+            const double crossValue = edgeA.x * edgeB.y - edgeA.y * edgeB.x;
+            const int cross = (crossValue > 0.0) - (crossValue < 0.0);
+
+            // The sides of the heads are only tested where the rules below need them
+            Point p(0.0, 0.0);
+            Point q(0.0, 0.0);
+            const SegmentIntersection code = IntersectSegments(aTail, aHead, bTail, bHead, p, q, orientation);
+            if ((code == SegmentIntersection::Proper) || (code == SegmentIntersection::Vertex))
+            {
+                if (firstIntersection)
+                {
+                    // Both polygons are traversed completely from the first crossing
+                    aAdvances = 0;
+                    bAdvances = 0;
+                    firstIntersection = false;
+                }
+                output.Append(p);
+                if (orientation.Sign(bTail, bHead, aHead) > 0)
+                    inside = Inside::Polygon1;
+                else if (orientation.Sign(aTail, aHead, bHead) > 0)
+                    inside = Inside::Polygon2;
+            }
+
+            // Edges overlapping in opposite directions: the polygons touch along a segment
+            if ((code == SegmentIntersection::Collinear) && (DotProduct(edgeA, edgeB) < 0.0))
+            {
+                output.size = 0;
+                output.Append(p);
+                output.Append(q);
+                return output.size;
+            }
+
+            if (cross == 0)
+            {
+                const int aHeadSide = orientation.Sign(bTail, bHead, aHead);
+                const int bHeadSide = orientation.Sign(aTail, aHead, bHead);
+
+                // Parallel edges facing away from each other: the polygons are disjoint
+                if ((aHeadSide < 0) && (bHeadSide < 0))
+                    return 0;
+
+                if ((aHeadSide == 0) && (bHeadSide == 0))
+                {
+                    // Collinear edges: advance the one outside without output
+                    if (inside == Inside::Polygon1)
+                        advanceB();
+                    else
+                        advanceA();
+                }
+                else if (bHeadSide > 0)
+                    advanceA();
+                else
+                    advanceB();
+            }
+            else if (cross > 0)
+            {
+                if (orientation.Sign(aTail, aHead, bHead) > 0)
+                    advanceA();
+                else
+                    advanceB();
+            }
+            else
+            {
+                if (orientation.Sign(bTail, bHead, aHead) > 0)
+                    advanceB();
+                else
+                    advanceA();
+            }
+        } while (((aAdvances < polygon1Size) || (bAdvances < polygon2Size)) && (aAdvances < 2 * polygon1Size) && (bAdvances < 2 * polygon2Size));
+
+        if (inside != Inside::Unknown)
+        {
+            // The traversal ends where it started
+            if ((output.size > 1) && (output.vertices[0] == output.vertices[output.size - 1]))
+                --output.size;
+            return output.size;
+        }
+
+        // The boundaries do not cross: one polygon contains the other, or they are disjoint or touching.
+        // A polygon is contained in the other only if its interior points are, and when the interior
+        // points of both polygons are contained in the other polygon, the contained one is the smaller.
+        output.size = 0;
+        const bool contains1 = ContainsPoint(polygon2, polygon2Size, InteriorPoint(polygon1), orientation);
+        const bool contains2 = ContainsPoint(polygon1, polygon1Size, InteriorPoint(polygon2), orientation);
+        const Point* contained = nullptr;
+        size_t containedSize = 0;
+        if (contains1 && (!contains2 || (DoubleArea(polygon1, polygon1Size) <= DoubleArea(polygon2, polygon2Size))))
+        {
+            contained = polygon1;
+            containedSize = polygon1Size;
+        }
+        else if (contains2)
+        {
+            contained = polygon2;
+            containedSize = polygon2Size;
+        }
+
+        for (size_t vertexId = 0; vertexId < containedSize; ++vertexId)
+            output.Append(contained[vertexId]);
+
+        return output.size;
+    }
+}
+
+size_t convex_polygon_intersection(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size,
+                                   Point* intersection, OrientationPredicate predicate)
+{
+    if ((polygon1Size < 3) || (polygon2Size < 3))
+        throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
+
+    return dispatch_predicate(predicate, [&](auto kernel) {
+        return Intersection::Intersect<decltype(kernel)::value>(polygon1, polygon1Size, polygon2, polygon2Size, intersection);
+    });
+}
+
+void convex_polygon_intersection(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2,
+                                 std::vector<Point>& intersection, OrientationPredicate predicate)
+{
+    intersection.resize(polygon1.size() + polygon2.size(), Point(0.0, 0.0));
+    const size_t verticesNumber = convex_polygon_intersection(polygon1.data(), polygon1.size(), polygon2.data(), polygon2.size(), intersection.data(), predicate);
+    intersection.resize(verticesNumber, Point(0.0, 0.0));
+}
@@ -1,12 +1,18 @@
 #include "polygon_operations/convex_polygon.h"
+#include "polygon_operations/arena.h"
+#include "polygon_operations/sat_kernel.h"
+#include "polygon_operations/predicates.h"
+#include "stack_access.h"
 #include <stdexcept>
+#include <algorithm>
 
 namespace Polygon 
 {
     /// Calculate vectors expressing the normal lines to the polygon edges
-    std::vector<Vector> CalculatePolygonEdgesNormals(const std::vector<Point>& polygon)
+    std::pmr::vector<Vector> CalculatePolygonEdgesNormals(const std::vector<Point>& polygon, std::pmr::memory_resource* resource)
     {
-        std::vector<Vector> normals;
+        std::pmr::vector<Vector> normals(resource);
+        normals.reserve(polygon.size());
         for(auto vertex = polygon.begin(); vertex != polygon.end(); ++vertex)
         {
             Vector edge(0,0);
@@ -27,9 +33,10 @@ namespace Polygon
     }
 
     /// Project all the points of the polygon to a single normal line using the dot product
-    std::vector<double> PolygonProjectionsToLine(const Vector& line, const std::vector<Point>& polygon)
+    std::pmr::vector<double> PolygonProjectionsToLine(const Vector& line, const std::vector<Point>& polygon, std::pmr::memory_resource* resource)
     {
-        std::vector<double> projections;
+        std::pmr::vector<double> projections(resource);
+        projections.reserve(polygon.size());
         // Project points of polygon1 to normal
         for (auto point: polygon)
         {
@@ -42,14 +49,17 @@ namespace Polygon
     /// Find whether the ranges of the projections to the normal overlap
     bool ProjectionsOverlap(const Vector& normal, const std::vector<Point>& polygon1, const std::vector<Point>& polygon2)
     {
+        // The projections are scratch buffers reclaimed at the end of the scope
+        ArenaScope scope;
+
         // Calculate all the projections of the vertices on the normal for polygon1
-        std::vector<double> projectionsPolygon1 = PolygonProjectionsToLine(normal, polygon1);
+        std::pmr::vector<double> projectionsPolygon1 = PolygonProjectionsToLine(normal, polygon1, scope.Resource());
         // Standard algorithm for finding minimum and maximum values
         double maximumProjection1 = *max_element(std::begin(projectionsPolygon1), std::end(projectionsPolygon1));
         double minumumProjection1 = *min_element(std::begin(projectionsPolygon1), std::end(projectionsPolygon1));
 
         // Calculate all the projections of the vertices on the normal for polygon1
-        std::vector<double> projectionsPolygon2 = PolygonProjectionsToLine(normal, polygon2);
+        std::pmr::vector<double> projectionsPolygon2 = PolygonProjectionsToLine(normal, polygon2, scope.Resource());
         // Standard algorithm for finding minimum and maximum values
         double maximumProjection2 = *max_element(std::begin(projectionsPolygon2), std::end(projectionsPolygon2));
         double minumumProjection2 = *min_element(std::begin(projectionsPolygon2), std::end(projectionsPolygon2));
@@ -65,8 +75,10 @@ namespace Polygon
     /// Not definitive result
     bool CheckPolygonOverlaps(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2)
     {
+        ArenaScope scope;
+
         // Calculate all the normal lines on the edges of the first polygon
-        std::vector<Vector> normals = CalculatePolygonEdgesNormals(polygon1);
+        std::pmr::vector<Vector> normals = CalculatePolygonEdgesNormals(polygon1, scope.Resource());
 
         // For every normal line, find whether the projections are overlapping
         for (auto& normal : normals)
@@ -82,43 +94,267 @@ namespace Polygon
         return true;
     }
 
-}
+    /// Copy the points of a stack into a buffer starting from the bottom of the stack.
+    /// The underlying container of the stack already stores the points from the bottom to the top,
+    /// so it is copied directly instead of popping the stack.
+    void StackToBufferFromBottom(const std::stack<Point>& stackToCopy, std::vector<Point>& buffer)
+    {
+        const auto& container = Utilities::StackContainer(stackToCopy);
+        buffer.assign(container.begin(), container.end());
+    }
 
+    /// Whether a point lies inside a convex polygon with vertices moving counterclockwise, given by
+    /// any random access container, i.e. not on the right of any edge. The determinant of every edge
+    /// is the one of the fixed-size kernels, so a point on an edge or equal to a vertex is included.
+    template<OrientationPredicate predicate, class Vertices>
+    bool PointIsInPolygon(const Point& pointInConsideration, const Vertices& convexPolygon, size_t polygonSize)
+    {
+        const OrientationKernel<predicate> orientation;
+        for (size_t vertexId = polygonSize - 1; vertexId > 0; --vertexId)
+        {
+            if (orientation.Sign(convexPolygon[vertexId - 1], convexPolygon[vertexId], pointInConsideration) < 0)
+                return false;
+        }
+        if (orientation.Sign(convexPolygon[polygonSize - 1], convexPolygon[0], pointInConsideration) < 0)
+            return false;
 
+        return true;
+    }
 
-bool point_is_in_polygon(const Point& pointInConsideration, std::stack<Point> convexPolygon)
-{
-    // It is not possible to define a polygon with less than 3 points
-    if (convexPolygon.size() < 3)
-        throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
+    /// PointIsInPolygon with the predicate selected once for all the edges
+    template<class Vertices>
+    bool PointIsInPolygon(const Point& pointInConsideration, const Vertices& convexPolygon, size_t polygonSize,
+                          OrientationPredicate predicate)
+    {
+        // It is not possible to define a polygon with less than 3 points
+        if (polygonSize < 3)
+            throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
 
-    const auto originalTopPoint = convexPolygon.top();
-    const size_t polygonSize = convexPolygon.size();
+        return dispatch_predicate(predicate, [&](auto kernel) {
+            return PointIsInPolygon<decltype(kernel)::value>(pointInConsideration, convexPolygon, polygonSize);
+        });
+    }
 
-    for (size_t iter = 0; iter < polygonSize-1; ++iter)
+    /// Minimum sign of each point over the edges of a convex polygon, which is negative for the points outside
+    void MinimumEdgeSigns(const Point* points, size_t pointsNumber, const Point* convexPolygon, size_t polygonSize,
+                          signed char* minimumSigns, OrientationPredicate predicate)
     {
-        auto previousTop = convexPolygon.top();
-        convexPolygon.pop();
-        if (!IsPointRightToTheEdge(previousTop, convexPolygon.top(), pointInConsideration))
-            return false;
+        // It is not possible to define a polygon with less than 3 points
+        if (polygonSize < 3)
+            throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
+
+        ArenaScope scope;
+        std::pmr::vector<signed char> signs(pointsNumber, 0, scope.Resource());
+        std::fill(minimumSigns, minimumSigns + pointsNumber, 1);
+        for (size_t vertexId = 0; vertexId < polygonSize; ++vertexId)
+        {
+            const Point& tail = convexPolygon[vertexId];
+            const Point& head = convexPolygon[(vertexId + 1 == polygonSize) ? 0 : vertexId + 1];
+            orient2d_signs(tail, head, points, pointsNumber, signs.data(), predicate);
+            for (size_t pointId = 0; pointId < pointsNumber; ++pointId)
+                minimumSigns[pointId] = std::min(minimumSigns[pointId], signs[pointId]);
+        }
     }
-    if (!IsPointRightToTheEdge(convexPolygon.top(), originalTopPoint, pointInConsideration))
-        return false;
 
-    return true;
+    /// An x-monotone chain of a convex polygon, traversed with increasing x. The lower chain
+    /// runs counterclockwise from the leftmost to the rightmost vertex and the upper chain
+    /// runs clockwise between the same extremes.
+    struct MonotoneChain
+    {
+        const Point* polygon;
+        size_t polygonSize;
+        size_t firstVertex;
+        size_t edgesNumber;
+        bool counterclockwise;
+
+        /// Vertex of the chain, with k ranging from 0 to edgesNumber
+        const Point& Vertex(size_t k) const
+        {
+            const size_t n = polygonSize;
+            if (counterclockwise)
+                return polygon[(firstVertex + k) % n];
+            return polygon[(firstVertex + n - k) % n];
+        }
+    };
+
+    /// Find the leftmost (xDirection = -1) or rightmost (xDirection = 1) vertex of a convex polygon.
+    /// When a vertical edge is extreme, the lowest or the highest of its vertices is selected.
+    size_t HorizontalExtremeVertex(const Point* polygon, size_t n, double xDirection, bool lowest)
+    {
+        size_t index = extreme_vertex_index(polygon, n, Vector(xDirection, 0.0));
+
+        auto isBetter = [&](size_t candidate) {
+            if (polygon[candidate].x != polygon[index].x)
+                return false;
+            return lowest ? polygon[candidate].y < polygon[index].y : polygon[candidate].y > polygon[index].y;
+        };
+
+        // Walk along the vertical edge in both directions
+        for (size_t next = (index + 1) % n; isBetter(next); next = (index + 1) % n)
+            index = next;
+        for (size_t previous = (index + n - 1) % n; isBetter(previous); previous = (index + n - 1) % n)
+            index = previous;
+
+        return index;
+    }
+
+    /// Index of the first vertex of the chain with an x coordinate greater than x (strict == true)
+    /// or greater than or equal to x (strict == false)
+    size_t ChainBound(const MonotoneChain& chain, double x, bool strict)
+    {
+        size_t lo = 0;
+        size_t hi = chain.edgesNumber + 1;
+        while (lo < hi)
+        {
+            const size_t mid = (lo + hi) / 2;
+            const double vertexX = chain.Vertex(mid).x;
+            if (strict ? (vertexX <= x) : (vertexX < x))
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+
+    /// Evaluate the y coordinate of the chain at x using binary search
+    double ChainValueAt(const MonotoneChain& chain, double x)
+    {
+        const size_t firstGreater = ChainBound(chain, x, true);
+        if (firstGreater == 0)
+            return chain.Vertex(0).y;
+        if (firstGreater > chain.edgesNumber)
+            return chain.Vertex(chain.edgesNumber).y;
+
+        const Point& tail = chain.Vertex(firstGreater - 1);
+        const Point& head = chain.Vertex(firstGreater);
+        return tail.y + (head.y - tail.y) * (x - tail.x) / (head.x - tail.x);
+    }
+
+    /// Find the minimum of convexChain(x) - concaveChain(x) for x in [lo, hi] with prune-and-search.
+    /// The difference is a convex piecewise linear function, so at every step the slopes of the median
+    /// edges of the two chains tell on which side of them the minimum lies, and half of the remaining
+    /// edges of one of the chains is discarded. Complexity O(logn + logm).
+    double MinimumChainDifference(const MonotoneChain& convexChain, const MonotoneChain& concaveChain, double lo, double hi)
+    {
+        if (lo == hi)
+            return ChainValueAt(convexChain, lo) - ChainValueAt(concaveChain, lo);
+
+        // Keep only the edges overlapping with [lo, hi]
+        long convexFirst = static_cast<long>(ChainBound(convexChain, lo, true)) - 1;
+        long convexLast = static_cast<long>(ChainBound(convexChain, hi, false)) - 1;
+        long concaveFirst = static_cast<long>(ChainBound(concaveChain, lo, true)) - 1;
+        long concaveLast = static_cast<long>(ChainBound(concaveChain, hi, false)) - 1;
+
+        while ((convexFirst <= convexLast) && (concaveFirst <= concaveLast))
+        {
+            const long convexMid = (convexFirst + convexLast) / 2;
+            const long concaveMid = (concaveFirst + concaveLast) / 2;
+            const Point& convexTail = convexChain.Vertex(convexMid);
+            const Point& convexHead = convexChain.Vertex(convexMid + 1);
+            const Point& concaveTail = concaveChain.Vertex(concaveMid);
+            const Point& concaveHead = concaveChain.Vertex(concaveMid + 1);
+
+            // Compare the slopes with cross multiplication, since both edges have positive width
+            const Vector convexEdge(convexTail, convexHead);
+            const Vector concaveEdge(concaveTail, concaveHead);
+            const bool differenceRising = convexEdge.y * concaveEdge.x >= concaveEdge.y * convexEdge.x;
+
+            if (differenceRising)
+            {
+                // The difference does not decrease to the right of both edge tails
+                if (std::max(convexTail.x, lo) >= std::max(concaveTail.x, lo))
+                    convexLast = convexMid - 1;
+                else
+                    concaveLast = concaveMid - 1;
+            }
+            else
+            {
+                // The difference decreases to the left of both edge heads
+                if (std::min(convexHead.x, hi) <= std::min(concaveHead.x, hi))
+                    convexFirst = convexMid + 1;
+                else
+                    concaveFirst = concaveMid + 1;
+            }
+        }
+
+        // The minimum lies on the vertex left between the discarded edges of one of the chains
+        const double minimumX = (convexFirst > convexLast) ? convexChain.Vertex(convexFirst).x
+                                                           : concaveChain.Vertex(concaveFirst).x;
+        const double clampedX = std::min(std::max(minimumX, lo), hi);
+        return ChainValueAt(convexChain, clampedX) - ChainValueAt(concaveChain, clampedX);
+    }
+
+}
+
+
+
+bool point_is_in_polygon(const Point& pointInConsideration, const std::stack<Point>& convexPolygon, OrientationPredicate predicate)
+{
+    // The container of the stack stores the vertices moving counterclockwise
+    return Polygon::PointIsInPolygon(pointInConsideration, Utilities::StackContainer(convexPolygon), convexPolygon.size(), predicate);
+}
+
+bool point_is_in_polygon(const Point& pointInConsideration, const Point* convexPolygon, size_t polygonSize,
+                         OrientationPredicate predicate)
+{
+    return Polygon::PointIsInPolygon(pointInConsideration, convexPolygon, polygonSize, predicate);
+}
+
+std::vector<bool> points_are_in_polygon(const std::vector<Point>& points, const std::vector<Point>& convexPolygon,
+                                        OrientationPredicate predicate)
+{
+    ArenaScope scope;
+    std::pmr::vector<signed char> minimumSigns(points.size(), 1, scope.Resource());
+    Polygon::MinimumEdgeSigns(points.data(), points.size(), convexPolygon.data(), convexPolygon.size(), minimumSigns.data(), predicate);
+
+    std::vector<bool> inside(points.size(), true);
+    for (size_t pointId = 0; pointId < points.size(); ++pointId)
+        inside[pointId] = (minimumSigns[pointId] >= 0);
+    return inside;
 }
 
-bool do_intersect(std::stack<Point> polygon1, std::stack<Point> polygon2)
+void points_are_in_polygon(const Point* points, size_t pointsNumber, const Point* convexPolygon, size_t polygonSize,
+                           bool* inside, OrientationPredicate predicate)
 {
-    // Convert from stack to vector for both polygons
-    auto polygon1Vector = StackToVectorFromBottom<Point>(polygon1);
-    auto polygon2Vector = StackToVectorFromBottom<Point>(polygon2);
-    
-    return do_intersect(polygon1Vector, polygon2Vector);
+    ArenaScope scope;
+    std::pmr::vector<signed char> minimumSigns(pointsNumber, 1, scope.Resource());
+    Polygon::MinimumEdgeSigns(points, pointsNumber, convexPolygon, polygonSize, minimumSigns.data(), predicate);
+
+    for (size_t pointId = 0; pointId < pointsNumber; ++pointId)
+        inside[pointId] = (minimumSigns[pointId] >= 0);
+}
+
+bool do_intersect(const std::stack<Point>& polygon1, const std::stack<Point>& polygon2)
+{
+    // Per-thread buffers reused between calls, so that only the copies of the stacks allocate
+    thread_local std::vector<Point> polygon1Vector;
+    thread_local std::vector<Point> polygon2Vector;
+    Polygon::StackToBufferFromBottom(polygon1, polygon1Vector);
+    Polygon::StackToBufferFromBottom(polygon2, polygon2Vector);
+
+    return sat_do_intersect(polygon1Vector.data(), polygon1Vector.size(), polygon2Vector.data(), polygon2Vector.size());
 }
 
 
 bool do_intersect(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2)
+{
+    return do_intersect(polygon1.data(), polygon1.size(), polygon2.data(), polygon2.size());
+}
+
+bool do_intersect(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size)
+{
+    if ((polygon1Size < 3) || (polygon2Size < 3))
+        throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
+
+    return sat_do_intersect(polygon1, polygon1Size, polygon2, polygon2Size);
+}
+
+bool do_intersect(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2, MinimumTranslation& translation)
+{
+    return sat_minimum_translation(polygon1.data(), polygon1.size(), polygon2.data(), polygon2.size(), translation);
+}
+
+bool do_intersect_reference(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2)
 {
     if ((polygon1.size() < 3) || (polygon2.size() < 3))
         throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
@@ -138,4 +374,132 @@ bool do_intersect(const std::vector<Point>& polygon1, const std::vector<Point>&
         return false;
 
     return true;
-}
\ No newline at end of file
+}
+
+
+size_t extreme_vertex_index(const std::vector<Point>& convexPolygon, const Vector& direction)
+{
+    return extreme_vertex_index(convexPolygon.data(), convexPolygon.size(), direction);
+}
+
+size_t extreme_vertex_index(const Point* convexPolygon, size_t n, const Vector& direction)
+{
+    if (n < 3)
+        throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
+
+    auto projection = [&](size_t index) { return DotProduct(direction, convexPolygon[index % n]); };
+    // Whether the edge starting from the vertex moves along the direction
+    auto edgeRises = [&](size_t index) { return projection(index + 1) > projection(index); };
+
+    // The first vertex is checked separately since the search runs over the closed chain [0, n]
+    if ((projection(1) <= projection(0)) && (projection(n - 1) <= projection(0)))
+        return 0;
+
+    size_t first = 0;
+    size_t last = n;
+    while (last - first > 1)
+    {
+        const size_t middle = (first + last) / 2;
+        const bool middleRises = edgeRises(middle);
+        if (!middleRises && (projection(middle - 1) <= projection(middle)))
+            return middle;
+
+        // Select the subchain [first, middle] or [middle, last] containing the maximum
+        if (edgeRises(first))
+        {
+            if (!middleRises || (projection(first) > projection(middle)))
+                last = middle;
+            else
+                first = middle;
+        }
+        else
+        {
+            if (!middleRises && (projection(first) < projection(middle)))
+                last = middle;
+            else
+                first = middle;
+        }
+    }
+
+    return (projection(first) > projection(last)) ? first % n : last % n;
+}
+
+size_t extreme_vertex_index(const std::vector<Point>& convexPolygon, const Vector& direction, size_t hintIndex)
+{
+    return extreme_vertex_index(convexPolygon.data(), convexPolygon.size(), direction, hintIndex);
+}
+
+size_t extreme_vertex_index(const Point* convexPolygon, size_t n, const Vector& direction, size_t hintIndex)
+{
+    // Number of hill climbing steps before falling back to binary search
+    const size_t maximumClimbingSteps = 8;
+
+    if ((n < 3) || (hintIndex >= n))
+        return extreme_vertex_index(convexPolygon, n, direction);
+
+    size_t index = hintIndex;
+    double projection = DotProduct(direction, convexPolygon[index]);
+    for (size_t step = 0; step < maximumClimbingSteps; ++step)
+    {
+        const size_t next = (index + 1) % n;
+        const size_t previous = (index + n - 1) % n;
+        const double nextProjection = DotProduct(direction, convexPolygon[next]);
+        const double previousProjection = DotProduct(direction, convexPolygon[previous]);
+
+        // A local maximum of a convex polygon is also the global one
+        if ((nextProjection <= projection) && (previousProjection <= projection))
+            return index;
+
+        if (nextProjection > previousProjection)
+        {
+            index = next;
+            projection = nextProjection;
+        }
+        else
+        {
+            index = previous;
+            projection = previousProjection;
+        }
+    }
+
+    return extreme_vertex_index(convexPolygon, n, direction);
+}
+
+bool do_intersect_logarithmic(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2)
+{
+    return do_intersect_logarithmic(polygon1.data(), polygon1.size(), polygon2.data(), polygon2.size());
+}
+
+bool do_intersect_logarithmic(const Point* polygon1, size_t n1, const Point* polygon2, size_t n2)
+{
+    if ((n1 < 3) || (n2 < 3))
+        throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
+
+    const size_t leftLow1 = Polygon::HorizontalExtremeVertex(polygon1, n1, -1.0, true);
+    const size_t leftHigh1 = Polygon::HorizontalExtremeVertex(polygon1, n1, -1.0, false);
+    const size_t rightLow1 = Polygon::HorizontalExtremeVertex(polygon1, n1, 1.0, true);
+    const size_t rightHigh1 = Polygon::HorizontalExtremeVertex(polygon1, n1, 1.0, false);
+    const size_t leftLow2 = Polygon::HorizontalExtremeVertex(polygon2, n2, -1.0, true);
+    const size_t leftHigh2 = Polygon::HorizontalExtremeVertex(polygon2, n2, -1.0, false);
+    const size_t rightLow2 = Polygon::HorizontalExtremeVertex(polygon2, n2, 1.0, true);
+    const size_t rightHigh2 = Polygon::HorizontalExtremeVertex(polygon2, n2, 1.0, false);
+
+    // The polygons can only intersect over their common x-range
+    const double lo = std::max(polygon1[leftLow1].x, polygon2[leftLow2].x);
+    const double hi = std::min(polygon1[rightLow1].x, polygon2[rightLow2].x);
+    if (lo > hi)
+        return false;
+
+    const Polygon::MonotoneChain lower1 = {polygon1, n1, leftLow1, (rightLow1 + n1 - leftLow1) % n1, true};
+    const Polygon::MonotoneChain upper1 = {polygon1, n1, leftHigh1, (leftHigh1 + n1 - rightHigh1) % n1, false};
+    const Polygon::MonotoneChain lower2 = {polygon2, n2, leftLow2, (rightLow2 + n2 - leftLow2) % n2, true};
+    const Polygon::MonotoneChain upper2 = {polygon2, n2, leftHigh2, (leftHigh2 + n2 - rightHigh2) % n2, false};
+
+    // polygon1 must dip below the top of polygon2 and polygon2 below the top of polygon1
+    if (Polygon::MinimumChainDifference(lower1, upper2, lo, hi) > 0)
+        return false;
+    if (Polygon::MinimumChainDifference(lower2, upper1, lo, hi) > 0)
+        return false;
+
+    return true;
+}
@@ -0,0 +1,77 @@
+#include "polygon_operations/fixed_polygon.h"
+#include <stdexcept>
+
+SmallPolygon::SmallPolygon()
+    : inlineVertices(FixedPolygon::FilledVertices<inlineCapacity>(Point(0.0, 0.0), std::make_index_sequence<inlineCapacity>())),
+      heapVertices(), size(0)
+{
+}
+
+SmallPolygon::SmallPolygon(const Point* vertices, size_t verticesNumber): SmallPolygon()
+{
+    if (verticesNumber > inlineCapacity)
+    {
+        heapVertices.assign(vertices, vertices + verticesNumber);
+        size = verticesNumber;
+        return;
+    }
+    std::copy(vertices, vertices + verticesNumber, inlineVertices.begin());
+    size = verticesNumber;
+}
+
+SmallPolygon::SmallPolygon(const std::vector<Point>& vertices): SmallPolygon(vertices.data(), vertices.size())
+{
+}
+
+void SmallPolygon::Add(const Point& vertex)
+{
+    if (IsInline() && (size < inlineCapacity))
+    {
+        inlineVertices[size++] = vertex;
+        return;
+    }
+    if (IsInline())
+    {
+        heapVertices.reserve(2 * inlineCapacity);
+        heapVertices.assign(inlineVertices.begin(), inlineVertices.end());
+    }
+    heapVertices.push_back(vertex);
+    ++size;
+}
+
+void SmallPolygon::Clear()
+{
+    heapVertices.clear();
+    size = 0;
+}
+
+bool do_intersect(const SmallPolygon& polygon1, const SmallPolygon& polygon2)
+{
+    return sat_do_intersect(polygon1.Data(), polygon1.Size(), polygon2.Data(), polygon2.Size());
+}
+
+bool point_is_in_polygon(const Point& point, const SmallPolygon& polygon, OrientationPredicate predicate)
+{
+    // It is not possible to define a polygon with less than 3 points
+    if (polygon.Size() < 3)
+        throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
+
+    if (polygon.Size() == 3)
+        return point_is_in_polygon(point, Triangle(polygon.Data()), predicate);
+    if (polygon.Size() == 4)
+        return point_is_in_polygon(point, Quad(polygon.Data()), predicate);
+
+    for (size_t vertexId = 0; vertexId < polygon.Size(); ++vertexId)
+    {
+        const Point& tail = polygon[vertexId];
+        const Point& head = polygon[(vertexId + 1 == polygon.Size()) ? 0 : vertexId + 1];
+        if (orient2d(tail, head, point, predicate) < 0.0)
+            return false;
+    }
+    return true;
+}
+
+PolygonMetrics polygon_metrics(const SmallPolygon& polygon)
+{
+    return polygon_metrics(polygon.Data(), polygon.Size());
+}
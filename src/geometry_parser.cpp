@@ -0,0 +1,581 @@
+#include "polygon_operations/geometry_parser.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+// The coordinates of WKB are copied into the points as pairs of doubles
+static_assert(sizeof(Point) == 2 * sizeof(double) && std::is_standard_layout<Point>::value,
+              "Point must have the layout of two doubles");
+
+namespace GeometryParser
+{
+    /// Chunks of the parallel WKT parser are at least this long, so that small texts are not split
+    const size_t minimumChunkLength = size_t(1) << 16;
+
+    bool IsSpace(char c)
+    {
+        return (c == ' ') || (c == '\n') || (c == '\r') || (c == '\t') || (c == '\f') || (c == '\v');
+    }
+
+    bool IsLetter(char c)
+    {
+        const char lower = static_cast<char>(c | 0x20);
+        return (lower >= 'a') && (lower <= 'z');
+    }
+
+    /// Whether a word equals an uppercase keyword, ignoring the case
+    bool WordIs(const char* word, size_t wordLength, const char* keyword)
+    {
+        if (wordLength != std::strlen(keyword))
+            return false;
+        for (size_t charId = 0; charId < wordLength; ++charId)
+        {
+            if ((word[charId] & ~0x20) != keyword[charId])
+                return false;
+        }
+        return true;
+    }
+
+    /// Whether a word is a dimension tag of WKT
+    bool IsDimensions(const char* word, size_t wordLength)
+    {
+        return WordIs(word, wordLength, "Z") || WordIs(word, wordLength, "M") || WordIs(word, wordLength, "ZM");
+    }
+
+    /*!
+     * Drops the vertex closing the ring that starts from vertex ringStart of the batch and reverses
+     * the ring when it moves clockwise, as the rings of WKT and WKB may move either way
+     */
+    void FinishExteriorRing(PolygonBatch& batch, size_t ringStart)
+    {
+        std::pmr::vector<Point>& vertices = batch.vertices;
+        if ((vertices.size() > ringStart + 1) && (vertices.back() == vertices[ringStart]))
+            vertices.pop_back();
+
+        double doubleArea = 0.0;
+        for (size_t vertexId = ringStart; vertexId < vertices.size(); ++vertexId)
+        {
+            const Point& tail = vertices[vertexId];
+            const Point& head = (vertexId + 1 < vertices.size()) ? vertices[vertexId + 1] : vertices[ringStart];
+            doubleArea += tail.x * head.y - head.x * tail.y;
+        }
+        if (doubleArea < 0.0)
+            std::reverse(vertices.begin() + ringStart, vertices.end());
+    }
+
+    /// Appends the end of the last geometry to the batch
+    void FinishGeometry(GeometryBatch& geometries, GeometryType type)
+    {
+        geometries.points.offsets.push_back(geometries.points.vertices.size());
+        geometries.types.push_back(type);
+    }
+
+    /// Removes the geometries appended to a batch after it had the given sizes
+    void Truncate(GeometryBatch& geometries, size_t verticesNumber, size_t geometriesNumber)
+    {
+        std::pmr::vector<Point>& vertices = geometries.points.vertices;
+        vertices.erase(vertices.begin() + verticesNumber, vertices.end());
+        geometries.points.offsets.resize(geometriesNumber + 1);
+        geometries.types.resize(geometriesNumber);
+    }
+
+    /*!
+     * Recursive descent parser of WKT reading the text in place
+     */
+    class WktReader
+    {
+    public:
+        /*!
+         * \param text The text to be parsed
+         * \param length The number of characters of the text
+         * \param textOffset The offset of the text inside the whole input, for the error messages
+         */
+        WktReader(const char* text, size_t length, size_t textOffset):
+            begin(text), current(text), end(text + length), textOffset(textOffset) {}
+
+        /// Whether only whitespace is left
+        bool AtEnd()
+        {
+            SkipSpaces();
+            return current == end;
+        }
+
+        /// Reads the next geometry and appends it to a batch
+        void ReadGeometry(GeometryBatch& geometries)
+        {
+            SkipSpaces();
+            const char* word = current;
+            const size_t wordLength = ReadWord();
+
+            // The dimensions may follow the type without a space, e.g. POINTZ
+            GeometryType type;
+            size_t typeLength;
+            if ((wordLength >= 10) && WordIs(word, 10, "MULTIPOINT"))
+            {
+                type = GeometryType::MultiPoint;
+                typeLength = 10;
+            }
+            else if ((wordLength >= 7) && WordIs(word, 7, "POLYGON"))
+            {
+                type = GeometryType::Polygon;
+                typeLength = 7;
+            }
+            else if ((wordLength >= 5) && WordIs(word, 5, "POINT"))
+            {
+                type = GeometryType::Point;
+                typeLength = 5;
+            }
+            else
+                Fail("a geometry of type POINT, MULTIPOINT or POLYGON", word);
+            if ((wordLength > typeLength) && !IsDimensions(word + typeLength, wordLength - typeLength))
+                Fail("a geometry of type POINT, MULTIPOINT or POLYGON", word);
+
+            if (!ReadEmpty())
+            {
+                switch (type)
+                {
+                    case GeometryType::Point:
+                        geometries.points.vertices.push_back(ReadCoordinates());
+                        Expect(')');
+                        break;
+                    case GeometryType::MultiPoint:
+                        ReadMultiPoint(geometries.points.vertices);
+                        break;
+                    case GeometryType::Polygon:
+                        ReadPolygon(geometries.points);
+                        break;
+                }
+            }
+            FinishGeometry(geometries, type);
+        }
+
+    private:
+        void SkipSpaces()
+        {
+            while ((current != end) && IsSpace(*current))
+                ++current;
+        }
+
+        /// Reads a word of letters, returning its length
+        size_t ReadWord()
+        {
+            const char* word = current;
+            while ((current != end) && IsLetter(*current))
+                ++current;
+            return static_cast<size_t>(current - word);
+        }
+
+        [[noreturn]] void Fail(const char* expected, const char* position) const
+        {
+            throw std::invalid_argument(std::string("Attempted to parse WKT without ") + expected + " at character " +
+                                        std::to_string(textOffset + static_cast<size_t>(position - begin)));
+        }
+
+        /// Consumes a character, failing when it is not the next one
+        void Expect(char character)
+        {
+            SkipSpaces();
+            if ((current == end) || (*current != character))
+            {
+                const char expected[] = {'\'', character, '\'', '\0'};
+                Fail(expected, current);
+            }
+            ++current;
+        }
+
+        /// Consumes a character when it is the next one
+        bool Accept(char character)
+        {
+            SkipSpaces();
+            if ((current != end) && (*current == character))
+            {
+                ++current;
+                return true;
+            }
+            return false;
+        }
+
+        /// Reads the optional dimensions after a type, followed by EMPTY or the opening parenthesis
+        bool ReadEmpty()
+        {
+            SkipSpaces();
+            const char* word = current;
+            size_t wordLength = ReadWord();
+            if (IsDimensions(word, wordLength))
+            {
+                SkipSpaces();
+                word = current;
+                wordLength = ReadWord();
+            }
+            if (WordIs(word, wordLength, "EMPTY"))
+                return true;
+            if (wordLength > 0)
+                Fail("EMPTY or '('", word);
+            Expect('(');
+            return false;
+        }
+
+        double ReadNumber()
+        {
+            SkipSpaces();
+            // std::from_chars does not accept a leading plus sign
+            if ((current != end) && (*current == '+'))
+                ++current;
+            double number;
+            const std::from_chars_result result = std::from_chars(current, end, number);
+            if (result.ec != std::errc())
+                Fail("a number", current);
+            current = result.ptr;
+            return number;
+        }
+
+        /// Reads the 2 to 4 coordinates of a point, keeping x and y
+        Point ReadCoordinates()
+        {
+            const double x = ReadNumber();
+            const double y = ReadNumber();
+            for (size_t coordinateId = 2; coordinateId < 4; ++coordinateId)
+            {
+                SkipSpaces();
+                if ((current == end) || (*current == ',') || (*current == ')'))
+                    break;
+                ReadNumber();
+            }
+            return Point(x, y);
+        }
+
+        /// Reads the points of a MULTIPOINT after its opening parenthesis, with or without parentheses around every point
+        void ReadMultiPoint(std::pmr::vector<Point>& vertices)
+        {
+            do
+            {
+                SkipSpaces();
+                const char* word = current;
+                const size_t wordLength = ReadWord();
+                if (WordIs(word, wordLength, "EMPTY"))
+                    continue;
+                if (wordLength > 0)
+                    Fail("a point", word);
+                if (Accept('('))
+                {
+                    vertices.push_back(ReadCoordinates());
+                    Expect(')');
+                }
+                else
+                    vertices.push_back(ReadCoordinates());
+            } while (Accept(','));
+            Expect(')');
+        }
+
+        /// Reads the rings of a POLYGON after its opening parenthesis, keeping the exterior ring
+        void ReadPolygon(PolygonBatch& batch)
+        {
+            const size_t ringStart = batch.vertices.size();
+            bool exteriorRing = true;
+            do
+            {
+                Expect('(');
+                do
+                {
+                    const Point point = ReadCoordinates();
+                    if (exteriorRing)
+                        batch.vertices.push_back(point);
+                } while (Accept(','));
+                Expect(')');
+                exteriorRing = false;
+            } while (Accept(','));
+            Expect(')');
+            FinishExteriorRing(batch, ringStart);
+        }
+
+        const char* begin;
+        const char* current;
+        const char* end;
+        size_t textOffset;
+    };
+
+    /// Parses a text appending its geometries to a batch, which is left unchanged on failure
+    void ParseWkt(const char* text, size_t length, size_t textOffset, GeometryBatch& geometries)
+    {
+        const size_t verticesNumber = geometries.points.vertices.size();
+        const size_t geometriesNumber = geometries.Size();
+        try
+        {
+            WktReader reader(text, length, textOffset);
+            while (!reader.AtEnd())
+                reader.ReadGeometry(geometries);
+        }
+        catch (...)
+        {
+            Truncate(geometries, verticesNumber, geometriesNumber);
+            throw;
+        }
+    }
+
+    bool HostIsLittleEndian()
+    {
+        const uint16_t value = 1;
+        unsigned char firstByte = 0;
+        std::memcpy(&firstByte, &value, 1);
+        return firstByte == 1;
+    }
+
+    uint32_t SwapBytes(uint32_t value)
+    {
+        return ((value & 0x000000FFu) << 24) | ((value & 0x0000FF00u) << 8) | ((value & 0x00FF0000u) >> 8) | ((value & 0xFF000000u) >> 24);
+    }
+
+    uint64_t SwapBytes(uint64_t value)
+    {
+        return (uint64_t(SwapBytes(uint32_t(value))) << 32) | SwapBytes(uint32_t(value >> 32));
+    }
+
+    /*!
+     * Parser of concatenated WKB geometries reading the bytes in place
+     */
+    class WkbReader
+    {
+    public:
+        WkbReader(const uint8_t* data, size_t length): begin(data), current(data), end(data + length) {}
+
+        /// Whether all the bytes are read
+        bool AtEnd() const {return current == end;}
+
+        /// Reads the next geometry and appends it to a batch
+        void ReadGeometry(GeometryBatch& geometries)
+        {
+            const Header header = ReadHeader();
+            std::pmr::vector<Point>& vertices = geometries.points.vertices;
+            switch (header.type)
+            {
+                case GeometryType::Point:
+                {
+                    const Point point = ReadPoint(header);
+                    // An empty point has NaN coordinates
+                    if (!std::isnan(point.x) || !std::isnan(point.y))
+                        vertices.push_back(point);
+                    break;
+                }
+                case GeometryType::MultiPoint:
+                {
+                    const uint32_t pointsNumber = ReadCount(header, 1 + 4 + 2 * sizeof(double));
+                    for (uint32_t pointId = 0; pointId < pointsNumber; ++pointId)
+                    {
+                        const Header pointHeader = ReadHeader();
+                        if (pointHeader.type != GeometryType::Point)
+                            Fail("a point inside a MultiPoint");
+                        const Point point = ReadPoint(pointHeader);
+                        if (!std::isnan(point.x) || !std::isnan(point.y))
+                            vertices.push_back(point);
+                    }
+                    break;
+                }
+                case GeometryType::Polygon:
+                {
+                    const size_t ringStart = vertices.size();
+                    const uint32_t ringsNumber = ReadCount(header, 4);
+                    for (uint32_t ringId = 0; ringId < ringsNumber; ++ringId)
+                    {
+                        const uint32_t pointsNumber = ReadCount(header, header.dimensions * sizeof(double));
+                        if (ringId == 0)
+                            ReadPoints(header, pointsNumber, vertices);
+                        else
+                            current += size_t(pointsNumber) * header.dimensions * sizeof(double);
+                    }
+                    FinishExteriorRing(geometries.points, ringStart);
+                    break;
+                }
+            }
+            FinishGeometry(geometries, header.type);
+        }
+
+    private:
+        /// Byte order, type and number of coordinates of a geometry
+        struct Header
+        {
+            bool swap;
+            GeometryType type;
+            size_t dimensions;
+        };
+
+        [[noreturn]] void Fail(const char* expected) const
+        {
+            throw std::invalid_argument(std::string("Attempted to parse WKB without ") + expected + " at byte " +
+                                        std::to_string(static_cast<size_t>(current - begin)));
+        }
+
+        /// Fails when fewer bytes are left
+        void Need(size_t bytes) const
+        {
+            if (static_cast<size_t>(end - current) < bytes)
+                Fail("enough bytes");
+        }
+
+        uint32_t ReadUInt32(bool swap)
+        {
+            Need(4);
+            uint32_t value;
+            std::memcpy(&value, current, 4);
+            current += 4;
+            return swap ? SwapBytes(value) : value;
+        }
+
+        double ReadDouble(bool swap)
+        {
+            uint64_t bits;
+            std::memcpy(&bits, current, 8);
+            current += 8;
+            if (swap)
+                bits = SwapBytes(bits);
+            double value;
+            std::memcpy(&value, &bits, 8);
+            return value;
+        }
+
+        /// Reads a count of elements, failing when the bytes left cannot hold its elements of at least minimumSize bytes
+        uint32_t ReadCount(const Header& header, size_t minimumSize)
+        {
+            const uint32_t count = ReadUInt32(header.swap);
+            Need(size_t(count) * minimumSize);
+            return count;
+        }
+
+        Header ReadHeader()
+        {
+            Need(1);
+            const uint8_t byteOrder = *current;
+            if (byteOrder > 1)
+                Fail("a byte order of 0 or 1");
+            ++current;
+            Header header;
+            header.swap = ((byteOrder == 1) != HostIsLittleEndian());
+
+            // ISO WKB adds 1000, 2000 or 3000 to the type for Z, M or ZM, while EWKB sets flags
+            uint32_t type = ReadUInt32(header.swap);
+            const bool hasZ = (type & 0x80000000u) != 0;
+            const bool hasM = (type & 0x40000000u) != 0;
+            const bool hasSrid = (type & 0x20000000u) != 0;
+            type &= 0x0FFFFFFFu;
+            const uint32_t isoDimensions = type / 1000;
+            type %= 1000;
+            if ((type != 1) && (type != 3) && (type != 4))
+                Fail("a geometry of type Point, MultiPoint or Polygon");
+            if (isoDimensions > 3)
+                Fail("a valid dimension");
+            header.type = static_cast<GeometryType>(type);
+            header.dimensions = 2 + ((isoDimensions == 1) || (isoDimensions == 3) || hasZ) + ((isoDimensions >= 2) || hasM);
+            if (hasSrid)
+                ReadUInt32(header.swap);
+            return header;
+        }
+
+        /// Reads the coordinates of a point, keeping x and y
+        Point ReadPoint(const Header& header)
+        {
+            Need(header.dimensions * sizeof(double));
+            const double x = ReadDouble(header.swap);
+            const double y = ReadDouble(header.swap);
+            current += (header.dimensions - 2) * sizeof(double);
+            return Point(x, y);
+        }
+
+        /// Appends the coordinates of a number of points, whose bytes are known to be available
+        void ReadPoints(const Header& header, size_t pointsNumber, std::pmr::vector<Point>& vertices)
+        {
+            if ((header.dimensions == 2) && !header.swap)
+            {
+                // The points are copied at once, as the bytes may not be aligned for doubles
+                const size_t firstPoint = vertices.size();
+                vertices.insert(vertices.end(), pointsNumber, Point(0.0, 0.0));
+                std::memcpy(vertices.data() + firstPoint, current, pointsNumber * sizeof(Point));
+                current += pointsNumber * sizeof(Point);
+                return;
+            }
+            vertices.reserve(vertices.size() + pointsNumber);
+            for (size_t pointId = 0; pointId < pointsNumber; ++pointId)
+            {
+                const double x = ReadDouble(header.swap);
+                const double y = ReadDouble(header.swap);
+                current += (header.dimensions - 2) * sizeof(double);
+                vertices.emplace_back(Point(x, y));
+            }
+        }
+
+        const uint8_t* begin;
+        const uint8_t* current;
+        const uint8_t* end;
+    };
+}
+
+void parse_wkt(const char* text, size_t length, GeometryBatch& geometries)
+{
+    GeometryParser::ParseWkt(text, length, 0, geometries);
+}
+
+void parse_wkt(const char* text, size_t length, GeometryBatch& geometries, WorkStealingThreadPool& pool)
+{
+    const size_t chunksNumber = std::max<size_t>(1, std::min(4 * pool.ThreadsNumber(), length / GeometryParser::minimumChunkLength));
+    if (chunksNumber == 1)
+    {
+        GeometryParser::ParseWkt(text, length, 0, geometries);
+        return;
+    }
+
+    // Every chunk ends after a line break, searched from its even share of the text
+    std::vector<size_t> chunkBounds(chunksNumber + 1, length);
+    chunkBounds[0] = 0;
+    for (size_t chunkId = 1; chunkId < chunksNumber; ++chunkId)
+    {
+        const size_t start = std::max(chunkBounds[chunkId - 1], chunkId * (length / chunksNumber));
+        const void* lineBreak = std::memchr(text + start, '\n', length - start);
+        chunkBounds[chunkId] = (lineBreak == nullptr) ? length : static_cast<size_t>(static_cast<const char*>(lineBreak) - text) + 1;
+    }
+
+    std::vector<GeometryBatch> chunks(chunksNumber);
+    pool.Run(chunksNumber, [&](size_t chunkId, size_t) {
+        GeometryParser::ParseWkt(text + chunkBounds[chunkId], chunkBounds[chunkId + 1] - chunkBounds[chunkId],
+                                 chunkBounds[chunkId], chunks[chunkId]);
+    });
+
+    size_t verticesNumber = geometries.points.vertices.size();
+    size_t geometriesNumber = geometries.Size();
+    for (const GeometryBatch& chunk : chunks)
+    {
+        verticesNumber += chunk.points.vertices.size();
+        geometriesNumber += chunk.Size();
+    }
+    geometries.points.vertices.reserve(verticesNumber);
+    geometries.points.offsets.reserve(geometriesNumber + 1);
+    geometries.types.reserve(geometriesNumber);
+    for (const GeometryBatch& chunk : chunks)
+    {
+        const size_t firstVertex = geometries.points.vertices.size();
+        geometries.points.vertices.insert(geometries.points.vertices.end(), chunk.points.vertices.begin(), chunk.points.vertices.end());
+        for (size_t geometryId = 1; geometryId < chunk.points.offsets.size(); ++geometryId)
+            geometries.points.offsets.push_back(firstVertex + chunk.points.offsets[geometryId]);
+        geometries.types.insert(geometries.types.end(), chunk.types.begin(), chunk.types.end());
+    }
+}
+
+void parse_wkb(const uint8_t* data, size_t length, GeometryBatch& geometries)
+{
+    const size_t verticesNumber = geometries.points.vertices.size();
+    const size_t geometriesNumber = geometries.Size();
+    try
+    {
+        // Every point takes at least 16 bytes, so this bounds the vertices by the size of the data
+        geometries.points.vertices.reserve(verticesNumber + length / sizeof(Point));
+        GeometryParser::WkbReader reader(data, length);
+        while (!reader.AtEnd())
+            reader.ReadGeometry(geometries);
+    }
+    catch (...)
+    {
+        GeometryParser::Truncate(geometries, verticesNumber, geometriesNumber);
+        throw;
+    }
+}
@@ -0,0 +1,306 @@
+#include "polygon_operations/gjk.h"
+#include "polygon_operations/convex_polygon.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace GJK
+{
+    /// Vertex of a simplex inside the Minkowski difference polygon1 - polygon2
+    struct SimplexVertex
+    {
+        Point point1{0.0, 0.0};     // Support point of polygon1
+        Point point2{0.0, 0.0};     // Support point of polygon2
+        Point w{0.0, 0.0};          // point1 - point2
+        size_t index1 = 0;
+        size_t index2 = 0;
+        double weight = 1.0;        // Barycentric coordinate of the closest point to the origin
+    };
+
+    struct Simplex
+    {
+        SimplexVertex vertices[3];
+        size_t size = 0;
+    };
+
+    SimplexVertex MakeVertex(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2, size_t index1, size_t index2)
+    {
+        SimplexVertex vertex;
+        vertex.index1 = index1;
+        vertex.index2 = index2;
+        vertex.point1 = polygon1[index1];
+        vertex.point2 = polygon2[index2];
+        vertex.w = Point(vertex.point1.x - vertex.point2.x, vertex.point1.y - vertex.point2.y);
+        return vertex;
+    }
+
+    double Cross(const Point& a, const Point& b)
+    {
+        return a.x * b.y - a.y * b.x;
+    }
+
+    /// Reduce a segment simplex to the closest feature to the origin and compute its barycentric coordinates
+    void SolveSegment(Simplex& simplex)
+    {
+        SimplexVertex& v1 = simplex.vertices[0];
+        SimplexVertex& v2 = simplex.vertices[1];
+        const Vector e12(v1.w, v2.w);
+
+        // Region of w1
+        const double d12_2 = -DotProduct(v1.w, e12);
+        if (d12_2 <= 0)
+        {
+            v1.weight = 1.0;
+            simplex.size = 1;
+            return;
+        }
+
+        // Region of w2
+        const double d12_1 = DotProduct(v2.w, e12);
+        if (d12_1 <= 0)
+        {
+            v1 = v2;
+            v1.weight = 1.0;
+            simplex.size = 1;
+            return;
+        }
+
+        // The origin projects inside the segment
+        const double inverseSum = 1.0 / (d12_1 + d12_2);
+        v1.weight = d12_1 * inverseSum;
+        v2.weight = d12_2 * inverseSum;
+        simplex.size = 2;
+    }
+
+    /// Reduce a triangle simplex to the closest feature to the origin and compute its barycentric coordinates
+    void SolveTriangle(Simplex& simplex)
+    {
+        SimplexVertex& v1 = simplex.vertices[0];
+        SimplexVertex& v2 = simplex.vertices[1];
+        SimplexVertex& v3 = simplex.vertices[2];
+
+        const Vector e12(v1.w, v2.w);
+        const double d12_1 = DotProduct(v2.w, e12);
+        const double d12_2 = -DotProduct(v1.w, e12);
+
+        const Vector e13(v1.w, v3.w);
+        const double d13_1 = DotProduct(v3.w, e13);
+        const double d13_2 = -DotProduct(v1.w, e13);
+
+        const Vector e23(v2.w, v3.w);
+        const double d23_1 = DotProduct(v3.w, e23);
+        const double d23_2 = -DotProduct(v2.w, e23);
+
+        // Signed areas of the triangles formed by the origin and each edge
+        const double n123 = Cross(e12, e13);
+        const double d123_1 = n123 * Cross(v2.w, v3.w);
+        const double d123_2 = n123 * Cross(v3.w, v1.w);
+        const double d123_3 = n123 * Cross(v1.w, v2.w);
+
+        // A degenerate triangle, e.g. a cached simplex after the polygons moved, is reduced to a segment
+        if (n123 == 0)
+        {
+            simplex.size = 2;
+            SolveSegment(simplex);
+            return;
+        }
+
+        // Region of w1
+        if ((d12_2 <= 0) && (d13_2 <= 0))
+        {
+            v1.weight = 1.0;
+            simplex.size = 1;
+            return;
+        }
+
+        // Region of e12
+        if ((d12_1 > 0) && (d12_2 > 0) && (d123_3 <= 0))
+        {
+            const double inverseSum = 1.0 / (d12_1 + d12_2);
+            v1.weight = d12_1 * inverseSum;
+            v2.weight = d12_2 * inverseSum;
+            simplex.size = 2;
+            return;
+        }
+
+        // Region of e13
+        if ((d13_1 > 0) && (d13_2 > 0) && (d123_2 <= 0))
+        {
+            const double inverseSum = 1.0 / (d13_1 + d13_2);
+            v1.weight = d13_1 * inverseSum;
+            v3.weight = d13_2 * inverseSum;
+            v2 = v3;
+            simplex.size = 2;
+            return;
+        }
+
+        // Region of w2
+        if ((d12_1 <= 0) && (d23_2 <= 0))
+        {
+            v1 = v2;
+            v1.weight = 1.0;
+            simplex.size = 1;
+            return;
+        }
+
+        // Region of w3
+        if ((d13_1 <= 0) && (d23_1 <= 0))
+        {
+            v1 = v3;
+            v1.weight = 1.0;
+            simplex.size = 1;
+            return;
+        }
+
+        // Region of e23
+        if ((d23_1 > 0) && (d23_2 > 0) && (d123_1 <= 0))
+        {
+            const double inverseSum = 1.0 / (d23_1 + d23_2);
+            v2.weight = d23_1 * inverseSum;
+            v3.weight = d23_2 * inverseSum;
+            v1 = v3;
+            simplex.size = 2;
+            return;
+        }
+
+        // The origin is inside the triangle
+        const double inverseSum = 1.0 / (d123_1 + d123_2 + d123_3);
+        v1.weight = d123_1 * inverseSum;
+        v2.weight = d123_2 * inverseSum;
+        v3.weight = d123_3 * inverseSum;
+        simplex.size = 3;
+    }
+
+    void Solve(Simplex& simplex)
+    {
+        if (simplex.size == 1)
+            simplex.vertices[0].weight = 1.0;
+        else if (simplex.size == 2)
+            SolveSegment(simplex);
+        else if (simplex.size == 3)
+            SolveTriangle(simplex);
+    }
+
+    /// Weighted sum of the given member of the simplex vertices
+    Point Combine(const Simplex& simplex, Point SimplexVertex::*member)
+    {
+        Point combination(0.0, 0.0);
+        for (size_t vertexId = 0; vertexId < simplex.size; ++vertexId)
+        {
+            const SimplexVertex& vertex = simplex.vertices[vertexId];
+            combination.x += vertex.weight * (vertex.*member).x;
+            combination.y += vertex.weight * (vertex.*member).y;
+        }
+        return combination;
+    }
+
+    /// Load the cached simplex if its indices are valid for the given polygons
+    bool LoadCache(const GJKCache& cache, const std::vector<Point>& polygon1, const std::vector<Point>& polygon2, Simplex& simplex)
+    {
+        if ((cache.simplexSize == 0) || (cache.simplexSize > 3))
+            return false;
+
+        for (size_t vertexId = 0; vertexId < cache.simplexSize; ++vertexId)
+        {
+            if ((cache.indices1[vertexId] >= polygon1.size()) || (cache.indices2[vertexId] >= polygon2.size()))
+                return false;
+            simplex.vertices[vertexId] = MakeVertex(polygon1, polygon2, cache.indices1[vertexId], cache.indices2[vertexId]);
+        }
+        simplex.size = cache.simplexSize;
+        return true;
+    }
+
+    void StoreCache(const Simplex& simplex, GJKCache& cache)
+    {
+        cache.simplexSize = simplex.size;
+        for (size_t vertexId = 0; vertexId < simplex.size; ++vertexId)
+        {
+            cache.indices1[vertexId] = simplex.vertices[vertexId].index1;
+            cache.indices2[vertexId] = simplex.vertices[vertexId].index2;
+        }
+    }
+}
+
+GJKResult gjk_query(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2, GJKCache& cache)
+{
+    if ((polygon1.size() < 3) || (polygon2.size() < 3))
+        throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
+
+    // Relative tolerances for the convergence and for the origin lying on the simplex
+    const double convergenceTolerance = 1e-12;
+    const double touchingTolerance = 1e-20;
+    // GJK terminates when a support point repeats, this is only a safeguard
+    const size_t maximumIterations = polygon1.size() + polygon2.size() + 8;
+
+    GJK::Simplex simplex;
+    if (!GJK::LoadCache(cache, polygon1, polygon2, simplex))
+    {
+        simplex.vertices[0] = GJK::MakeVertex(polygon1, polygon2, 0, 0);
+        simplex.size = 1;
+    }
+    GJK::Solve(simplex);
+
+    bool intersect = false;
+    size_t iterations = 0;
+    while (true)
+    {
+        // The origin is enclosed by the simplex
+        if (simplex.size == 3)
+        {
+            intersect = true;
+            break;
+        }
+
+        const Point closestPoint = GJK::Combine(simplex, &GJK::SimplexVertex::w);
+        const double squaredDistance = DotProduct(closestPoint, closestPoint);
+
+        double squaredScale = 0.0;
+        for (size_t vertexId = 0; vertexId < simplex.size; ++vertexId)
+            squaredScale = std::max(squaredScale, DotProduct(simplex.vertices[vertexId].w, simplex.vertices[vertexId].w));
+
+        // The origin lies on the simplex, i.e. the polygons are touching
+        if (squaredDistance <= touchingTolerance * squaredScale)
+        {
+            intersect = true;
+            break;
+        }
+
+        if (iterations == maximumIterations)
+            break;
+        ++iterations;
+
+        // Support point of the Minkowski difference towards the origin
+        const Vector searchDirection(-closestPoint.x, -closestPoint.y);
+        const size_t index1 = extreme_vertex_index(polygon1, searchDirection, simplex.vertices[0].index1);
+        const size_t index2 = extreme_vertex_index(polygon2, Vector(closestPoint), simplex.vertices[0].index2);
+        const GJK::SimplexVertex supportVertex = GJK::MakeVertex(polygon1, polygon2, index1, index2);
+
+        // A repeated support point means that no further progress is possible
+        bool duplicate = false;
+        for (size_t vertexId = 0; vertexId < simplex.size; ++vertexId)
+            duplicate = duplicate || ((simplex.vertices[vertexId].index1 == index1) && (simplex.vertices[vertexId].index2 == index2));
+        if (duplicate)
+            break;
+
+        // The support point does not move closer to the origin than the current simplex
+        if (squaredDistance - DotProduct(closestPoint, supportVertex.w) <= convergenceTolerance * squaredDistance)
+            break;
+
+        simplex.vertices[simplex.size] = supportVertex;
+        ++simplex.size;
+        GJK::Solve(simplex);
+    }
+
+    GJK::StoreCache(simplex, cache);
+
+    const Point witness1 = GJK::Combine(simplex, &GJK::SimplexVertex::point1);
+    const Point witness2 = intersect ? witness1 : GJK::Combine(simplex, &GJK::SimplexVertex::point2);
+    const double distance = intersect ? 0.0 : EuclideanDistance(witness1, witness2);
+
+    return {intersect, distance, witness1, witness2, iterations};
+}
+
+GJKResult gjk_query(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2)
+{
+    GJKCache cache;
+    return gjk_query(polygon1, polygon2, cache);
+}
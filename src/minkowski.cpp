@@ -0,0 +1,198 @@
+#include "polygon_operations/minkowski.h"
+#include "polygon_operations/arena.h"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace Minkowski
+{
+    /// Number of tasks created per thread by the batch variants
+    const size_t tasksPerThread = 16;
+
+    /// Index of the lowest vertex, with the lowest x among the lowest vertices
+    size_t BottomVertex(const Point* polygon, size_t polygonSize)
+    {
+        size_t bottom = 0;
+        for (size_t vertexId = 1; vertexId < polygonSize; ++vertexId)
+        {
+            if ((polygon[vertexId].y < polygon[bottom].y) ||
+                ((polygon[vertexId].y == polygon[bottom].y) && (polygon[vertexId].x < polygon[bottom].x)))
+                bottom = vertexId;
+        }
+        return bottom;
+    }
+
+    /// Merges the edges of two polygons sorted by angle, starting from their bottom vertices
+    size_t MergeEdges(const Point* polygon1, size_t polygon1Size, size_t start1,
+                      const Point* polygon2, size_t polygon2Size, size_t start2, Point* sum)
+    {
+        size_t count = 0;
+        size_t i = 0;
+        size_t j = 0;
+        while ((i < polygon1Size) || (j < polygon2Size))
+        {
+            const Point& vertex1 = polygon1[(start1 + i) % polygon1Size];
+            const Point& vertex2 = polygon2[(start2 + j) % polygon2Size];
+            sum[count++] = Point(vertex1.x + vertex2.x, vertex1.y + vertex2.y);
+
+            if (i == polygon1Size)
+            {
+                ++j;
+                continue;
+            }
+            if (j == polygon2Size)
+            {
+                ++i;
+                continue;
+            }
+
+            const Vector edge1(vertex1, polygon1[(start1 + i + 1) % polygon1Size]);
+            const Vector edge2(vertex2, polygon2[(start2 + j + 1) % polygon2Size]);
+            const double cross = edge1.x * edge2.y - edge1.y * edge2.x;
+            // Advance the edge with the smaller angle, or both when they are parallel
+            if (cross >= 0.0)
+                ++i;
+            if (cross <= 0.0)
+                ++j;
+        }
+        return count;
+    }
+
+    std::pmr::vector<Point> Reflected(const std::vector<Point>& polygon, std::pmr::memory_resource* resource)
+    {
+        std::pmr::vector<Point> reflected(resource);
+        reflected.reserve(polygon.size());
+        for (const auto& vertex : polygon)
+            reflected.emplace_back(Point(-vertex.x, -vertex.y));
+        return reflected;
+    }
+
+    /// Sums of every obstacle with a shape that starts from its bottom vertex
+    std::vector<std::vector<Point>> SumBatch(const std::vector<std::vector<Point>>& obstacles,
+                                             const Point* shape, size_t shapeSize,
+                                             WorkStealingThreadPool& pool)
+    {
+        if (shapeSize == 0)
+            throw std::invalid_argument("Attempted to compute the Minkowski sum of an empty polygon");
+
+        // The rotated shape is only read by the workers, so it may live in the arena of the calling thread
+        ArenaScope scope;
+        const size_t bottom = BottomVertex(shape, shapeSize);
+        std::pmr::vector<Point> shapeFromBottom(shape + bottom, shape + shapeSize, scope.Resource());
+        shapeFromBottom.insert(shapeFromBottom.end(), shape, shape + bottom);
+
+        std::vector<std::vector<Point>> sums(obstacles.size());
+        const size_t tasksNumber = std::min(obstacles.size(), pool.ThreadsNumber() * tasksPerThread);
+        pool.Run(tasksNumber, [&](size_t task, size_t) {
+            const size_t lastObstacle = obstacles.size() * (task + 1) / tasksNumber;
+            for (size_t obstacleId = obstacles.size() * task / tasksNumber; obstacleId < lastObstacle; ++obstacleId)
+            {
+                const std::vector<Point>& obstacle = obstacles[obstacleId];
+                if (obstacle.empty())
+                    throw std::invalid_argument("Attempted to compute the Minkowski sum of an empty polygon");
+
+                std::vector<Point>& sum = sums[obstacleId];
+                sum.resize(obstacle.size() + shapeFromBottom.size(), Point(0.0, 0.0));
+                const size_t count = MergeEdges(obstacle.data(), obstacle.size(), BottomVertex(obstacle.data(), obstacle.size()),
+                                                shapeFromBottom.data(), shapeFromBottom.size(), 0, sum.data());
+                sum.resize(count, Point(0.0, 0.0));
+            }
+        });
+
+        return sums;
+    }
+}
+
+size_t minkowski_sum(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size, Point* sum)
+{
+    if ((polygon1Size == 0) || (polygon2Size == 0))
+        throw std::invalid_argument("Attempted to compute the Minkowski sum of an empty polygon");
+
+    return Minkowski::MergeEdges(polygon1, polygon1Size, Minkowski::BottomVertex(polygon1, polygon1Size),
+                                 polygon2, polygon2Size, Minkowski::BottomVertex(polygon2, polygon2Size), sum);
+}
+
+std::vector<Point> minkowski_sum(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2)
+{
+    std::vector<Point> sum(polygon1.size() + polygon2.size(), Point(0.0, 0.0));
+    const size_t count = minkowski_sum(polygon1.data(), polygon1.size(), polygon2.data(), polygon2.size(), sum.data());
+    sum.resize(count, Point(0.0, 0.0));
+    return sum;
+}
+
+std::vector<Point> minkowski_difference(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2)
+{
+    // The reflection through the origin is a rotation by pi, so the vertices keep moving counterclockwise
+    ArenaScope scope;
+    const std::pmr::vector<Point> reflected = Minkowski::Reflected(polygon2, scope.Resource());
+    std::vector<Point> difference(polygon1.size() + reflected.size(), Point(0.0, 0.0));
+    const size_t count = minkowski_sum(polygon1.data(), polygon1.size(), reflected.data(), reflected.size(), difference.data());
+    difference.resize(count, Point(0.0, 0.0));
+    return difference;
+}
+
+std::vector<std::vector<Point>> minkowski_sum_batch(const std::vector<std::vector<Point>>& obstacles,
+                                                    const std::vector<Point>& shape,
+                                                    WorkStealingThreadPool& pool)
+{
+    return Minkowski::SumBatch(obstacles, shape.data(), shape.size(), pool);
+}
+
+std::vector<std::vector<Point>> minkowski_difference_batch(const std::vector<std::vector<Point>>& obstacles,
+                                                           const std::vector<Point>& shape,
+                                                           WorkStealingThreadPool& pool)
+{
+    ArenaScope scope;
+    const std::pmr::vector<Point> reflected = Minkowski::Reflected(shape, scope.Resource());
+    return Minkowski::SumBatch(obstacles, reflected.data(), reflected.size(), pool);
+}
+
+double minkowski_signed_distance(const std::vector<Point>& convexPolygon, Point& closestPoint)
+{
+    if (convexPolygon.size() < 3)
+        throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
+
+    double maximumLineDistance = -std::numeric_limits<double>::infinity();
+    Point lineFoot(0.0, 0.0);
+    double minimumSquaredDistance = std::numeric_limits<double>::infinity();
+    Point segmentClosestPoint(0.0, 0.0);
+    for (size_t vertexId = 0; vertexId < convexPolygon.size(); ++vertexId)
+    {
+        const Point& tail = convexPolygon[vertexId];
+        const Point& head = convexPolygon[(vertexId + 1 == convexPolygon.size()) ? 0 : vertexId + 1];
+        const Vector edge(tail, head);
+        const double squaredLength = DotProduct(edge, edge);
+        if (squaredLength == 0.0)
+            continue;
+
+        // Signed distance of the origin from the line of the edge, positive on the outer side
+        const double length = std::sqrt(squaredLength);
+        const Vector outwardNormal(edge.y / length, -edge.x / length);
+        const double lineDistance = -DotProduct(tail, outwardNormal);
+        if (lineDistance > maximumLineDistance)
+        {
+            maximumLineDistance = lineDistance;
+            lineFoot = Point(-lineDistance * outwardNormal.x, -lineDistance * outwardNormal.y);
+        }
+
+        // Point of the edge closest to the origin
+        const double t = std::min(1.0, std::max(0.0, -DotProduct(tail, edge) / squaredLength));
+        const Point point(tail.x + t * edge.x, tail.y + t * edge.y);
+        const double squaredDistance = DotProduct(point, point);
+        if (squaredDistance < minimumSquaredDistance)
+        {
+            minimumSquaredDistance = squaredDistance;
+            segmentClosestPoint = point;
+        }
+    }
+
+    // Inside a convex polygon the closest boundary point lies on the closest edge line
+    if (maximumLineDistance <= 0.0)
+    {
+        closestPoint = lineFoot;
+        return maximumLineDistance;
+    }
+
+    closestPoint = segmentClosestPoint;
+    return std::sqrt(minimumSquaredDistance);
+}
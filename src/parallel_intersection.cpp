@@ -0,0 +1,117 @@
+#include "polygon_operations/parallel_intersection.h"
+#include "polygon_operations/convex_polygon.h"
+
+namespace Parallel
+{
+    /// Number of chunks created per thread, so that stealing can balance mispredicted costs
+    const size_t chunksPerThread = 16;
+
+    /// Estimated cost of the separating axis test between polygons with n and m vertices
+    double PairCost(size_t n, size_t m)
+    {
+        return static_cast<double>(n + m) * static_cast<double>(n + m);
+    }
+
+    /*!
+     * Splits a sequence of items into contiguous chunks of similar total cost
+     * \param itemsNumber Number of items
+     * \param chunksNumber Wanted number of chunks
+     * \param cost Function returning the cost of an item
+     * \return The chunk boundaries, where chunk i contains the items from boundaries[i] to boundaries[i+1]
+     */
+    template<typename CostFunction>
+    std::vector<size_t> CostBalancedChunks(size_t itemsNumber, size_t chunksNumber, CostFunction cost)
+    {
+        double totalCost = 0.0;
+        for (size_t item = 0; item < itemsNumber; ++item)
+            totalCost += cost(item);
+
+        std::vector<size_t> boundaries(1, 0);
+        const double chunkCost = totalCost / chunksNumber;
+        double accumulatedCost = 0.0;
+        for (size_t item = 0; item < itemsNumber; ++item)
+        {
+            accumulatedCost += cost(item);
+            if ((accumulatedCost >= chunkCost * boundaries.size()) && (item + 1 < itemsNumber))
+                boundaries.push_back(item + 1);
+        }
+        boundaries.push_back(itemsNumber);
+
+        return boundaries;
+    }
+
+    /// Concatenates the buffers of the threads
+    std::vector<PolygonPair> Concatenate(const std::vector<std::vector<PolygonPair>>& threadPairs)
+    {
+        size_t pairsNumber = 0;
+        for (const auto& pairs : threadPairs)
+            pairsNumber += pairs.size();
+
+        std::vector<PolygonPair> intersectingPairs;
+        intersectingPairs.reserve(pairsNumber);
+        for (const auto& pairs : threadPairs)
+            intersectingPairs.insert(intersectingPairs.end(), pairs.begin(), pairs.end());
+
+        return intersectingPairs;
+    }
+}
+
+std::vector<PolygonPair> parallel_do_intersect(const std::vector<std::vector<Point>>& polygons,
+                                               const std::vector<PolygonPair>& candidatePairs,
+                                               WorkStealingThreadPool& pool)
+{
+    const std::vector<size_t> boundaries = Parallel::CostBalancedChunks(
+        candidatePairs.size(), pool.ThreadsNumber() * Parallel::chunksPerThread, [&](size_t pairId) {
+            return Parallel::PairCost(polygons[candidatePairs[pairId].first].size(), polygons[candidatePairs[pairId].second].size());
+        });
+
+    std::vector<std::vector<PolygonPair>> threadPairs(pool.ThreadsNumber());
+    pool.Run(boundaries.size() - 1, [&](size_t chunk, size_t threadId) {
+        std::vector<PolygonPair>& pairs = threadPairs[threadId];
+        for (size_t pairId = boundaries[chunk]; pairId < boundaries[chunk + 1]; ++pairId)
+        {
+            const PolygonPair& pair = candidatePairs[pairId];
+            if (do_intersect(polygons[pair.first], polygons[pair.second]))
+                pairs.push_back(pair);
+        }
+    });
+
+    return Parallel::Concatenate(threadPairs);
+}
+
+std::vector<PolygonPair> parallel_do_intersect(const std::vector<std::vector<Point>>& polygons1,
+                                               const std::vector<std::vector<Point>>& polygons2,
+                                               WorkStealingThreadPool& pool)
+{
+    // The cost of a polygon of the first set against the whole second set expands to
+    // sum (n + m_j)^2 = count * n^2 + 2 * n * sum m_j + sum m_j^2
+    double sizesSum = 0.0;
+    double squaredSizesSum = 0.0;
+    for (const auto& polygon : polygons2)
+    {
+        sizesSum += polygon.size();
+        squaredSizesSum += static_cast<double>(polygon.size()) * polygon.size();
+    }
+    const double count = static_cast<double>(polygons2.size());
+
+    const std::vector<size_t> boundaries = Parallel::CostBalancedChunks(
+        polygons1.size(), pool.ThreadsNumber() * Parallel::chunksPerThread, [&](size_t polygonId) {
+            const double n = static_cast<double>(polygons1[polygonId].size());
+            return count * n * n + 2.0 * n * sizesSum + squaredSizesSum;
+        });
+
+    std::vector<std::vector<PolygonPair>> threadPairs(pool.ThreadsNumber());
+    pool.Run(boundaries.size() - 1, [&](size_t chunk, size_t threadId) {
+        std::vector<PolygonPair>& pairs = threadPairs[threadId];
+        for (size_t id1 = boundaries[chunk]; id1 < boundaries[chunk + 1]; ++id1)
+        {
+            for (size_t id2 = 0; id2 < polygons2.size(); ++id2)
+            {
+                if (do_intersect(polygons1[id1], polygons2[id2]))
+                    pairs.emplace_back(id1, id2);
+            }
+        }
+    });
+
+    return Parallel::Concatenate(threadPairs);
+}
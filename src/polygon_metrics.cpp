@@ -0,0 +1,231 @@
+#include "polygon_operations/polygon_metrics.h"
+#include "polygon_operations/fixed_polygon.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace Metrics
+{
+    /// Number of tasks created per thread by the batch variant
+    const size_t tasksPerThread = 16;
+
+    static_assert(sizeof(Point) == 2 * sizeof(double), "The vertices are loaded as pairs of coordinates");
+
+    /// Sums over the edges, where c is the cross product of the endpoints of an edge
+    struct EdgeSums
+    {
+        double area = 0.0;      // sum c
+        double firstX = 0.0;    // sum (x0 + x1) c
+        double firstY = 0.0;    // sum (y0 + y1) c
+        double secondXX = 0.0;  // sum (x0^2 + x0 x1 + x1^2) c
+        double secondYY = 0.0;  // sum (y0^2 + y0 y1 + y1^2) c
+        double secondXY = 0.0;  // sum (x0 y1 + 2 x0 y0 + 2 x1 y1 + x1 y0) c
+        double perimeter = 0.0; // sum of the edge lengths
+    };
+
+    void AddEdge(double x0, double y0, double x1, double y1, EdgeSums& sums)
+    {
+        const double cross = x0 * y1 - x1 * y0;
+        sums.area += cross;
+        sums.firstX += (x0 + x1) * cross;
+        sums.firstY += (y0 + y1) * cross;
+        sums.secondXX += (x0 * x0 + x0 * x1 + x1 * x1) * cross;
+        sums.secondYY += (y0 * y0 + y0 * y1 + y1 * y1) * cross;
+        sums.secondXY += (x0 * y1 + 2.0 * x0 * y0 + 2.0 * x1 * y1 + x1 * y0) * cross;
+        sums.perimeter += std::sqrt((x1 - x0) * (x1 - x0) + (y1 - y0) * (y1 - y0));
+    }
+
+#if defined(__AVX__)
+    double HorizontalSum(__m256d values)
+    {
+        const __m128d pairs = _mm_add_pd(_mm256_castpd256_pd128(values), _mm256_extractf128_pd(values, 1));
+        return _mm_cvtsd_f64(_mm_add_sd(pairs, _mm_unpackhi_pd(pairs, pairs)));
+    }
+
+    /// Adds the edges not closing the polygon 4 at a time, returning the first edge left to the scalar loop
+    size_t AddEdges(const Point* polygon, size_t polygonSize, const Point& origin, EdgeSums& sums)
+    {
+        const double* coordinates = reinterpret_cast<const double*>(polygon);
+        const __m256d shift = _mm256_setr_pd(origin.x, origin.y, origin.x, origin.y);
+        __m256d area = _mm256_setzero_pd();
+        __m256d firstX = _mm256_setzero_pd();
+        __m256d firstY = _mm256_setzero_pd();
+        __m256d secondXX = _mm256_setzero_pd();
+        __m256d secondYY = _mm256_setzero_pd();
+        __m256d secondXY = _mm256_setzero_pd();
+        __m256d perimeter = _mm256_setzero_pd();
+        const __m256d two = _mm256_set1_pd(2.0);
+
+        size_t edgeId = 0;
+        for (; edgeId + 4 < polygonSize; edgeId += 4)
+        {
+            // The lanes hold the vertices (i, i + 2, i + 1, i + 3) and their successors in the same order
+            const __m256d tails01 = _mm256_sub_pd(_mm256_loadu_pd(coordinates + 2 * edgeId), shift);
+            const __m256d tails23 = _mm256_sub_pd(_mm256_loadu_pd(coordinates + 2 * edgeId + 4), shift);
+            const __m256d heads01 = _mm256_sub_pd(_mm256_loadu_pd(coordinates + 2 * edgeId + 2), shift);
+            const __m256d heads23 = _mm256_sub_pd(_mm256_loadu_pd(coordinates + 2 * edgeId + 6), shift);
+            const __m256d x0 = _mm256_unpacklo_pd(tails01, tails23);
+            const __m256d y0 = _mm256_unpackhi_pd(tails01, tails23);
+            const __m256d x1 = _mm256_unpacklo_pd(heads01, heads23);
+            const __m256d y1 = _mm256_unpackhi_pd(heads01, heads23);
+
+            const __m256d cross = _mm256_sub_pd(_mm256_mul_pd(x0, y1), _mm256_mul_pd(x1, y0));
+            area = _mm256_add_pd(area, cross);
+            firstX = _mm256_add_pd(firstX, _mm256_mul_pd(_mm256_add_pd(x0, x1), cross));
+            firstY = _mm256_add_pd(firstY, _mm256_mul_pd(_mm256_add_pd(y0, y1), cross));
+            const __m256d xx = _mm256_add_pd(_mm256_mul_pd(x0, _mm256_add_pd(x0, x1)), _mm256_mul_pd(x1, x1));
+            secondXX = _mm256_add_pd(secondXX, _mm256_mul_pd(xx, cross));
+            const __m256d yy = _mm256_add_pd(_mm256_mul_pd(y0, _mm256_add_pd(y0, y1)), _mm256_mul_pd(y1, y1));
+            secondYY = _mm256_add_pd(secondYY, _mm256_mul_pd(yy, cross));
+            const __m256d xy = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(x0, y1), _mm256_mul_pd(x1, y0)),
+                                             _mm256_mul_pd(two, _mm256_add_pd(_mm256_mul_pd(x0, y0), _mm256_mul_pd(x1, y1))));
+            secondXY = _mm256_add_pd(secondXY, _mm256_mul_pd(xy, cross));
+            const __m256d dx = _mm256_sub_pd(x1, x0);
+            const __m256d dy = _mm256_sub_pd(y1, y0);
+            perimeter = _mm256_add_pd(perimeter, _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy))));
+        }
+
+        sums.area += HorizontalSum(area);
+        sums.firstX += HorizontalSum(firstX);
+        sums.firstY += HorizontalSum(firstY);
+        sums.secondXX += HorizontalSum(secondXX);
+        sums.secondYY += HorizontalSum(secondYY);
+        sums.secondXY += HorizontalSum(secondXY);
+        sums.perimeter += HorizontalSum(perimeter);
+        return edgeId;
+    }
+#elif defined(__SSE2__)
+    double HorizontalSum(__m128d values)
+    {
+        return _mm_cvtsd_f64(_mm_add_sd(values, _mm_unpackhi_pd(values, values)));
+    }
+
+    /// Adds the edges not closing the polygon 2 at a time, returning the first edge left to the scalar loop
+    size_t AddEdges(const Point* polygon, size_t polygonSize, const Point& origin, EdgeSums& sums)
+    {
+        const double* coordinates = reinterpret_cast<const double*>(polygon);
+        const __m128d shift = _mm_setr_pd(origin.x, origin.y);
+        __m128d area = _mm_setzero_pd();
+        __m128d firstX = _mm_setzero_pd();
+        __m128d firstY = _mm_setzero_pd();
+        __m128d secondXX = _mm_setzero_pd();
+        __m128d secondYY = _mm_setzero_pd();
+        __m128d secondXY = _mm_setzero_pd();
+        __m128d perimeter = _mm_setzero_pd();
+        const __m128d two = _mm_set1_pd(2.0);
+
+        size_t edgeId = 0;
+        for (; edgeId + 2 < polygonSize; edgeId += 2)
+        {
+            const __m128d vertex0 = _mm_sub_pd(_mm_loadu_pd(coordinates + 2 * edgeId), shift);
+            const __m128d vertex1 = _mm_sub_pd(_mm_loadu_pd(coordinates + 2 * edgeId + 2), shift);
+            const __m128d vertex2 = _mm_sub_pd(_mm_loadu_pd(coordinates + 2 * edgeId + 4), shift);
+            const __m128d x0 = _mm_unpacklo_pd(vertex0, vertex1);
+            const __m128d y0 = _mm_unpackhi_pd(vertex0, vertex1);
+            const __m128d x1 = _mm_unpacklo_pd(vertex1, vertex2);
+            const __m128d y1 = _mm_unpackhi_pd(vertex1, vertex2);
+
+            const __m128d cross = _mm_sub_pd(_mm_mul_pd(x0, y1), _mm_mul_pd(x1, y0));
+            area = _mm_add_pd(area, cross);
+            firstX = _mm_add_pd(firstX, _mm_mul_pd(_mm_add_pd(x0, x1), cross));
+            firstY = _mm_add_pd(firstY, _mm_mul_pd(_mm_add_pd(y0, y1), cross));
+            const __m128d xx = _mm_add_pd(_mm_mul_pd(x0, _mm_add_pd(x0, x1)), _mm_mul_pd(x1, x1));
+            secondXX = _mm_add_pd(secondXX, _mm_mul_pd(xx, cross));
+            const __m128d yy = _mm_add_pd(_mm_mul_pd(y0, _mm_add_pd(y0, y1)), _mm_mul_pd(y1, y1));
+            secondYY = _mm_add_pd(secondYY, _mm_mul_pd(yy, cross));
+            const __m128d xy = _mm_add_pd(_mm_add_pd(_mm_mul_pd(x0, y1), _mm_mul_pd(x1, y0)),
+                                          _mm_mul_pd(two, _mm_add_pd(_mm_mul_pd(x0, y0), _mm_mul_pd(x1, y1))));
+            secondXY = _mm_add_pd(secondXY, _mm_mul_pd(xy, cross));
+            const __m128d dx = _mm_sub_pd(x1, x0);
+            const __m128d dy = _mm_sub_pd(y1, y0);
+            perimeter = _mm_add_pd(perimeter, _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy))));
+        }
+
+        sums.area += HorizontalSum(area);
+        sums.firstX += HorizontalSum(firstX);
+        sums.firstY += HorizontalSum(firstY);
+        sums.secondXX += HorizontalSum(secondXX);
+        sums.secondYY += HorizontalSum(secondYY);
+        sums.secondXY += HorizontalSum(secondXY);
+        sums.perimeter += HorizontalSum(perimeter);
+        return edgeId;
+    }
+#else
+    /// Without SIMD all the edges are left to the scalar loop
+    size_t AddEdges(const Point*, size_t, const Point&, EdgeSums&)
+    {
+        return 0;
+    }
+#endif
+}
+
+PolygonMetrics polygon_metrics(const Point* polygon, size_t polygonSize)
+{
+    // Triangles and quadrilaterals run the kernels expanded at compile time
+    if (polygonSize == 3)
+        return FixedPolygon::Metrics<3>(polygon, std::make_index_sequence<3>());
+    if (polygonSize == 4)
+        return FixedPolygon::Metrics<4>(polygon, std::make_index_sequence<4>());
+
+    PolygonMetrics metrics;
+    if (polygonSize == 0)
+        return metrics;
+
+    const Point origin = polygon[0];
+    Metrics::EdgeSums sums;
+    for (size_t edgeId = Metrics::AddEdges(polygon, polygonSize, origin, sums); edgeId < polygonSize; ++edgeId)
+    {
+        const Point& tail = polygon[edgeId];
+        const Point& head = polygon[(edgeId + 1 == polygonSize) ? 0 : edgeId + 1];
+        Metrics::AddEdge(tail.x - origin.x, tail.y - origin.y, head.x - origin.x, head.y - origin.y, sums);
+    }
+
+    metrics.area = sums.area / 2.0;
+    metrics.perimeter = sums.perimeter;
+    if (metrics.area == 0.0)
+    {
+        double sumX = 0.0;
+        double sumY = 0.0;
+        for (size_t vertexId = 0; vertexId < polygonSize; ++vertexId)
+        {
+            sumX += polygon[vertexId].x;
+            sumY += polygon[vertexId].y;
+        }
+        metrics.centroid = Point(sumX / polygonSize, sumY / polygonSize);
+        return metrics;
+    }
+
+    // Moments about the first vertex, moved to the centroid with the parallel axis theorem
+    const double centroidX = sums.firstX / (6.0 * metrics.area);
+    const double centroidY = sums.firstY / (6.0 * metrics.area);
+    metrics.centroid = Point(origin.x + centroidX, origin.y + centroidY);
+    metrics.momentXX = sums.secondXX / 12.0 - metrics.area * centroidX * centroidX;
+    metrics.momentYY = sums.secondYY / 12.0 - metrics.area * centroidY * centroidY;
+    metrics.momentXY = sums.secondXY / 24.0 - metrics.area * centroidX * centroidY;
+    return metrics;
+}
+
+PolygonMetrics polygon_metrics(const std::vector<Point>& polygon)
+{
+    return polygon_metrics(polygon.data(), polygon.size());
+}
+
+std::vector<PolygonMetrics> polygon_metrics_batch(const PolygonBatch& polygons, WorkStealingThreadPool& pool)
+{
+    const size_t polygonsNumber = polygons.Size();
+    std::vector<PolygonMetrics> metrics(polygonsNumber);
+    if (polygonsNumber == 0)
+        return metrics;
+
+    const size_t tasksNumber = std::min(polygonsNumber, pool.ThreadsNumber() * Metrics::tasksPerThread);
+    pool.Run(tasksNumber, [&](size_t task, size_t) {
+        const size_t lastPolygon = polygonsNumber * (task + 1) / tasksNumber;
+        for (size_t polygonId = polygonsNumber * task / tasksNumber; polygonId < lastPolygon; ++polygonId)
+            metrics[polygonId] = polygon_metrics(polygons.Polygon(polygonId), polygons.PolygonSize(polygonId));
+    });
+
+    return metrics;
+}
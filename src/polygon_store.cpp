@@ -0,0 +1,362 @@
+#include "polygon_operations/polygon_store.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define POLYGON_STORE_MMAP
+#endif
+
+// The sections of doubles are viewed as points and boxes without copying
+static_assert(sizeof(Point) == 2 * sizeof(double) && std::is_standard_layout<Point>::value,
+              "Point must have the layout of two doubles");
+static_assert(sizeof(BoundingBox) == 4 * sizeof(double) && std::is_standard_layout<BoundingBox>::value,
+              "BoundingBox must have the layout of four doubles");
+
+namespace Store
+{
+    const char magic[8] = {'P', 'O', 'L', 'Y', 'S', 'T', 'O', 'R'};
+
+    /// Header at the start of the file
+    struct Header
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t flags;
+        uint64_t polygonsNumber;
+        uint64_t verticesNumber;
+        uint64_t offsetsOffset;
+        uint64_t verticesOffset;
+        uint64_t boxesOffset;
+        uint64_t normalsOffset;
+    };
+    static_assert(sizeof(Header) == PolygonStoreFormat::alignment, "The header must fill one aligned block");
+
+    bool HostIsLittleEndian()
+    {
+        const uint16_t value = 1;
+        unsigned char firstByte = 0;
+        std::memcpy(&firstByte, &value, 1);
+        return firstByte == 1;
+    }
+
+    uint64_t AlignUp(uint64_t offset)
+    {
+        return (offset + PolygonStoreFormat::alignment - 1) / PolygonStoreFormat::alignment * PolygonStoreFormat::alignment;
+    }
+
+    /// Writes zeros up to the next aligned offset
+    void Pad(std::ofstream& file, uint64_t& offset)
+    {
+        static const char zeros[PolygonStoreFormat::alignment] = {};
+        const uint64_t aligned = AlignUp(offset);
+        file.write(zeros, static_cast<std::streamsize>(aligned - offset));
+        offset = aligned;
+    }
+
+    template<class T>
+    void Write(std::ofstream& file, uint64_t& offset, const T* values, size_t valuesNumber)
+    {
+        file.write(reinterpret_cast<const char*>(values), static_cast<std::streamsize>(valuesNumber * sizeof(T)));
+        offset += valuesNumber * sizeof(T);
+    }
+
+    /// Path of the temporary file written next to the store, unique to the writing process
+    std::string TemporaryPath(const std::string& path)
+    {
+#if defined(POLYGON_STORE_MMAP)
+        return path + ".tmp." + std::to_string(getpid());
+#else
+        return path + ".tmp";
+#endif
+    }
+
+    /// Forces the contents of a written file to the disk, so that it is complete before it is renamed
+    bool Sync(const std::string& path)
+    {
+#if defined(POLYGON_STORE_MMAP)
+        const int descriptor = open(path.c_str(), O_WRONLY);
+        if (descriptor < 0)
+            return false;
+        const bool synced = (fsync(descriptor) == 0);
+        return (close(descriptor) == 0) && synced;
+#else
+        (void)path;
+        return true;
+#endif
+    }
+
+    /// Writes the header and the sections of a polygon store
+    void WriteSections(std::ofstream& file, const Header& header, const PolygonBatch& batch, const PolygonStoreOptions& options)
+    {
+        uint64_t offset = 0;
+        Write(file, offset, &header, 1);
+
+        const std::vector<uint64_t> offsets(batch.offsets.begin(), batch.offsets.end());
+        Write(file, offset, offsets.data(), offsets.size());
+        Pad(file, offset);
+        Write(file, offset, batch.vertices.data(), batch.vertices.size());
+        Pad(file, offset);
+
+        if (options.boundingBoxes)
+        {
+            // Empty polygons get an empty box, which overlaps no other box
+            const double infinity = std::numeric_limits<double>::infinity();
+            std::vector<BoundingBox> boxes(batch.Size(), BoundingBox{infinity, infinity, -infinity, -infinity});
+            for (size_t polygonId = 0; polygonId < batch.Size(); ++polygonId)
+            {
+                const Point* polygon = batch.Polygon(polygonId);
+                for (size_t vertexId = 0; vertexId < batch.PolygonSize(polygonId); ++vertexId)
+                {
+                    boxes[polygonId].minX = std::min(boxes[polygonId].minX, polygon[vertexId].x);
+                    boxes[polygonId].minY = std::min(boxes[polygonId].minY, polygon[vertexId].y);
+                    boxes[polygonId].maxX = std::max(boxes[polygonId].maxX, polygon[vertexId].x);
+                    boxes[polygonId].maxY = std::max(boxes[polygonId].maxY, polygon[vertexId].y);
+                }
+            }
+            Write(file, offset, boxes.data(), boxes.size());
+            Pad(file, offset);
+        }
+
+        if (options.edgeNormals)
+        {
+            std::vector<Point> normals = {};
+            normals.reserve(batch.vertices.size());
+            for (size_t polygonId = 0; polygonId < batch.Size(); ++polygonId)
+            {
+                const Point* polygon = batch.Polygon(polygonId);
+                const size_t polygonSize = batch.PolygonSize(polygonId);
+                for (size_t vertexId = 0; vertexId < polygonSize; ++vertexId)
+                {
+                    const Point& tail = polygon[vertexId];
+                    const Point& head = polygon[(vertexId + 1) % polygonSize];
+                    normals.emplace_back(Point(tail.y - head.y, head.x - tail.x));
+                }
+            }
+            Write(file, offset, normals.data(), normals.size());
+            Pad(file, offset);
+        }
+    }
+
+    /// Whether a section of a number of elements of a size fits inside the file at an aligned offset
+    bool SectionFits(uint64_t sectionOffset, uint64_t elementsNumber, uint64_t elementSize, uint64_t fileSize)
+    {
+        if ((sectionOffset < sizeof(Header)) || (sectionOffset % PolygonStoreFormat::alignment != 0) || (sectionOffset > fileSize))
+            return false;
+        return elementsNumber <= (fileSize - sectionOffset) / elementSize;
+    }
+}
+
+void write_polygon_store(const std::string& path, const PolygonBatch& batch, const PolygonStoreOptions& options)
+{
+    if (!Store::HostIsLittleEndian())
+        throw std::invalid_argument("Attempted to write a polygon store on a big-endian host");
+
+    Store::Header header = {};
+    std::memcpy(header.magic, Store::magic, sizeof(Store::magic));
+    header.version = PolygonStoreFormat::version;
+    header.flags = (options.boundingBoxes ? PolygonStoreFormat::hasBoundingBoxes : 0) |
+                   (options.edgeNormals ? PolygonStoreFormat::hasEdgeNormals : 0);
+    header.polygonsNumber = batch.Size();
+    header.verticesNumber = batch.vertices.size();
+    header.offsetsOffset = sizeof(Store::Header);
+    header.verticesOffset = Store::AlignUp(header.offsetsOffset + (header.polygonsNumber + 1) * sizeof(uint64_t));
+    uint64_t end = Store::AlignUp(header.verticesOffset + header.verticesNumber * sizeof(Point));
+    if (options.boundingBoxes)
+    {
+        header.boxesOffset = end;
+        end = Store::AlignUp(end + header.polygonsNumber * sizeof(BoundingBox));
+    }
+    if (options.edgeNormals)
+        header.normalsOffset = end;
+
+    // The store is written next to the file and renamed over it once complete, so that a reader
+    // never maps a partially written store and a failed write leaves the previous file intact
+    const std::string temporaryPath = Store::TemporaryPath(path);
+    std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+    if (!file)
+        throw std::runtime_error("Attempted to write a polygon store to a file that cannot be opened: " + path);
+
+    try
+    {
+        Store::WriteSections(file, header, batch, options);
+    }
+    catch (...)
+    {
+        file.close();
+        std::remove(temporaryPath.c_str());
+        throw;
+    }
+    file.close();
+    if (!file || !Store::Sync(temporaryPath))
+    {
+        std::remove(temporaryPath.c_str());
+        throw std::runtime_error("Attempted to write a polygon store that could not be written completely: " + path);
+    }
+    if (std::rename(temporaryPath.c_str(), path.c_str()) != 0)
+    {
+        std::remove(temporaryPath.c_str());
+        throw std::runtime_error("Attempted to write a polygon store that could not replace the file: " + path);
+    }
+}
+
+PolygonStore::PolygonStore(const std::string& path)
+{
+    if (!Store::HostIsLittleEndian())
+        throw std::invalid_argument("Attempted to open a polygon store on a big-endian host");
+
+#if defined(POLYGON_STORE_MMAP)
+    const int descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor < 0)
+        throw std::runtime_error("Attempted to open a polygon store from a file that cannot be opened: " + path);
+    struct stat status;
+    if (fstat(descriptor, &status) != 0)
+    {
+        close(descriptor);
+        throw std::runtime_error("Attempted to open a polygon store from a file that cannot be read: " + path);
+    }
+    mappingSize = static_cast<size_t>(status.st_size);
+    if (mappingSize >= sizeof(Store::Header))
+    {
+        mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, descriptor, 0);
+        if (mapping == MAP_FAILED)
+            mapping = nullptr;
+    }
+    // The mapping stays valid after the descriptor is closed
+    close(descriptor);
+    if ((mapping == nullptr) && (mappingSize >= sizeof(Store::Header)))
+        throw std::runtime_error("Attempted to open a polygon store from a file that cannot be mapped: " + path);
+#else
+    // Without mmap the file is read into memory aligned as the sections
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+        throw std::runtime_error("Attempted to open a polygon store from a file that cannot be opened: " + path);
+    mappingSize = static_cast<size_t>(file.tellg());
+    if (mappingSize >= sizeof(Store::Header))
+    {
+        mapping = ::operator new(mappingSize, std::align_val_t(PolygonStoreFormat::alignment));
+        file.seekg(0);
+        if (!file.read(static_cast<char*>(mapping), static_cast<std::streamsize>(mappingSize)))
+        {
+            Close();
+            throw std::runtime_error("Attempted to open a polygon store from a file that cannot be read: " + path);
+        }
+    }
+#endif
+
+    if (mappingSize < sizeof(Store::Header))
+    {
+        Close();
+        throw std::invalid_argument("Attempted to open a polygon store from a file shorter than its header: " + path);
+    }
+
+    const char* bytes = static_cast<const char*>(mapping);
+    Store::Header header;
+    std::memcpy(&header, bytes, sizeof(header));
+    const char* error = nullptr;
+    if (std::memcmp(header.magic, Store::magic, sizeof(Store::magic)) != 0)
+        error = "Attempted to open a file that is not a polygon store: ";
+    else if (header.version != PolygonStoreFormat::version)
+        error = "Attempted to open a polygon store of an unsupported version: ";
+    else if ((header.polygonsNumber >= mappingSize) ||
+             !Store::SectionFits(header.offsetsOffset, header.polygonsNumber + 1, sizeof(uint64_t), mappingSize) ||
+             !Store::SectionFits(header.verticesOffset, header.verticesNumber, sizeof(Point), mappingSize) ||
+             ((header.flags & PolygonStoreFormat::hasBoundingBoxes) &&
+              !Store::SectionFits(header.boxesOffset, header.polygonsNumber, sizeof(BoundingBox), mappingSize)) ||
+             ((header.flags & PolygonStoreFormat::hasEdgeNormals) &&
+              !Store::SectionFits(header.normalsOffset, header.verticesNumber, sizeof(Point), mappingSize)))
+        error = "Attempted to open a polygon store with a section outside the file: ";
+    else
+    {
+        offsets = reinterpret_cast<const uint64_t*>(bytes + header.offsetsOffset);
+        // Only the ends of the offsets are checked, so that opening does not read the whole section (see Validate)
+        if ((offsets[0] != 0) || (offsets[header.polygonsNumber] != header.verticesNumber))
+            error = "Attempted to open a polygon store whose offsets do not match its vertices: ";
+    }
+    if (error != nullptr)
+    {
+        Close();
+        throw std::invalid_argument(error + path);
+    }
+
+    polygonsNumber = header.polygonsNumber;
+    verticesNumber = header.verticesNumber;
+    vertices = reinterpret_cast<const Point*>(bytes + header.verticesOffset);
+    if (header.flags & PolygonStoreFormat::hasBoundingBoxes)
+        boxes = reinterpret_cast<const BoundingBox*>(bytes + header.boxesOffset);
+    if (header.flags & PolygonStoreFormat::hasEdgeNormals)
+        normals = reinterpret_cast<const Point*>(bytes + header.normalsOffset);
+}
+
+PolygonStore::~PolygonStore()
+{
+    Close();
+}
+
+PolygonStore::PolygonStore(PolygonStore&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+PolygonStore& PolygonStore::operator=(PolygonStore&& other) noexcept
+{
+    if (this != &other)
+    {
+        Close();
+        std::swap(mapping, other.mapping);
+        std::swap(mappingSize, other.mappingSize);
+        std::swap(polygonsNumber, other.polygonsNumber);
+        std::swap(verticesNumber, other.verticesNumber);
+        std::swap(offsets, other.offsets);
+        std::swap(vertices, other.vertices);
+        std::swap(boxes, other.boxes);
+        std::swap(normals, other.normals);
+    }
+    return *this;
+}
+
+void PolygonStore::Validate() const
+{
+    for (size_t polygonId = 0; polygonId < polygonsNumber; ++polygonId)
+    {
+        if ((offsets[polygonId] > offsets[polygonId + 1]) || (offsets[polygonId + 1] > verticesNumber))
+            throw std::invalid_argument("Attempted to use a polygon store whose offsets are not increasing within its vertices");
+    }
+}
+
+PolygonBatch PolygonStore::ToBatch(std::pmr::memory_resource* resource) const
+{
+    PolygonBatch batch(resource);
+    batch.vertices.assign(vertices, vertices + verticesNumber);
+    batch.offsets.assign(offsets, offsets + polygonsNumber + 1);
+    return batch;
+}
+
+void PolygonStore::Close()
+{
+    if (mapping != nullptr)
+    {
+#if defined(POLYGON_STORE_MMAP)
+        munmap(mapping, mappingSize);
+#else
+        ::operator delete(mapping, std::align_val_t(PolygonStoreFormat::alignment));
+#endif
+    }
+    mapping = nullptr;
+    mappingSize = 0;
+    polygonsNumber = 0;
+    verticesNumber = 0;
+    offsets = nullptr;
+    vertices = nullptr;
+    boxes = nullptr;
+    normals = nullptr;
+}
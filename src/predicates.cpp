@@ -0,0 +1,296 @@
+#include "polygon_operations/predicates.h"
+#include <cmath>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// The SIMD loops load the coordinates of consecutive points as a flat array of doubles
+static_assert(sizeof(Point) == 2 * sizeof(double), "Point is expected to hold exactly two doubles");
+
+namespace Predicates
+{
+    /// Product of two doubles as the sum of the rounded product and its exact rounding error
+    void TwoProduct(double a, double b, double& product, double& error)
+    {
+        product = a * b;
+        error = std::fma(a, b, -product);
+    }
+
+    /// Sum of two doubles as the sum of the rounded sum and its exact rounding error
+    void TwoSum(double a, double b, double& sum, double& error)
+    {
+        sum = a + b;
+        const double bVirtual = sum - a;
+        const double aVirtual = sum - bVirtual;
+        error = (a - aVirtual) + (b - bVirtual);
+    }
+
+    /// Unit roundoff 2^-24 of float arithmetic
+    const float floatEpsilon = std::numeric_limits<float>::epsilon() / 2.0f;
+
+    /// Relative error bound of the float determinant, including the rounding of the differences to float
+    const float floatErrorBound = (4.0f + 64.0f * floatEpsilon) * floatEpsilon;
+
+    /// Absolute error bound per unit of edge length covering the underflow of the float differences and products
+    const double floatUnderflowBound = std::ldexp(1.0, -120);
+
+    /*!
+     * Float differences of the edge from a to b and the absolute term of the error bound of the
+     * float determinant. The float filter is disabled by an infinite absolute term when the
+     * differences are not normal floats, e.g. for overflowing or subnormal coordinates.
+     */
+    struct FloatEdge
+    {
+        float x;
+        float y;
+        float absoluteBound;
+
+        FloatEdge(const Point& a, const Point& b)
+            : x(static_cast<float>(b.x - a.x)), y(static_cast<float>(b.y - a.y)),
+              absoluteBound(static_cast<float>(floatUnderflowBound * (1.0 + std::fabs(x) + std::fabs(y))))
+        {
+            const bool normalX = (x == 0.0f) ? (b.x == a.x) : std::isnormal(x);
+            const bool normalY = (y == 0.0f) ? (b.y == a.y) : std::isnormal(y);
+            if (!normalX || !normalY)
+                absoluteBound = std::numeric_limits<float>::infinity();
+        }
+    };
+
+    /// Float determinant of the point relative to the edge and whether its sign is certified
+    bool FloatOrientation(const Point& a, const FloatEdge& edge, const Point& point, float& determinant)
+    {
+        const float pointX = static_cast<float>(point.x - a.x);
+        const float pointY = static_cast<float>(point.y - a.y);
+        const float left = edge.x * pointY;
+        const float right = pointX * edge.y;
+        determinant = left - right;
+        return std::fabs(determinant) > floatErrorBound * (std::fabs(left) + std::fabs(right)) + edge.absoluteBound;
+    }
+
+    signed char Sign(double value)
+    {
+        return (value > 0.0) - (value < 0.0);
+    }
+
+#if defined(__AVX__) || defined(__SSE2__)
+    /// Bytes of the signs 1 and -1 of 8 lanes for each mask of the positive lanes
+    struct SignBytes
+    {
+        static const std::array<uint64_t, 256> table;
+
+        static std::array<uint64_t, 256> Build()
+        {
+            std::array<uint64_t, 256> bytes = {};
+            for (size_t mask = 0; mask < 256; ++mask)
+            {
+                signed char signs[8];
+                for (size_t lane = 0; lane < 8; ++lane)
+                    signs[lane] = ((mask >> lane) & 1) ? 1 : -1;
+                std::memcpy(&bytes[mask], signs, 8);
+            }
+            return bytes;
+        }
+    };
+    const std::array<uint64_t, 256> SignBytes::table = SignBytes::Build();
+#endif
+
+#if defined(__AVX__)
+    /// Float signs of 8 points per iteration, listing the uncertified ones, and return the number of points processed
+    size_t FloatSignsSimd(const Point& a, const FloatEdge& edge, const Point* points, size_t pointsNumber,
+                          signed char* signs, size_t* uncertified, size_t& uncertifiedNumber)
+    {
+        const __m256d origin = _mm256_setr_pd(a.x, a.y, a.x, a.y);
+        const __m256 edgeX = _mm256_set1_ps(edge.x);
+        const __m256 edgeY = _mm256_set1_ps(edge.y);
+        const __m256 relativeBound = _mm256_set1_ps(floatErrorBound);
+        const __m256 absoluteBound = _mm256_set1_ps(edge.absoluteBound);
+        const __m256 signMask = _mm256_set1_ps(-0.0f);
+        const __m256 zero = _mm256_setzero_ps();
+
+        size_t index = 0;
+        for (; index + 8 <= pointsNumber; index += 8)
+        {
+            // Differences in double rounded to float
+            const double* coordinates = &points[index].x;
+            const __m128 points01 = _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(coordinates), origin));       // x0 y0 x1 y1
+            const __m128 points23 = _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(coordinates + 4), origin));   // x2 y2 x3 y3
+            const __m128 points45 = _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(coordinates + 8), origin));   // x4 y4 x5 y5
+            const __m128 points67 = _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(coordinates + 12), origin));  // x6 y6 x7 y7
+            const __m256 xs = _mm256_set_m128(_mm_shuffle_ps(points45, points67, _MM_SHUFFLE(2, 0, 2, 0)),
+                                              _mm_shuffle_ps(points01, points23, _MM_SHUFFLE(2, 0, 2, 0)));
+            const __m256 ys = _mm256_set_m128(_mm_shuffle_ps(points45, points67, _MM_SHUFFLE(3, 1, 3, 1)),
+                                              _mm_shuffle_ps(points01, points23, _MM_SHUFFLE(3, 1, 3, 1)));
+
+            const __m256 left = _mm256_mul_ps(edgeX, ys);
+            const __m256 right = _mm256_mul_ps(xs, edgeY);
+            const __m256 determinants = _mm256_sub_ps(left, right);
+            const __m256 magnitudes = _mm256_add_ps(_mm256_andnot_ps(signMask, left), _mm256_andnot_ps(signMask, right));
+            const __m256 bounds = _mm256_add_ps(_mm256_mul_ps(relativeBound, magnitudes), absoluteBound);
+            const int certifiedMask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_andnot_ps(signMask, determinants), bounds, _CMP_GT_OQ));
+            const int positiveMask = _mm256_movemask_ps(_mm256_cmp_ps(determinants, zero, _CMP_GT_OQ));
+            std::memcpy(signs + index, &SignBytes::table[positiveMask], 8);
+            for (int mask = ~certifiedMask & 0xFF; mask != 0; mask &= mask - 1)
+                uncertified[uncertifiedNumber++] = index + __builtin_ctz(mask);
+        }
+        return index;
+    }
+#elif defined(__SSE2__)
+    /// Float signs of 4 points per iteration, listing the uncertified ones, and return the number of points processed
+    size_t FloatSignsSimd(const Point& a, const FloatEdge& edge, const Point* points, size_t pointsNumber,
+                          signed char* signs, size_t* uncertified, size_t& uncertifiedNumber)
+    {
+        const __m128d origin = _mm_setr_pd(a.x, a.y);
+        const __m128 edgeX = _mm_set1_ps(edge.x);
+        const __m128 edgeY = _mm_set1_ps(edge.y);
+        const __m128 relativeBound = _mm_set1_ps(floatErrorBound);
+        const __m128 absoluteBound = _mm_set1_ps(edge.absoluteBound);
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        const __m128 zero = _mm_setzero_ps();
+
+        size_t index = 0;
+        for (; index + 4 <= pointsNumber; index += 4)
+        {
+            // Differences in double rounded to float
+            const double* coordinates = &points[index].x;
+            const __m128 points01 = _mm_movelh_ps(_mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(coordinates), origin)),
+                                                  _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(coordinates + 2), origin)));  // x0 y0 x1 y1
+            const __m128 points23 = _mm_movelh_ps(_mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(coordinates + 4), origin)),
+                                                  _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(coordinates + 6), origin)));  // x2 y2 x3 y3
+            const __m128 xs = _mm_shuffle_ps(points01, points23, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m128 ys = _mm_shuffle_ps(points01, points23, _MM_SHUFFLE(3, 1, 3, 1));
+
+            const __m128 left = _mm_mul_ps(edgeX, ys);
+            const __m128 right = _mm_mul_ps(xs, edgeY);
+            const __m128 determinants = _mm_sub_ps(left, right);
+            const __m128 magnitudes = _mm_add_ps(_mm_andnot_ps(signMask, left), _mm_andnot_ps(signMask, right));
+            const __m128 bounds = _mm_add_ps(_mm_mul_ps(relativeBound, magnitudes), absoluteBound);
+            const int certifiedMask = _mm_movemask_ps(_mm_cmpgt_ps(_mm_andnot_ps(signMask, determinants), bounds));
+            const int positiveMask = _mm_movemask_ps(_mm_cmpgt_ps(determinants, zero));
+            std::memcpy(signs + index, &SignBytes::table[positiveMask], 4);
+            for (int mask = ~certifiedMask & 0xF; mask != 0; mask &= mask - 1)
+                uncertified[uncertifiedNumber++] = index + __builtin_ctz(mask);
+        }
+        return index;
+    }
+#endif
+
+    /// Signs with the mixed precision predicate, re-evaluating the points not certified in float
+    size_t MixedPrecisionSigns(const Point& a, const Point& b, const Point* points, size_t pointsNumber, signed char* signs)
+    {
+        const FloatEdge edge(a, b);
+        // Block of points whose uncertified indices live on the stack
+        const size_t blockSize = 256;
+        size_t uncertified[blockSize];
+        size_t fallbacks = 0;
+        for (size_t first = 0; first < pointsNumber; first += blockSize)
+        {
+            const size_t blockPoints = std::min(blockSize, pointsNumber - first);
+            size_t uncertifiedNumber = 0;
+            size_t index = 0;
+#if defined(__AVX__) || defined(__SSE2__)
+            index = FloatSignsSimd(a, edge, points + first, blockPoints, signs + first, uncertified, uncertifiedNumber);
+#endif
+            for (; index < blockPoints; ++index)
+            {
+                float determinant = 0.0f;
+                if (FloatOrientation(a, edge, points[first + index], determinant))
+                    signs[first + index] = (determinant > 0.0f) ? 1 : -1;
+                else
+                    uncertified[uncertifiedNumber++] = index;
+            }
+            for (size_t uncertifiedId = 0; uncertifiedId < uncertifiedNumber; ++uncertifiedId)
+            {
+                const size_t pointId = first + uncertified[uncertifiedId];
+                signs[pointId] = Sign(orient2d_adaptive(a, b, points[pointId]));
+            }
+            fallbacks += uncertifiedNumber;
+        }
+        return fallbacks;
+    }
+
+    /*!
+     * Adds a double to a nonoverlapping expansion sorted by increasing magnitude in place,
+     * dropping the zero components (Shewchuk's GROW-EXPANSION with zero elimination)
+     * \return The new number of components
+     */
+    size_t GrowExpansion(double* expansion, size_t expansionSize, double value)
+    {
+        size_t size = 0;
+        double sum = value;
+        for (size_t componentId = 0; componentId < expansionSize; ++componentId)
+        {
+            double error = 0.0;
+            TwoSum(sum, expansion[componentId], sum, error);
+            if (error != 0.0)
+                expansion[size++] = error;
+        }
+        if ((sum != 0.0) || (size == 0))
+            expansion[size++] = sum;
+        return size;
+    }
+}
+
+double orient2d_exact(const Point& a, const Point& b, const Point& c)
+{
+    // When the differences relative to c are exact, as for nearby points, the two products suffice
+    double acx = 0.0, acy = 0.0, bcx = 0.0, bcy = 0.0;
+    double acxError = 0.0, acyError = 0.0, bcxError = 0.0, bcyError = 0.0;
+    Predicates::TwoSum(a.x, -c.x, acx, acxError);
+    Predicates::TwoSum(a.y, -c.y, acy, acyError);
+    Predicates::TwoSum(b.x, -c.x, bcx, bcxError);
+    Predicates::TwoSum(b.y, -c.y, bcy, bcyError);
+    if ((acxError == 0.0) && (acyError == 0.0) && (bcxError == 0.0) && (bcyError == 0.0))
+    {
+        double expansion[5] = {};
+        size_t expansionSize = 0;
+        double product = 0.0;
+        double error = 0.0;
+        Predicates::TwoProduct(acx, bcy, product, error);
+        expansionSize = Predicates::GrowExpansion(expansion, expansionSize, error);
+        expansionSize = Predicates::GrowExpansion(expansion, expansionSize, product);
+        Predicates::TwoProduct(-acy, bcx, product, error);
+        expansionSize = Predicates::GrowExpansion(expansion, expansionSize, error);
+        expansionSize = Predicates::GrowExpansion(expansion, expansionSize, product);
+        return expansion[expansionSize - 1];
+    }
+
+    // (b - a) x (c - a) = bx cy - bx ay - ax cy - cx by + cx ay + ax by
+    const double factors[6][2] = {{b.x, c.y}, {-b.x, a.y}, {-a.x, c.y}, {-c.x, b.y}, {c.x, a.y}, {a.x, b.y}};
+    double expansion[13] = {};
+    size_t expansionSize = 0;
+    for (const auto& factor : factors)
+    {
+        double product = 0.0;
+        double error = 0.0;
+        Predicates::TwoProduct(factor[0], factor[1], product, error);
+        expansionSize = Predicates::GrowExpansion(expansion, expansionSize, error);
+        expansionSize = Predicates::GrowExpansion(expansion, expansionSize, product);
+    }
+    return expansion[expansionSize - 1];
+}
+
+size_t orient2d_signs(const Point& a, const Point& b, const Point* points, size_t pointsNumber, signed char* signs,
+                      OrientationPredicate predicate)
+{
+    if (predicate == OrientationPredicate::MixedPrecision)
+        return Predicates::MixedPrecisionSigns(a, b, points, pointsNumber, signs);
+
+    size_t fallbacks = 0;
+    for (size_t index = 0; index < pointsNumber; ++index)
+    {
+        double determinant = orient2d_fast(a, b, points[index]);
+        if ((predicate == OrientationPredicate::Adaptive) && !orient2d_filter(a, b, points[index], determinant))
+        {
+            determinant = orient2d_exact(a, b, points[index]);
+            ++fallbacks;
+        }
+        signs[index] = Predicates::Sign(determinant);
+    }
+    return fallbacks;
+}
@@ -0,0 +1,264 @@
+#include "polygon_operations/rotated_box.h"
+#include "polygon_operations/arena.h"
+#include "polygon_operations/convex_intersection.h"
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace RotatedBox
+{
+    /// Number of tasks created per thread for the rows of the IoU matrix
+    const size_t tasksPerThread = 16;
+
+    /// Corners, bounding boxes and areas of a set of boxes in structure-of-arrays layout
+    struct PreparedBoxes
+    {
+        /// Coordinates of the four corners of every box moving counterclockwise
+        std::vector<double> cornerX;
+        std::vector<double> cornerY;
+        std::vector<double> minX;
+        std::vector<double> minY;
+        std::vector<double> maxX;
+        std::vector<double> maxY;
+        std::vector<double> area;
+
+        size_t Size() const { return area.size(); }
+
+        void Append(double centerX, double centerY, double width, double height, double angle)
+        {
+            // Half sides along the rotated axes
+            const double cosine = std::cos(angle);
+            const double sine = std::sin(angle);
+            const double halfWidthX = 0.5 * width * cosine;
+            const double halfWidthY = 0.5 * width * sine;
+            const double halfHeightX = -0.5 * height * sine;
+            const double halfHeightY = 0.5 * height * cosine;
+
+            const double xs[4] = {centerX - halfWidthX - halfHeightX, centerX + halfWidthX - halfHeightX,
+                                  centerX + halfWidthX + halfHeightX, centerX - halfWidthX + halfHeightX};
+            const double ys[4] = {centerY - halfWidthY - halfHeightY, centerY + halfWidthY - halfHeightY,
+                                  centerY + halfWidthY + halfHeightY, centerY - halfWidthY + halfHeightY};
+            cornerX.insert(cornerX.end(), xs, xs + 4);
+            cornerY.insert(cornerY.end(), ys, ys + 4);
+            minX.push_back(std::min(std::min(xs[0], xs[1]), std::min(xs[2], xs[3])));
+            minY.push_back(std::min(std::min(ys[0], ys[1]), std::min(ys[2], ys[3])));
+            maxX.push_back(std::max(std::max(xs[0], xs[1]), std::max(xs[2], xs[3])));
+            maxY.push_back(std::max(std::max(ys[0], ys[1]), std::max(ys[2], ys[3])));
+            area.push_back(((width > 0.0) && (height > 0.0)) ? width * height : 0.0);
+        }
+
+        void Append(const PreparedBoxes& source, size_t boxId)
+        {
+            cornerX.insert(cornerX.end(), source.cornerX.begin() + 4 * boxId, source.cornerX.begin() + 4 * boxId + 4);
+            cornerY.insert(cornerY.end(), source.cornerY.begin() + 4 * boxId, source.cornerY.begin() + 4 * boxId + 4);
+            minX.push_back(source.minX[boxId]);
+            minY.push_back(source.minY[boxId]);
+            maxX.push_back(source.maxX[boxId]);
+            maxY.push_back(source.maxY[boxId]);
+            area.push_back(source.area[boxId]);
+        }
+    };
+
+    PreparedBoxes Prepare(const RotatedBoxes& boxes)
+    {
+        const size_t boxesNumber = boxes.Size();
+        PreparedBoxes prepared;
+        prepared.cornerX.reserve(4 * boxesNumber);
+        prepared.cornerY.reserve(4 * boxesNumber);
+        for (size_t boxId = 0; boxId < boxesNumber; ++boxId)
+            prepared.Append(boxes.centerX[boxId], boxes.centerY[boxId], boxes.width[boxId], boxes.height[boxId], boxes.angle[boxId]);
+        return prepared;
+    }
+
+    bool BoundingBoxesOverlap(const PreparedBoxes& boxes1, size_t boxId1, const PreparedBoxes& boxes2, size_t boxId2)
+    {
+        return (boxes1.minX[boxId1] <= boxes2.maxX[boxId2]) && (boxes2.minX[boxId2] <= boxes1.maxX[boxId1]) &&
+               (boxes1.minY[boxId1] <= boxes2.maxY[boxId2]) && (boxes2.minY[boxId2] <= boxes1.maxY[boxId1]);
+    }
+
+#if defined(__AVX__)
+    /// Bit mask of the boxes [first, first + 4) whose bounding box overlaps the bounding box of another box
+    unsigned OverlapMask(const PreparedBoxes& boxes, size_t first, const PreparedBoxes& others, size_t otherId)
+    {
+        const __m256d overlapX = _mm256_and_pd(
+            _mm256_cmp_pd(_mm256_loadu_pd(&boxes.minX[first]), _mm256_set1_pd(others.maxX[otherId]), _CMP_LE_OQ),
+            _mm256_cmp_pd(_mm256_set1_pd(others.minX[otherId]), _mm256_loadu_pd(&boxes.maxX[first]), _CMP_LE_OQ));
+        const __m256d overlapY = _mm256_and_pd(
+            _mm256_cmp_pd(_mm256_loadu_pd(&boxes.minY[first]), _mm256_set1_pd(others.maxY[otherId]), _CMP_LE_OQ),
+            _mm256_cmp_pd(_mm256_set1_pd(others.minY[otherId]), _mm256_loadu_pd(&boxes.maxY[first]), _CMP_LE_OQ));
+        return static_cast<unsigned>(_mm256_movemask_pd(_mm256_and_pd(overlapX, overlapY)));
+    }
+#elif defined(__SSE2__)
+    /// Bit mask of the boxes [first, first + 4) whose bounding box overlaps the bounding box of another box
+    unsigned OverlapMask(const PreparedBoxes& boxes, size_t first, const PreparedBoxes& others, size_t otherId)
+    {
+        const __m128d otherMinX = _mm_set1_pd(others.minX[otherId]);
+        const __m128d otherMinY = _mm_set1_pd(others.minY[otherId]);
+        const __m128d otherMaxX = _mm_set1_pd(others.maxX[otherId]);
+        const __m128d otherMaxY = _mm_set1_pd(others.maxY[otherId]);
+
+        unsigned mask = 0;
+        for (size_t half = 0; half < 2; ++half)
+        {
+            const size_t index = first + 2 * half;
+            const __m128d overlapX = _mm_and_pd(_mm_cmple_pd(_mm_loadu_pd(&boxes.minX[index]), otherMaxX),
+                                                _mm_cmple_pd(otherMinX, _mm_loadu_pd(&boxes.maxX[index])));
+            const __m128d overlapY = _mm_and_pd(_mm_cmple_pd(_mm_loadu_pd(&boxes.minY[index]), otherMaxY),
+                                                _mm_cmple_pd(otherMinY, _mm_loadu_pd(&boxes.maxY[index])));
+            mask |= static_cast<unsigned>(_mm_movemask_pd(_mm_and_pd(overlapX, overlapY))) << (2 * half);
+        }
+        return mask;
+    }
+#else
+    /// Bit mask of the boxes [first, first + 4) whose bounding box overlaps the bounding box of another box
+    unsigned OverlapMask(const PreparedBoxes& boxes, size_t first, const PreparedBoxes& others, size_t otherId)
+    {
+        unsigned mask = 0;
+        for (size_t lane = 0; lane < 4; ++lane)
+            mask |= static_cast<unsigned>(BoundingBoxesOverlap(boxes, first + lane, others, otherId)) << lane;
+        return mask;
+    }
+#endif
+
+    /*!
+     * Calls visit with the index of every box whose bounding box overlaps the bounding box of another
+     * box, in increasing order, until visit returns false
+     */
+    template<typename Visitor>
+    void ForEachOverlapping(const PreparedBoxes& boxes, const PreparedBoxes& others, size_t otherId, Visitor visit)
+    {
+        size_t first = 0;
+        for (; first + 4 <= boxes.Size(); first += 4)
+        {
+            const unsigned mask = OverlapMask(boxes, first, others, otherId);
+            for (size_t lane = 0; lane < 4; ++lane)
+            {
+                if (((mask >> lane) & 1u) && !visit(first + lane))
+                    return;
+            }
+        }
+        for (; first < boxes.Size(); ++first)
+        {
+            if (BoundingBoxesOverlap(boxes, first, others, otherId) && !visit(first))
+                return;
+        }
+    }
+
+    double IntersectionOverUnion(const PreparedBoxes& boxes1, size_t boxId1, const PreparedBoxes& boxes2, size_t boxId2)
+    {
+        const double area1 = boxes1.area[boxId1];
+        const double area2 = boxes2.area[boxId2];
+        if ((area1 == 0.0) || (area2 == 0.0))
+            return 0.0;
+
+        const double* x1 = &boxes1.cornerX[4 * boxId1];
+        const double* y1 = &boxes1.cornerY[4 * boxId1];
+        const double* x2 = &boxes2.cornerX[4 * boxId2];
+        const double* y2 = &boxes2.cornerY[4 * boxId2];
+        const Point corners1[4] = {Point(x1[0], y1[0]), Point(x1[1], y1[1]), Point(x1[2], y1[2]), Point(x1[3], y1[3])};
+        const Point corners2[4] = {Point(x2[0], y2[0]), Point(x2[1], y2[1]), Point(x2[2], y2[2]), Point(x2[3], y2[3])};
+        Point intersection[8] = {Point(0.0, 0.0), Point(0.0, 0.0), Point(0.0, 0.0), Point(0.0, 0.0),
+                                 Point(0.0, 0.0), Point(0.0, 0.0), Point(0.0, 0.0), Point(0.0, 0.0)};
+        const size_t verticesNumber = convex_polygon_intersection(corners1, 4, corners2, 4, intersection);
+        if (verticesNumber < 3)
+            return 0.0;
+
+        double doubleArea = 0.0;
+        for (size_t vertexId = 0; vertexId < verticesNumber; ++vertexId)
+        {
+            const Point& next = intersection[(vertexId + 1 == verticesNumber) ? 0 : vertexId + 1];
+            doubleArea += intersection[vertexId].x * next.y - next.x * intersection[vertexId].y;
+        }
+        const double intersectionArea = std::min(0.5 * doubleArea, std::min(area1, area2));
+        return intersectionArea / (area1 + area2 - intersectionArea);
+    }
+}
+
+size_t RotatedBoxes::Size() const
+{
+    const size_t boxesNumber = centerX.size();
+    if ((centerY.size() != boxesNumber) || (width.size() != boxesNumber) || (height.size() != boxesNumber) || (angle.size() != boxesNumber))
+        throw std::invalid_argument("Attempted to define rotated boxes with parameter arrays of different sizes");
+    return boxesNumber;
+}
+
+std::vector<Point> rotated_box_corners(const RotatedBoxes& boxes, size_t boxId)
+{
+    RotatedBox::PreparedBoxes prepared;
+    prepared.Append(boxes.centerX.at(boxId), boxes.centerY.at(boxId), boxes.width.at(boxId), boxes.height.at(boxId), boxes.angle.at(boxId));
+
+    std::vector<Point> corners = {};
+    for (size_t cornerId = 0; cornerId < 4; ++cornerId)
+        corners.emplace_back(prepared.cornerX[cornerId], prepared.cornerY[cornerId]);
+    return corners;
+}
+
+double rotated_box_iou(const RotatedBoxes& boxes1, size_t boxId1, const RotatedBoxes& boxes2, size_t boxId2)
+{
+    RotatedBox::PreparedBoxes prepared1;
+    prepared1.Append(boxes1.centerX.at(boxId1), boxes1.centerY.at(boxId1), boxes1.width.at(boxId1), boxes1.height.at(boxId1), boxes1.angle.at(boxId1));
+    RotatedBox::PreparedBoxes prepared2;
+    prepared2.Append(boxes2.centerX.at(boxId2), boxes2.centerY.at(boxId2), boxes2.width.at(boxId2), boxes2.height.at(boxId2), boxes2.angle.at(boxId2));
+
+    if (!RotatedBox::BoundingBoxesOverlap(prepared1, 0, prepared2, 0))
+        return 0.0;
+    return RotatedBox::IntersectionOverUnion(prepared1, 0, prepared2, 0);
+}
+
+void rotated_box_iou_matrix(const RotatedBoxes& boxes1, const RotatedBoxes& boxes2, WorkStealingThreadPool& pool,
+                            std::vector<double>& iou)
+{
+    const RotatedBox::PreparedBoxes prepared1 = RotatedBox::Prepare(boxes1);
+    const RotatedBox::PreparedBoxes prepared2 = RotatedBox::Prepare(boxes2);
+    const size_t rowsNumber = prepared1.Size();
+    const size_t columnsNumber = prepared2.Size();
+    iou.assign(rowsNumber * columnsNumber, 0.0);
+
+    const size_t tasksNumber = std::min(rowsNumber, pool.ThreadsNumber() * RotatedBox::tasksPerThread);
+    pool.Run(tasksNumber, [&](size_t task, size_t) {
+        const size_t lastRow = rowsNumber * (task + 1) / tasksNumber;
+        for (size_t row = rowsNumber * task / tasksNumber; row < lastRow; ++row)
+        {
+            double* rowValues = &iou[row * columnsNumber];
+            RotatedBox::ForEachOverlapping(prepared2, prepared1, row, [&](size_t column) {
+                rowValues[column] = RotatedBox::IntersectionOverUnion(prepared1, row, prepared2, column);
+                return true;
+            });
+        }
+    });
+}
+
+std::vector<size_t> rotated_nms(const RotatedBoxes& boxes, const std::vector<double>& scores, double iouThreshold)
+{
+    const RotatedBox::PreparedBoxes prepared = RotatedBox::Prepare(boxes);
+    if (scores.size() != prepared.Size())
+        throw std::invalid_argument("Attempted to suppress boxes with a different number of scores");
+
+    ArenaScope scope;
+    std::pmr::vector<size_t> order(prepared.Size(), 0, scope.Resource());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return scores[a] > scores[b]; });
+
+    RotatedBox::PreparedBoxes kept;
+    std::vector<size_t> keptIds = {};
+    for (size_t boxId : order)
+    {
+        bool suppressed = false;
+        RotatedBox::ForEachOverlapping(kept, prepared, boxId, [&](size_t keptId) {
+            suppressed = RotatedBox::IntersectionOverUnion(kept, keptId, prepared, boxId) > iouThreshold;
+            return !suppressed;
+        });
+
+        if (!suppressed)
+        {
+            kept.Append(prepared, boxId);
+            keptIds.push_back(boxId);
+        }
+    }
+
+    return keptIds;
+}
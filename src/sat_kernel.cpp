@@ -0,0 +1,229 @@
+#include "polygon_operations/sat_kernel.h"
+#include "polygon_operations/fixed_polygon.h"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// The SIMD loops load the coordinates of consecutive points as a flat array of doubles
+static_assert(sizeof(Point) == 2 * sizeof(double), "Point is expected to hold exactly two doubles");
+
+namespace SAT
+{
+    /// Polygons with fewer vertices are projected with scalar code
+    const size_t simdMinimumVertices = 8;
+
+    /// Scalar projection of the vertices [first, last) updating the running extents
+    void ProjectScalar(const Point* vertices, size_t first, size_t last, const Vector& axis, ProjectionExtents& extents)
+    {
+        for (size_t index = first; index < last; ++index)
+        {
+            const double projection = axis.x * vertices[index].x + axis.y * vertices[index].y;
+            extents.minimum = std::min(extents.minimum, projection);
+            extents.maximum = std::max(extents.maximum, projection);
+        }
+    }
+
+#if defined(__AVX__)
+    /// Project 4 vertices per iteration and return the number of vertices processed
+    size_t ProjectSimd(const Point* vertices, size_t verticesNumber, const Vector& axis, ProjectionExtents& extents)
+    {
+        const __m256d axisX = _mm256_set1_pd(axis.x);
+        const __m256d axisY = _mm256_set1_pd(axis.y);
+        __m256d minimum = _mm256_set1_pd(extents.minimum);
+        __m256d maximum = _mm256_set1_pd(extents.maximum);
+
+        size_t index = 0;
+        for (; index + 4 <= verticesNumber; index += 4)
+        {
+            const double* coordinates = &vertices[index].x;
+            const __m256d first = _mm256_loadu_pd(coordinates);         // x0 y0 x1 y1
+            const __m256d second = _mm256_loadu_pd(coordinates + 4);    // x2 y2 x3 y3
+            const __m256d xs = _mm256_unpacklo_pd(first, second);       // x0 x2 x1 x3
+            const __m256d ys = _mm256_unpackhi_pd(first, second);       // y0 y2 y1 y3
+            const __m256d projections = _mm256_add_pd(_mm256_mul_pd(xs, axisX), _mm256_mul_pd(ys, axisY));
+            minimum = _mm256_min_pd(minimum, projections);
+            maximum = _mm256_max_pd(maximum, projections);
+        }
+
+        alignas(32) double minima[4];
+        alignas(32) double maxima[4];
+        _mm256_store_pd(minima, minimum);
+        _mm256_store_pd(maxima, maximum);
+        for (size_t lane = 0; lane < 4; ++lane)
+        {
+            extents.minimum = std::min(extents.minimum, minima[lane]);
+            extents.maximum = std::max(extents.maximum, maxima[lane]);
+        }
+        return index;
+    }
+#elif defined(__SSE2__)
+    /// Project 4 vertices per iteration (two independent pairs) and return the number of vertices processed
+    size_t ProjectSimd(const Point* vertices, size_t verticesNumber, const Vector& axis, ProjectionExtents& extents)
+    {
+        const __m128d axisX = _mm_set1_pd(axis.x);
+        const __m128d axisY = _mm_set1_pd(axis.y);
+        __m128d minimum1 = _mm_set1_pd(extents.minimum);
+        __m128d maximum1 = _mm_set1_pd(extents.maximum);
+        __m128d minimum2 = minimum1;
+        __m128d maximum2 = maximum1;
+
+        size_t index = 0;
+        for (; index + 4 <= verticesNumber; index += 4)
+        {
+            const double* coordinates = &vertices[index].x;
+            const __m128d point0 = _mm_loadu_pd(coordinates);           // x0 y0
+            const __m128d point1 = _mm_loadu_pd(coordinates + 2);       // x1 y1
+            const __m128d point2 = _mm_loadu_pd(coordinates + 4);       // x2 y2
+            const __m128d point3 = _mm_loadu_pd(coordinates + 6);       // x3 y3
+            const __m128d projections1 = _mm_add_pd(_mm_mul_pd(_mm_unpacklo_pd(point0, point1), axisX),
+                                                    _mm_mul_pd(_mm_unpackhi_pd(point0, point1), axisY));
+            const __m128d projections2 = _mm_add_pd(_mm_mul_pd(_mm_unpacklo_pd(point2, point3), axisX),
+                                                    _mm_mul_pd(_mm_unpackhi_pd(point2, point3), axisY));
+            minimum1 = _mm_min_pd(minimum1, projections1);
+            maximum1 = _mm_max_pd(maximum1, projections1);
+            minimum2 = _mm_min_pd(minimum2, projections2);
+            maximum2 = _mm_max_pd(maximum2, projections2);
+        }
+
+        alignas(16) double minima[2];
+        alignas(16) double maxima[2];
+        _mm_store_pd(minima, _mm_min_pd(minimum1, minimum2));
+        _mm_store_pd(maxima, _mm_max_pd(maximum1, maximum2));
+        extents.minimum = std::min(extents.minimum, std::min(minima[0], minima[1]));
+        extents.maximum = std::max(extents.maximum, std::max(maxima[0], maxima[1]));
+        return index;
+    }
+#endif
+
+    /// Find whether the normal of the edge of edgesPolygon starting from the vertex edgeId separates the two polygons
+    bool EdgeNormalSeparates(const Point* edgesPolygon, size_t edgesPolygonSize, size_t edgeId, const Point* otherPolygon, size_t otherPolygonSize)
+    {
+        const Point& tail = edgesPolygon[edgeId];
+        const Point& head = edgesPolygon[(edgeId + 1 == edgesPolygonSize) ? 0 : edgeId + 1];
+        // Unnormalized normal of the edge from tail to head
+        const Vector normal(tail.y - head.y, head.x - tail.x);
+
+        const ProjectionExtents extents1 = projection_extents(edgesPolygon, edgesPolygonSize, normal);
+        const ProjectionExtents extents2 = projection_extents(otherPolygon, otherPolygonSize, normal);
+        return (extents2.maximum < extents1.minimum) || (extents1.maximum < extents2.minimum);
+    }
+
+    /// Axis of minimum overlap found so far, where the overlap is measured along the unnormalized axis
+    struct MinimumOverlap
+    {
+        Vector axis = Vector(0.0, 0.0);
+        double overlap = std::numeric_limits<double>::infinity();
+        double squaredNorm = 1.0;
+    };
+
+    /*!
+     * Projects both polygons on the normals of the edges of edgesPolygon (one of the two polygons),
+     * keeping the axis of minimum overlap, and returns false at the first separating axis
+     */
+    bool UpdateMinimumOverlap(const Point* edgesPolygon, size_t edgesPolygonSize, const Point* polygon1, size_t polygon1Size,
+                              const Point* polygon2, size_t polygon2Size, MinimumOverlap& minimum)
+    {
+        for (size_t edgeId = 0; edgeId < edgesPolygonSize; ++edgeId)
+        {
+            const Point& tail = edgesPolygon[edgeId];
+            const Point& head = edgesPolygon[(edgeId + 1 == edgesPolygonSize) ? 0 : edgeId + 1];
+            const Vector normal(tail.y - head.y, head.x - tail.x);
+
+            const ProjectionExtents extents1 = projection_extents(polygon1, polygon1Size, normal);
+            const ProjectionExtents extents2 = projection_extents(polygon2, polygon2Size, normal);
+            if ((extents2.maximum < extents1.minimum) || (extents1.maximum < extents2.minimum))
+                return false;
+
+            // Moving polygon1 forward along the normal or backward
+            const double forward = extents2.maximum - extents1.minimum;
+            const double backward = extents1.maximum - extents2.minimum;
+            const double overlap = std::min(forward, backward);
+            const double squaredNorm = normal.x * normal.x + normal.y * normal.y;
+            // overlap / norm < minimum.overlap / minimum.norm, compared without divisions and square roots
+            if ((squaredNorm > 0.0) && (overlap * overlap * minimum.squaredNorm < minimum.overlap * minimum.overlap * squaredNorm))
+            {
+                minimum.axis = (forward <= backward) ? normal : Vector(-normal.x, -normal.y);
+                minimum.overlap = overlap;
+                minimum.squaredNorm = squaredNorm;
+            }
+        }
+        return true;
+    }
+}
+
+ProjectionExtents projection_extents(const Point* vertices, size_t verticesNumber, const Vector& axis)
+{
+    ProjectionExtents extents = {std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity()};
+
+    size_t processed = 0;
+#if defined(__AVX__) || defined(__SSE2__)
+    if (verticesNumber >= SAT::simdMinimumVertices)
+        processed = SAT::ProjectSimd(vertices, verticesNumber, axis, extents);
+#endif
+    SAT::ProjectScalar(vertices, processed, verticesNumber, axis, extents);
+
+    return extents;
+}
+
+bool sat_find_separating_edge(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size,
+                              size_t firstEdge, size_t& separatingEdge)
+{
+    if ((polygon1Size < 3) || (polygon2Size < 3))
+        throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
+
+    const size_t edgesNumber = polygon1Size + polygon2Size;
+    size_t edgeId = (firstEdge < edgesNumber) ? firstEdge : 0;
+    for (size_t iter = 0; iter < edgesNumber; ++iter)
+    {
+        const bool separates = (edgeId < polygon1Size)
+            ? SAT::EdgeNormalSeparates(polygon1, polygon1Size, edgeId, polygon2, polygon2Size)
+            : SAT::EdgeNormalSeparates(polygon2, polygon2Size, edgeId - polygon1Size, polygon1, polygon1Size);
+        if (separates)
+        {
+            separatingEdge = edgeId;
+            return true;
+        }
+
+        edgeId = (edgeId + 1 == edgesNumber) ? 0 : edgeId + 1;
+    }
+
+    return false;
+}
+
+bool sat_do_intersect(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size)
+{
+    // Triangles and quadrilaterals run the kernels expanded at compile time
+    if ((polygon1Size == 3) && (polygon2Size == 3))
+        return FixedPolygon::Intersect<3, 3>(polygon1, polygon2);
+    if ((polygon1Size == 3) && (polygon2Size == 4))
+        return FixedPolygon::Intersect<3, 4>(polygon1, polygon2);
+    if ((polygon1Size == 4) && (polygon2Size == 3))
+        return FixedPolygon::Intersect<4, 3>(polygon1, polygon2);
+    if ((polygon1Size == 4) && (polygon2Size == 4))
+        return FixedPolygon::Intersect<4, 4>(polygon1, polygon2);
+
+    // First, consider only the edges of polygon1 and then the edges of polygon2
+    size_t separatingEdge = 0;
+    return !sat_find_separating_edge(polygon1, polygon1Size, polygon2, polygon2Size, 0, separatingEdge);
+}
+
+bool sat_minimum_translation(const Point* polygon1, size_t polygon1Size, const Point* polygon2, size_t polygon2Size,
+                             MinimumTranslation& translation)
+{
+    if ((polygon1Size < 3) || (polygon2Size < 3))
+        throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
+
+    SAT::MinimumOverlap minimum;
+    if (!SAT::UpdateMinimumOverlap(polygon1, polygon1Size, polygon1, polygon1Size, polygon2, polygon2Size, minimum) ||
+        !SAT::UpdateMinimumOverlap(polygon2, polygon2Size, polygon1, polygon1Size, polygon2, polygon2Size, minimum))
+        return false;
+
+    const double norm = std::sqrt(minimum.squaredNorm);
+    translation.direction = Vector(minimum.axis.x / norm, minimum.axis.y / norm);
+    translation.depth = minimum.overlap / norm;
+    return true;
+}
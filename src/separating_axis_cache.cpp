@@ -0,0 +1,136 @@
+#include "polygon_operations/separating_axis_cache.h"
+#include "polygon_operations/sat_kernel.h"
+#include <stdexcept>
+
+namespace SAT
+{
+    /// Mix the bits of the ids of a pair (finalizer of splitmix64)
+    uint64_t HashPair(size_t lowerId, size_t upperId)
+    {
+        uint64_t hash = static_cast<uint64_t>(lowerId) * 0x9E3779B97F4A7C15ULL ^ static_cast<uint64_t>(upperId);
+        hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+        return hash ^ (hash >> 31);
+    }
+}
+
+SeparatingAxisCache::SeparatingAxisCache(size_t capacity)
+{
+    if (capacity == 0)
+        throw std::invalid_argument("Attempted to define a cache with zero capacity");
+
+    // Round the number of buckets up to a power of two, so that the bucket is found with a mask
+    size_t bucketsNumber = 1;
+    while (bucketsNumber * bucketSize < capacity)
+        bucketsNumber *= 2;
+
+    bucketMask = bucketsNumber - 1;
+    entries.resize(bucketsNumber * bucketSize);
+}
+
+SeparatingAxisCache::Entry* SeparatingAxisCache::Bucket(size_t lowerId, size_t upperId)
+{
+    return &entries[(SAT::HashPair(lowerId, upperId) & bucketMask) * bucketSize];
+}
+
+SeparatingAxisCache::Entry* SeparatingAxisCache::Find(size_t lowerId, size_t upperId)
+{
+    Entry* bucket = Bucket(lowerId, upperId);
+    for (size_t way = 0; way < bucketSize; ++way)
+    {
+        Entry& entry = bucket[way];
+        if ((entry.lastUse != 0) && (entry.lowerId == lowerId) && (entry.upperId == upperId))
+            return &entry;
+    }
+    return nullptr;
+}
+
+bool SeparatingAxisCache::Lookup(size_t polygon1Id, size_t polygon2Id, CachedPairState& state)
+{
+    ++statistics.lookups;
+
+    Entry* entry = Find(std::min(polygon1Id, polygon2Id), std::max(polygon1Id, polygon2Id));
+    if (entry == nullptr)
+        return false;
+
+    ++statistics.hits;
+    entry->lastUse = ++clock;
+    state = entry->state;
+    return true;
+}
+
+void SeparatingAxisCache::Store(size_t polygon1Id, size_t polygon2Id, const CachedPairState& state)
+{
+    const size_t lowerId = std::min(polygon1Id, polygon2Id);
+    const size_t upperId = std::max(polygon1Id, polygon2Id);
+
+    Entry* entry = Find(lowerId, upperId);
+    if (entry != nullptr)
+    {
+        if (!entry->state.overlapping && !state.overlapping &&
+            (entry->state.edgePolygonId == state.edgePolygonId) && (entry->state.edgeIndex == state.edgeIndex))
+            ++statistics.axisReuses;
+    }
+    else
+    {
+        // Use an empty entry of the bucket or evict the least recently used one
+        Entry* bucket = Bucket(lowerId, upperId);
+        entry = &bucket[0];
+        for (size_t way = 1; way < bucketSize; ++way)
+        {
+            if (bucket[way].lastUse < entry->lastUse)
+                entry = &bucket[way];
+        }
+
+        if (entry->lastUse != 0)
+            ++statistics.evictions;
+        else
+            ++size;
+
+        entry->lowerId = lowerId;
+        entry->upperId = upperId;
+    }
+
+    entry->state = state;
+    entry->lastUse = ++clock;
+}
+
+void SeparatingAxisCache::Clear()
+{
+    for (auto& entry : entries)
+        entry.lastUse = 0;
+    size = 0;
+}
+
+bool do_intersect(const std::vector<Point>& polygon1, size_t polygon1Id,
+                  const std::vector<Point>& polygon2, size_t polygon2Id, SeparatingAxisCache& cache)
+{
+    if ((polygon1.size() < 3) || (polygon2.size() < 3))
+        throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
+
+    // Start from the previous separating edge, translated to the numbering of sat_find_separating_edge
+    size_t firstEdge = 0;
+    CachedPairState previousState;
+    if (cache.Lookup(polygon1Id, polygon2Id, previousState) && !previousState.overlapping)
+    {
+        if (previousState.edgePolygonId == polygon1Id)
+            firstEdge = previousState.edgeIndex;
+        else
+            firstEdge = polygon1.size() + previousState.edgeIndex;
+    }
+
+    size_t separatingEdge = 0;
+    const bool separated = sat_find_separating_edge(polygon1.data(), polygon1.size(), polygon2.data(), polygon2.size(),
+                                                    firstEdge, separatingEdge);
+
+    CachedPairState state = {!separated, 0, 0};
+    if (separated)
+    {
+        const bool edgeOfPolygon1 = separatingEdge < polygon1.size();
+        state.edgePolygonId = edgeOfPolygon1 ? polygon1Id : polygon2Id;
+        state.edgeIndex = edgeOfPolygon1 ? separatingEdge : separatingEdge - polygon1.size();
+    }
+    cache.Store(polygon1Id, polygon2Id, state);
+
+    return !separated;
+}
@@ -0,0 +1,173 @@
+#include "polygon_operations/spatial_hash.h"
+#include "polygon_operations/convex_polygon.h"
+#include <cmath>
+#include <stdexcept>
+
+SpatialHashGrid::SpatialHashGrid(double cellSize, size_t maximumCellsPerPolygon):
+    requestedCellSize(cellSize), cellSize(cellSize), maximumCellsPerPolygon(maximumCellsPerPolygon)
+{
+    if (!(cellSize >= 0.0) || std::isinf(cellSize))
+        throw std::invalid_argument("Attempted to define a grid with a negative or infinite cell size");
+    if (maximumCellsPerPolygon == 0)
+        throw std::invalid_argument("Attempted to define a grid with no cells per polygon");
+}
+
+int64_t SpatialHashGrid::CellCoordinate(double coordinate) const
+{
+    return static_cast<int64_t>(std::floor(coordinate / cellSize));
+}
+
+size_t SpatialHashGrid::CellBucket(int64_t cellX, int64_t cellY) const
+{
+    uint64_t hash = static_cast<uint64_t>(cellX) * 0x9E3779B97F4A7C15ULL ^ static_cast<uint64_t>(cellY) * 0xC2B2AE3D27D4EB4FULL;
+    hash ^= hash >> 29;
+    return static_cast<size_t>(hash) & bucketMask;
+}
+
+const std::vector<PolygonPair>& SpatialHashGrid::FindCandidatePairs(const std::vector<std::vector<Point>>& polygons)
+{
+    timings = BroadPhaseTimings();
+    candidatePairs.clear();
+
+    // Bounding boxes and their mean extent
+    auto start = BroadPhase::Clock::now();
+    boxes.resize(polygons.size(), {0.0, 0.0, 0.0, 0.0});
+    double extentsSum = 0.0;
+    for (size_t polygonId = 0; polygonId < polygons.size(); ++polygonId)
+    {
+        // NaN coordinates are skipped by the bounding box, so every vertex is checked
+        for (const auto& vertex : polygons[polygonId])
+            if (!std::isfinite(vertex.x) || !std::isfinite(vertex.y))
+                throw std::invalid_argument("Attempted to hash a polygon with non-finite coordinates");
+        boxes[polygonId] = ComputeBoundingBox(polygons[polygonId]);
+        extentsSum += std::max(boxes[polygonId].maxX - boxes[polygonId].minX, boxes[polygonId].maxY - boxes[polygonId].minY);
+    }
+    timings.boundsUpdate = BroadPhase::SecondsSince(start);
+
+    if (polygons.empty())
+        return candidatePairs;
+
+    cellSize = requestedCellSize;
+    if (cellSize == 0.0)
+        cellSize = (extentsSum > 0.0) ? extentsSum / polygons.size() : 1.0;
+
+    // Insert every box into the cells it covers, or into the overflow list when they are too many.
+    // The cells are counted in floating point first, since the coordinates of the cells of a box far
+    // from the origin may not fit in 64-bit integers.
+    start = BroadPhase::Clock::now();
+    unbinnedEntries.clear();
+    overflowIds.clear();
+    isOverflow.assign(polygons.size(), false);
+    const double maximumCellCoordinate = 0x1p62;
+    for (size_t polygonId = 0; polygonId < polygons.size(); ++polygonId)
+    {
+        const BoundingBox& box = boxes[polygonId];
+        const double minCellX = std::floor(box.minX / cellSize);
+        const double minCellY = std::floor(box.minY / cellSize);
+        const double maxCellX = std::floor(box.maxX / cellSize);
+        const double maxCellY = std::floor(box.maxY / cellSize);
+        const double cellsNumber = (maxCellX - minCellX + 1.0) * (maxCellY - minCellY + 1.0);
+        if (!(cellsNumber <= static_cast<double>(maximumCellsPerPolygon)) ||
+            (std::max(std::fabs(minCellX), std::fabs(maxCellX)) > maximumCellCoordinate) ||
+            (std::max(std::fabs(minCellY), std::fabs(maxCellY)) > maximumCellCoordinate))
+        {
+            overflowIds.push_back(polygonId);
+            isOverflow[polygonId] = true;
+            continue;
+        }
+
+        const int64_t lastCellX = static_cast<int64_t>(maxCellX);
+        const int64_t lastCellY = static_cast<int64_t>(maxCellY);
+        for (int64_t cellX = static_cast<int64_t>(minCellX); cellX <= lastCellX; ++cellX)
+            for (int64_t cellY = static_cast<int64_t>(minCellY); cellY <= lastCellY; ++cellY)
+                unbinnedEntries.push_back({cellX, cellY, polygonId});
+    }
+
+    // Counting sort of the entries by bucket, with at least twice as many buckets as entries
+    size_t bucketsNumber = 1;
+    while (bucketsNumber < 2 * unbinnedEntries.size())
+        bucketsNumber *= 2;
+    bucketMask = bucketsNumber - 1;
+
+    bucketStarts.assign(bucketsNumber + 1, 0);
+    for (const auto& entry : unbinnedEntries)
+        ++bucketStarts[CellBucket(entry.cellX, entry.cellY) + 1];
+    for (size_t bucket = 0; bucket < bucketsNumber; ++bucket)
+        bucketStarts[bucket + 1] += bucketStarts[bucket];
+
+    entries.resize(unbinnedEntries.size(), {0, 0, 0});
+    for (const auto& entry : unbinnedEntries)
+    {
+        const size_t bucket = CellBucket(entry.cellX, entry.cellY);
+        entries[bucketStarts[bucket]++] = entry;
+    }
+    // The starts were shifted by one bucket while filling
+    for (size_t bucket = bucketsNumber; bucket > 0; --bucket)
+        bucketStarts[bucket] = bucketStarts[bucket - 1];
+    bucketStarts[0] = 0;
+    timings.moves = entries.size();
+    timings.sort = BroadPhase::SecondsSince(start);
+
+    // Compare the entries of the same cell inside every bucket
+    start = BroadPhase::Clock::now();
+    for (size_t bucket = 0; bucket < bucketsNumber; ++bucket)
+    {
+        for (size_t i = bucketStarts[bucket]; i < bucketStarts[bucket + 1]; ++i)
+        {
+            const CellEntry& entry1 = entries[i];
+            const BoundingBox& box1 = boxes[entry1.polygonId];
+            for (size_t j = i + 1; j < bucketStarts[bucket + 1]; ++j)
+            {
+                const CellEntry& entry2 = entries[j];
+                // Different cells may share a bucket
+                if ((entry1.cellX != entry2.cellX) || (entry1.cellY != entry2.cellY))
+                    continue;
+
+                const BoundingBox& box2 = boxes[entry2.polygonId];
+                if (!box1.Overlaps(box2))
+                    continue;
+
+                // Report the pair only from the cell containing the lower-left corner of the boxes intersection
+                if ((CellCoordinate(std::max(box1.minX, box2.minX)) != entry1.cellX) ||
+                    (CellCoordinate(std::max(box1.minY, box2.minY)) != entry1.cellY))
+                    continue;
+
+                candidatePairs.emplace_back(std::min(entry1.polygonId, entry2.polygonId), std::max(entry1.polygonId, entry2.polygonId));
+            }
+        }
+    }
+
+    // Test the overflow polygons against all the others, pairing two overflow polygons only once
+    for (size_t overflowId : overflowIds)
+    {
+        const BoundingBox& box1 = boxes[overflowId];
+        for (size_t polygonId = 0; polygonId < polygons.size(); ++polygonId)
+        {
+            if ((polygonId == overflowId) || (isOverflow[polygonId] && (polygonId < overflowId)))
+                continue;
+            if (box1.Overlaps(boxes[polygonId]))
+                candidatePairs.emplace_back(std::min(overflowId, polygonId), std::max(overflowId, polygonId));
+        }
+    }
+    timings.sweep = BroadPhase::SecondsSince(start);
+    timings.candidatePairs = candidatePairs.size();
+
+    return candidatePairs;
+}
+
+const std::vector<PolygonPair>& SpatialHashGrid::FindIntersectingPairs(const std::vector<std::vector<Point>>& polygons)
+{
+    FindCandidatePairs(polygons);
+
+    auto start = BroadPhase::Clock::now();
+    intersectingPairs.clear();
+    for (const auto& pair : candidatePairs)
+    {
+        if (do_intersect(polygons[pair.first], polygons[pair.second]))
+            intersectingPairs.push_back(pair);
+    }
+    timings.narrowPhase = BroadPhase::SecondsSince(start);
+    timings.confirmedPairs = intersectingPairs.size();
+
+    return intersectingPairs;
+}
@@ -0,0 +1,232 @@
+#include "polygon_operations/spatial_join.h"
+#include "polygon_operations/convex_polygon.h"
+#include <algorithm>
+#include <cmath>
+
+namespace SpatialJoin
+{
+    /// Wanted mean number of polygons per partition when choosing the grid automatically
+    const size_t polygonsPerPartition = 512;
+
+    /// Number of bounding boxes computed by every task
+    const size_t boxesPerTask = 4096;
+
+    /// Uniform grid of partitions, where the boxes beyond its borders are clamped to the border partitions
+    struct Grid
+    {
+        double originX;
+        double originY;
+        double cellWidth;
+        double cellHeight;
+        size_t cellsPerSide;
+
+        size_t Cell(double coordinate, double origin, double cellSize) const
+        {
+            const double cell = (coordinate - origin) / cellSize;
+            if (!(cell > 0.0))
+                return 0;
+            return std::min(static_cast<size_t>(cell), cellsPerSide - 1);
+        }
+
+        size_t Column(double x) const { return Cell(x, originX, cellWidth); }
+
+        size_t Row(double y) const { return Cell(y, originY, cellHeight); }
+    };
+
+    /// Polygons of a collection inside every partition, stored consecutively per partition
+    struct Partitioning
+    {
+        std::vector<size_t> starts;
+        std::vector<size_t> polygonIds;
+    };
+
+    /// Buffers and counters of a thread
+    struct ThreadState
+    {
+        std::vector<size_t> polygonIds1;
+        std::vector<size_t> polygonIds2;
+        std::vector<PolygonPair> pairs;
+        SpatialJoinStatistics statistics;
+    };
+
+    std::vector<BoundingBox> ComputeBoxes(const std::vector<std::vector<Point>>& polygons, WorkStealingThreadPool& pool)
+    {
+        std::vector<BoundingBox> boxes(polygons.size(), {0.0, 0.0, 0.0, 0.0});
+        pool.Run((polygons.size() + boxesPerTask - 1) / boxesPerTask, [&](size_t task, size_t) {
+            const size_t end = std::min(polygons.size(), (task + 1) * boxesPerTask);
+            for (size_t polygonId = task * boxesPerTask; polygonId < end; ++polygonId)
+                boxes[polygonId] = ComputeBoundingBox(polygons[polygonId]);
+        });
+        return boxes;
+    }
+
+    Grid ChooseGrid(const std::vector<BoundingBox>& boxes1, const std::vector<BoundingBox>& boxes2, size_t partitionsPerSide)
+    {
+        BoundingBox bounds = boxes1.front();
+        double extentsSum = 0.0;
+        for (const auto* boxes : {&boxes1, &boxes2})
+        {
+            for (const auto& box : *boxes)
+            {
+                bounds.minX = std::min(bounds.minX, box.minX);
+                bounds.minY = std::min(bounds.minY, box.minY);
+                bounds.maxX = std::max(bounds.maxX, box.maxX);
+                bounds.maxY = std::max(bounds.maxY, box.maxY);
+                extentsSum += std::max(box.maxX - box.minX, box.maxY - box.minY);
+            }
+        }
+
+        if (partitionsPerSide == 0)
+        {
+            // Enough partitions for the wanted number of polygons per partition, but not
+            // smaller than twice the mean extent, where most polygons would span several partitions
+            const size_t polygonsNumber = boxes1.size() + boxes2.size();
+            const double side = std::max(bounds.maxX - bounds.minX, bounds.maxY - bounds.minY);
+            const double meanExtent = extentsSum / polygonsNumber;
+            double cells = std::ceil(std::sqrt(static_cast<double>(polygonsNumber) / polygonsPerPartition));
+            if (meanExtent > 0.0)
+                cells = std::min(cells, std::floor(side / (2.0 * meanExtent)));
+            partitionsPerSide = static_cast<size_t>(std::max(1.0, cells));
+        }
+
+        const double width = bounds.maxX - bounds.minX;
+        const double height = bounds.maxY - bounds.minY;
+        return {bounds.minX, bounds.minY,
+                (width > 0.0) ? width / partitionsPerSide : 1.0,
+                (height > 0.0) ? height / partitionsPerSide : 1.0,
+                partitionsPerSide};
+    }
+
+    /// Inserts every polygon into all the partitions covered by its bounding box with counting sort
+    Partitioning Partition(const Grid& grid, const std::vector<BoundingBox>& boxes)
+    {
+        Partitioning partitioning;
+        partitioning.starts.assign(grid.cellsPerSide * grid.cellsPerSide + 1, 0);
+        for (const auto& box : boxes)
+            for (size_t row = grid.Row(box.minY); row <= grid.Row(box.maxY); ++row)
+                for (size_t column = grid.Column(box.minX); column <= grid.Column(box.maxX); ++column)
+                    ++partitioning.starts[row * grid.cellsPerSide + column + 1];
+        for (size_t cell = 1; cell < partitioning.starts.size(); ++cell)
+            partitioning.starts[cell] += partitioning.starts[cell - 1];
+
+        std::vector<size_t> ends(partitioning.starts.begin(), partitioning.starts.end() - 1);
+        partitioning.polygonIds.resize(partitioning.starts.back());
+        for (size_t polygonId = 0; polygonId < boxes.size(); ++polygonId)
+        {
+            const BoundingBox& box = boxes[polygonId];
+            for (size_t row = grid.Row(box.minY); row <= grid.Row(box.maxY); ++row)
+                for (size_t column = grid.Column(box.minX); column <= grid.Column(box.maxX); ++column)
+                    partitioning.polygonIds[ends[row * grid.cellsPerSide + column]++] = polygonId;
+        }
+
+        return partitioning;
+    }
+}
+
+SpatialJoinStatistics spatial_join(const std::vector<std::vector<Point>>& polygons1,
+                                   const std::vector<std::vector<Point>>& polygons2,
+                                   WorkStealingThreadPool& pool,
+                                   const SpatialJoinCallback& callback,
+                                   size_t partitionsPerSide,
+                                   size_t batchSize)
+{
+    if (polygons1.empty() || polygons2.empty())
+        return SpatialJoinStatistics();
+
+    const std::vector<BoundingBox> boxes1 = SpatialJoin::ComputeBoxes(polygons1, pool);
+    const std::vector<BoundingBox> boxes2 = SpatialJoin::ComputeBoxes(polygons2, pool);
+    const SpatialJoin::Grid grid = SpatialJoin::ChooseGrid(boxes1, boxes2, partitionsPerSide);
+    const SpatialJoin::Partitioning partitioning1 = SpatialJoin::Partition(grid, boxes1);
+    const SpatialJoin::Partitioning partitioning2 = SpatialJoin::Partition(grid, boxes2);
+
+    std::mutex callbackMutex;
+    auto flush = [&](std::vector<PolygonPair>& pairs) {
+        if (pairs.empty())
+            return;
+        std::lock_guard<std::mutex> lock(callbackMutex);
+        callback(pairs);
+        pairs.clear();
+    };
+
+    std::vector<SpatialJoin::ThreadState> threadStates(pool.ThreadsNumber());
+    pool.Run(grid.cellsPerSide * grid.cellsPerSide, [&](size_t cell, size_t threadId) {
+        SpatialJoin::ThreadState& state = threadStates[threadId];
+        const size_t row = cell / grid.cellsPerSide;
+        const size_t column = cell % grid.cellsPerSide;
+
+        state.polygonIds1.assign(partitioning1.polygonIds.begin() + partitioning1.starts[cell],
+                                 partitioning1.polygonIds.begin() + partitioning1.starts[cell + 1]);
+        state.polygonIds2.assign(partitioning2.polygonIds.begin() + partitioning2.starts[cell],
+                                 partitioning2.polygonIds.begin() + partitioning2.starts[cell + 1]);
+        if (state.polygonIds1.empty() || state.polygonIds2.empty())
+            return;
+        ++state.statistics.partitions;
+
+        std::sort(state.polygonIds1.begin(), state.polygonIds1.end(), [&](size_t a, size_t b) { return boxes1[a].minX < boxes1[b].minX; });
+        std::sort(state.polygonIds2.begin(), state.polygonIds2.end(), [&](size_t a, size_t b) { return boxes2[a].minX < boxes2[b].minX; });
+
+        auto testPair = [&](size_t id1, size_t id2) {
+            const BoundingBox& box1 = boxes1[id1];
+            const BoundingBox& box2 = boxes2[id2];
+            if ((box1.minY > box2.maxY) || (box2.minY > box1.maxY))
+                return;
+
+            // Report the pair only from the partition containing the lower-left corner of the boxes intersection
+            if ((grid.Column(std::max(box1.minX, box2.minX)) != column) || (grid.Row(std::max(box1.minY, box2.minY)) != row))
+                return;
+
+            ++state.statistics.candidatePairs;
+            if (!do_intersect(polygons1[id1], polygons2[id2]))
+                return;
+
+            ++state.statistics.intersectingPairs;
+            state.pairs.emplace_back(id1, id2);
+            if (state.pairs.size() >= batchSize)
+                flush(state.pairs);
+        };
+
+        // Every box is compared with the boxes of the other collection starting inside its x-range
+        const std::vector<size_t>& ids1 = state.polygonIds1;
+        const std::vector<size_t>& ids2 = state.polygonIds2;
+        size_t i = 0;
+        size_t j = 0;
+        while ((i < ids1.size()) && (j < ids2.size()))
+        {
+            if (boxes1[ids1[i]].minX <= boxes2[ids2[j]].minX)
+            {
+                for (size_t k = j; (k < ids2.size()) && (boxes2[ids2[k]].minX <= boxes1[ids1[i]].maxX); ++k)
+                    testPair(ids1[i], ids2[k]);
+                ++i;
+            }
+            else
+            {
+                for (size_t k = i; (k < ids1.size()) && (boxes1[ids1[k]].minX <= boxes2[ids2[j]].maxX); ++k)
+                    testPair(ids1[k], ids2[j]);
+                ++j;
+            }
+        }
+    });
+
+    SpatialJoinStatistics statistics;
+    for (auto& state : threadStates)
+    {
+        flush(state.pairs);
+        statistics.partitions += state.statistics.partitions;
+        statistics.candidatePairs += state.statistics.candidatePairs;
+        statistics.intersectingPairs += state.statistics.intersectingPairs;
+    }
+
+    return statistics;
+}
+
+SpatialJoinStatistics spatial_join(const std::vector<std::vector<Point>>& polygons1,
+                                   const std::vector<std::vector<Point>>& polygons2,
+                                   WorkStealingThreadPool& pool,
+                                   std::ostream& output,
+                                   size_t partitionsPerSide)
+{
+    return spatial_join(polygons1, polygons2, pool, [&](const std::vector<PolygonPair>& pairs) {
+        for (const auto& pair : pairs)
+            output << pair.first << ' ' << pair.second << '\n';
+    }, partitionsPerSide);
+}
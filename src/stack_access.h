@@ -0,0 +1,23 @@
+#ifndef STACK_ACCESS_H
+#define STACK_ACCESS_H
+
+#include "polygon_operations/utilities.h"
+#include <stack>
+
+// Internal to the sources of the library, which read the stacks of points without copying them
+
+namespace Utilities
+{
+    /// Container of a stack of points, which stores them from the bottom to the top
+    inline const std::stack<Point>::container_type& StackContainer(const std::stack<Point>& stack)
+    {
+        // The container is a protected member, reachable through a member pointer of a derived class
+        struct ContainerAccess : std::stack<Point>
+        {
+            static const container_type& Get(const std::stack<Point>& stack) {return stack.*&ContainerAccess::c;}
+        };
+        return ContainerAccess::Get(stack);
+    }
+}
+
+#endif
@@ -0,0 +1,89 @@
+#include "polygon_operations/sweep_and_prune.h"
+#include "polygon_operations/convex_polygon.h"
+
+const std::vector<PolygonPair>& SweepAndPrune::FindCandidatePairs(const std::vector<std::vector<Point>>& polygons)
+{
+    timings = BroadPhaseTimings();
+
+    // Update the boxes in the order of the previous frame, or rebuild the intervals
+    auto start = BroadPhase::Clock::now();
+    const bool rebuild = intervals.size() != polygons.size();
+    if (rebuild)
+    {
+        intervals.clear();
+        for (size_t polygonId = 0; polygonId < polygons.size(); ++polygonId)
+            intervals.push_back({ComputeBoundingBox(polygons[polygonId]), polygonId});
+    }
+    else
+    {
+        for (auto& interval : intervals)
+            interval.box = ComputeBoundingBox(polygons[interval.polygonId]);
+    }
+    timings.boundsUpdate = BroadPhase::SecondsSince(start);
+
+    // Insertion sort is close to linear for the nearly sorted intervals of coherent frames
+    start = BroadPhase::Clock::now();
+    auto lessMinimumX = [](const Interval& a, const Interval& b) { return a.box.minX < b.box.minX; };
+    if (rebuild)
+    {
+        std::sort(intervals.begin(), intervals.end(), lessMinimumX);
+    }
+    else
+    {
+        for (size_t i = 1; i < intervals.size(); ++i)
+        {
+            if (!lessMinimumX(intervals[i], intervals[i - 1]))
+                continue;
+
+            const Interval moved = intervals[i];
+            size_t j = i;
+            while ((j > 0) && lessMinimumX(moved, intervals[j - 1]))
+            {
+                intervals[j] = intervals[j - 1];
+                --j;
+            }
+            intervals[j] = moved;
+            timings.moves += i - j;
+        }
+    }
+    timings.sort = BroadPhase::SecondsSince(start);
+
+    // Sweep: every interval is compared only with the following intervals starting before its end
+    start = BroadPhase::Clock::now();
+    candidatePairs.clear();
+    for (size_t i = 0; i < intervals.size(); ++i)
+    {
+        const BoundingBox& box = intervals[i].box;
+        for (size_t j = i + 1; (j < intervals.size()) && (intervals[j].box.minX <= box.maxX); ++j)
+        {
+            const BoundingBox& other = intervals[j].box;
+            if ((box.minY <= other.maxY) && (other.minY <= box.maxY))
+            {
+                const size_t id1 = intervals[i].polygonId;
+                const size_t id2 = intervals[j].polygonId;
+                candidatePairs.emplace_back(std::min(id1, id2), std::max(id1, id2));
+            }
+        }
+    }
+    timings.sweep = BroadPhase::SecondsSince(start);
+    timings.candidatePairs = candidatePairs.size();
+
+    return candidatePairs;
+}
+
+const std::vector<PolygonPair>& SweepAndPrune::FindIntersectingPairs(const std::vector<std::vector<Point>>& polygons)
+{
+    FindCandidatePairs(polygons);
+
+    auto start = BroadPhase::Clock::now();
+    intersectingPairs.clear();
+    for (const auto& pair : candidatePairs)
+    {
+        if (do_intersect(polygons[pair.first], polygons[pair.second]))
+            intersectingPairs.push_back(pair);
+    }
+    timings.narrowPhase = BroadPhase::SecondsSince(start);
+    timings.confirmedPairs = intersectingPairs.size();
+
+    return intersectingPairs;
+}
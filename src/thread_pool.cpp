@@ -0,0 +1,133 @@
+#include "polygon_operations/thread_pool.h"
+#include <algorithm>
+
+WorkStealingThreadPool::WorkStealingThreadPool(size_t threadsNumber)
+{
+    if (threadsNumber == 0)
+        threadsNumber = std::max<size_t>(1, std::thread::hardware_concurrency());
+
+    for (size_t threadId = 0; threadId < threadsNumber; ++threadId)
+        ranges.emplace_back(new TaskRange());
+    for (size_t threadId = 0; threadId < threadsNumber; ++threadId)
+        workers.emplace_back(&WorkStealingThreadPool::WorkerLoop, this, threadId);
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    batchStarted.notify_all();
+    for (auto& worker : workers)
+        worker.join();
+}
+
+void WorkStealingThreadPool::Run(size_t tasksNumber, const std::function<void(size_t, size_t)>& task)
+{
+    if (tasksNumber == 0)
+        return;
+
+    // Split the tasks into contiguous ranges of almost equal size
+    const size_t threadsNumber = workers.size();
+    for (size_t threadId = 0; threadId < threadsNumber; ++threadId)
+    {
+        std::lock_guard<std::mutex> lock(ranges[threadId]->mutex);
+        ranges[threadId]->begin = tasksNumber * threadId / threadsNumber;
+        ranges[threadId]->end = tasksNumber * (threadId + 1) / threadsNumber;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    currentTask = &task;
+    firstException = nullptr;
+    cancelled.store(false, std::memory_order_relaxed);
+    runningWorkers = threadsNumber;
+    ++batch;
+    batchStarted.notify_all();
+    batchFinished.wait(lock, [this]() { return runningWorkers == 0; });
+    currentTask = nullptr;
+
+    if (firstException)
+        std::rethrow_exception(firstException);
+}
+
+bool WorkStealingThreadPool::NextTask(size_t threadId, size_t& taskId)
+{
+    // A task of the batch threw, so the remaining ones are skipped
+    if (cancelled.load(std::memory_order_relaxed))
+        return false;
+
+    {
+        TaskRange& own = *ranges[threadId];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (own.begin < own.end)
+        {
+            taskId = own.begin++;
+            return true;
+        }
+    }
+
+    // Steal the back half of the range of the next worker with remaining tasks
+    const size_t threadsNumber = ranges.size();
+    for (size_t offset = 1; offset < threadsNumber; ++offset)
+    {
+        TaskRange& victim = *ranges[(threadId + offset) % threadsNumber];
+        size_t stolenBegin = 0;
+        size_t stolenEnd = 0;
+        {
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.begin == victim.end)
+                continue;
+            stolenBegin = victim.begin + (victim.end - victim.begin) / 2;
+            stolenEnd = victim.end;
+            victim.end = stolenBegin;
+        }
+
+        // Execute the first stolen task and keep the rest
+        TaskRange& own = *ranges[threadId];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        own.begin = stolenBegin + 1;
+        own.end = stolenEnd;
+        taskId = stolenBegin;
+        return true;
+    }
+
+    return false;
+}
+
+void WorkStealingThreadPool::WorkerLoop(size_t threadId)
+{
+    size_t lastBatch = 0;
+    while (true)
+    {
+        const std::function<void(size_t, size_t)>* task = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            batchStarted.wait(lock, [&]() { return stopping || (batch != lastBatch); });
+            if (stopping)
+                return;
+            lastBatch = batch;
+            task = currentTask;
+        }
+
+        size_t taskId = 0;
+        while (NextTask(threadId, taskId))
+        {
+            try
+            {
+                (*task)(taskId, threadId);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!firstException)
+                    firstException = std::current_exception();
+                cancelled.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--runningWorkers == 0)
+            batchFinished.notify_one();
+    }
+}
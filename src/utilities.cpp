@@ -1,4 +1,6 @@
 #include "polygon_operations/utilities.h"
+#include "polygon_operations/predicates.h"
+#include "stack_access.h"
 #include <cmath>
 #include <stdexcept>
 
@@ -17,14 +19,40 @@ double EuclideanDistance(const Point &p1, const Point &p2)
     return sqrt((p1.x - p2.x) * (p1.x - p2.x) + (p1.y - p2.y) * (p1.y - p2.y));
 }
 
-bool CheckPointsCollinear(const std::vector<Point> points)
+double DotProduct(const Point &p1, const Point &p2)
 {
-    if (points.size() < 3)
+    return p1.x * p2.x + p1.y * p2.y;
+}
+
+BoundingBox ComputeBoundingBox(const std::vector<Point>& points)
+{
+    if (points.empty())
+        throw std::invalid_argument("Attempted to compute the bounding box of no points");
+
+    BoundingBox box = {points[0].x, points[0].y, points[0].x, points[0].y};
+    for (const auto& point : points)
+    {
+        box.minX = std::min(box.minX, point.x);
+        box.minY = std::min(box.minY, point.y);
+        box.maxX = std::max(box.maxX, point.x);
+        box.maxY = std::max(box.maxY, point.y);
+    }
+    return box;
+}
+
+bool CheckPointsCollinear(const std::vector<Point>& points, OrientationPredicate predicate)
+{
+    return CheckPointsCollinear(points.data(), points.size(), predicate);
+}
+
+bool CheckPointsCollinear(const Point* points, size_t pointsNumber, OrientationPredicate predicate)
+{
+    if (pointsNumber < 3)
         throw std::invalid_argument("Attempted to define a convex polygon with less than 3 points");
 
-    for (size_t iter = 0; iter<points.size()-2; ++iter)
+    for (size_t iter = 0; iter<pointsNumber-2; ++iter)
     {
-        if (ThreePointOrientation(points[iter], points[iter+1], points[iter+2]))
+        if (ThreePointOrientation(points[iter], points[iter+1], points[iter+2], predicate))
             return false;
     }
     return true;
@@ -33,31 +61,29 @@ bool CheckPointsCollinear(const std::vector<Point> points)
 // 0 --> P, Q and R are collinear
 // 1 --> Clockwise
 // 2 --> Counterclockwise
-int ThreePointOrientation(const Point &P, const Point &Q, const Point &R)
+int ThreePointOrientation(const Point &P, const Point &Q, const Point &R, OrientationPredicate predicate)
 {
-    if ((P==Q) || (Q==R) || (R==P))
-        throw std::invalid_argument("Attempted to compute the orientation of three points when at least two of them are identical");
-
-    double value = (Q.y - P.y) * (R.x - Q.x) -
-                    (Q.x - P.x) * (R.y - Q.y);
+    return dispatch_predicate(predicate, [&](auto kernel) { return OrientationKernel<decltype(kernel)::value>().ThreePointOrientation(P, Q, R); });
+}
 
-    if (value == 0)
-        return 0;               // collinear
-    return (value > 0) ? 1 : 2; // clock or counterclock wise
+bool CompareOrientation(const Point &P, const Point &Q, const Point &R, OrientationPredicate predicate)
+{
+    return dispatch_predicate(predicate, [&](auto kernel) { return OrientationKernel<decltype(kernel)::value>().CompareOrientation(P, Q, R); });
 }
 
-bool CompareOrientation(const Point &P, const Point &Q, const Point &R)
+bool IsPointRightToTheEdge(const Point &tail, const Point &head, const Point &examinedPoint, OrientationPredicate predicate)
 {
-    // Find orientation
-    int threePointOrientation = ThreePointOrientation(P, Q, R);
-    // If three points are collinear, then the nearest point should be placed first 
-    if (threePointOrientation == 0)
-        return (EuclideanDistance(P, Q) <= EuclideanDistance(P, R));
+    return dispatch_predicate(predicate, [&](auto kernel) { return OrientationKernel<decltype(kernel)::value>().IsPointRightToTheEdge(tail, head, examinedPoint); });
+}
 
-    return threePointOrientation == 2;
+std::vector<Point> StackToVectorFromTop(const std::stack<Point>& stackToCopy)
+{
+    const auto& container = Utilities::StackContainer(stackToCopy);
+    return std::vector<Point>(container.rbegin(), container.rend());
 }
 
-bool IsPointRightToTheEdge(const Point &tail, const Point &head, const Point &examinedPoint)
+std::vector<Point> StackToVectorFromBottom(const std::stack<Point>& stackToCopy)
 {
-    return !(ThreePointOrientation(tail, head, examinedPoint) == 2); // counterclockwise
+    const auto& container = Utilities::StackContainer(stackToCopy);
+    return std::vector<Point>(container.begin(), container.end());
 }
@@ -0,0 +1,238 @@
+#include "polygon_operations/arena.h"
+#include "polygon_operations/convex_hull.h"
+#include "polygon_operations/convex_polygon.h"
+#include "polygon_operations/clipping.h"
+#include "polygon_operations/minkowski.h"
+#include "polygon_operations/polygon_metrics.h"
+#include "gtest/gtest.h"
+#include <random>
+#include <thread>
+#include <cmath>
+#include <cstdint>
+
+std::random_device rd;  // Will be used to obtain a seed for the random number engine
+std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+
+// Utility functions
+std::vector<Point> CreateRandomPoints(size_t pointsNumber)
+{
+    std::uniform_real_distribution<double> distribution(-10.0, 10.0);
+    std::vector<Point> points = {};
+    for (size_t pointId = 0; pointId < pointsNumber; ++pointId)
+        points.emplace_back(Point(distribution(gen), distribution(gen)));
+    return points;
+}
+
+std::vector<Point> StackToVector(std::stack<Point> stack)
+{
+    std::vector<Point> points(stack.size(), Point(0.0, 0.0));
+    for (size_t pointId = points.size(); pointId > 0; --pointId)
+    {
+        points[pointId - 1] = stack.top();
+        stack.pop();
+    }
+    return points;
+}
+
+TEST(MonotonicArena, Alignment)
+{
+    MonotonicArena arena;
+    for (size_t alignment : {1, 2, 4, 8, 16, 32, 64, 4096})
+    {
+        (void)arena.allocate(1, 1);
+        void* memory = arena.allocate(24, alignment);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(memory) % alignment, 0);
+    }
+}
+
+TEST(MonotonicArena, Reset_reuses_memory)
+{
+    MonotonicArena arena(ArenaOptions{4096, false});
+    void* first = arena.allocate(100, 8);
+    for (size_t allocationId = 0; allocationId < 1000; ++allocationId)
+        (void)arena.allocate(100, 8);
+    const size_t reserved = arena.BytesReserved();
+    ASSERT_GT(arena.BytesUsed(), 100 * 1000);
+
+    arena.Reset();
+    ASSERT_EQ(arena.BytesUsed(), 0);
+    ASSERT_EQ(arena.allocate(100, 8), first);
+    for (size_t allocationId = 0; allocationId < 1000; ++allocationId)
+        (void)arena.allocate(100, 8);
+    // The chunks of the first round are enough for the second one
+    ASSERT_EQ(arena.BytesReserved(), reserved);
+}
+
+TEST(MonotonicArena, Large_allocation)
+{
+    MonotonicArena arena(ArenaOptions{4096, false});
+    char* memory = static_cast<char*>(arena.allocate(100000, 16));
+    memory[0] = 1;
+    memory[99999] = 1;
+    ASSERT_GE(arena.BytesReserved(), 100000);
+
+    // The following allocations still fit after the large one
+    (void)arena.allocate(16, 16);
+    // The chunk of the large allocation is returned to the system by the reset
+    arena.Reset();
+    ASSERT_EQ(arena.BytesReserved(), 0);
+    (void)arena.allocate(16, 16);
+    ASSERT_EQ(arena.BytesReserved(), 4096);
+}
+
+TEST(MonotonicArena, Oversize_chunks_released_on_rewind)
+{
+    MonotonicArena arena(ArenaOptions{4096, false});
+    {
+        ArenaScope outerScope(arena);
+        (void)arena.allocate(100, 8);
+        {
+            ArenaScope scope(arena);
+            for (size_t allocationId = 0; allocationId < 100; ++allocationId)
+                (void)arena.allocate(100, 8);
+            (void)arena.allocate(1000000, 16);
+            ASSERT_GE(arena.BytesReserved(), 1000000);
+        }
+        // Back in the first chunk, which is still in use: only the regular chunks are kept
+        ASSERT_LT(arena.BytesReserved(), 1000000);
+        ASSERT_EQ(arena.BytesReserved() % 4096, 0);
+        ASSERT_EQ(arena.BytesUsed(), 100);
+    }
+    ASSERT_EQ(arena.BytesUsed(), 0);
+
+    // A rewind to a marker outside of the first chunk keeps the large chunks
+    for (size_t allocationId = 0; allocationId < 100; ++allocationId)
+        (void)arena.allocate(100, 8);
+    const MonotonicArena::Marker marker = arena.Mark();
+    ASSERT_GT(marker.chunk, 0);
+    (void)arena.allocate(1000000, 16);
+    arena.Rewind(marker);
+    ASSERT_GE(arena.BytesReserved(), 1000000);
+    arena.Reset();
+    ASSERT_LT(arena.BytesReserved(), 1000000);
+}
+
+TEST(MonotonicArena, Rewind)
+{
+    MonotonicArena arena(ArenaOptions{4096, false});
+    (void)arena.allocate(100, 8);
+    const MonotonicArena::Marker marker = arena.Mark();
+    void* afterMarker = arena.allocate(100, 8);
+    for (size_t allocationId = 0; allocationId < 100; ++allocationId)
+        (void)arena.allocate(100, 8);
+
+    arena.Rewind(marker);
+    ASSERT_EQ(arena.allocate(100, 8), afterMarker);
+}
+
+TEST(MonotonicArena, Huge_pages)
+{
+    MonotonicArena arena(ArenaOptions{size_t(1) << 20, true});
+    std::pmr::vector<double> values(&arena);
+    for (size_t valueId = 0; valueId < 1000000; ++valueId)
+        values.push_back(static_cast<double>(valueId));
+    ASSERT_EQ(values[999999], 999999.0);
+    ASSERT_TRUE(arena.Options().hugePages);
+}
+
+TEST(MonotonicArena, Pmr_containers)
+{
+    MonotonicArena arena;
+    std::pmr::vector<Point> polygon(&arena);
+    for (const Point& point : {Point(0.0, 0.0), Point(1.0, 0.0), Point(1.0, 1.0), Point(0.0, 1.0)})
+        polygon.push_back(point);
+    ASSERT_EQ(polygon.get_allocator().resource(), &arena);
+    ASSERT_GE(arena.BytesUsed(), 4 * sizeof(Point));
+    ASSERT_EQ(polygon_metrics(polygon.data(), polygon.size()).area, 1.0);
+}
+
+TEST(ThreadLocalArena, Per_thread)
+{
+    MonotonicArena* mainArena = &thread_local_arena();
+    ASSERT_EQ(&thread_local_arena(), mainArena);
+
+    MonotonicArena* otherArena = nullptr;
+    std::thread thread([&]() { otherArena = &thread_local_arena(); });
+    thread.join();
+    ASSERT_NE(otherArena, mainArena);
+}
+
+TEST(ArenaScope, Rewinds)
+{
+    MonotonicArena& arena = thread_local_arena();
+    const MonotonicArena::Marker marker = arena.Mark();
+    {
+        ArenaScope scope;
+        std::pmr::vector<double> values(1000, 0.0, scope.Resource());
+        ASSERT_GT(arena.BytesUsed(), 0);
+    }
+    ASSERT_EQ(arena.Mark().chunk, marker.chunk);
+    ASSERT_EQ(arena.Mark().offset, marker.offset);
+}
+
+TEST(ArenaScope, Library_scratch_is_reclaimed)
+{
+    MonotonicArena& arena = thread_local_arena();
+    const std::vector<Point> points = CreateRandomPoints(1000);
+    const std::vector<Point> square = {Point(-5.0, -5.0), Point(5.0, -5.0), Point(5.0, 5.0), Point(-5.0, 5.0)};
+    const size_t used = arena.BytesUsed();
+
+    convex_hull_from_points(points, OrientationPredicate::MixedPrecision);
+    points_are_in_polygon(points, square);
+    clip_convex_polygon(square, BoundingBox{0.0, 0.0, 10.0, 10.0});
+    minkowski_difference(square, square);
+    do_intersect_reference(square, square);
+    ASSERT_EQ(arena.BytesUsed(), used);
+}
+
+TEST(ConvexHull, Memory_resource)
+{
+    for (OrientationPredicate predicate : {OrientationPredicate::Fast, OrientationPredicate::Adaptive, OrientationPredicate::MixedPrecision})
+    {
+        const std::vector<Point> points = CreateRandomPoints(500);
+        const std::vector<Point> expected = StackToVector(convex_hull_from_points(points, predicate));
+
+        MonotonicArena arena;
+        const std::pmr::vector<Point> hull = convex_hull_from_points(points.data(), points.size(), &arena, predicate);
+        ASSERT_EQ(hull.get_allocator().resource(), &arena);
+        ASSERT_EQ(std::vector<Point>(hull.begin(), hull.end()), expected);
+
+        // The hull survives the scratch buffers when it is allocated from the thread arena itself
+        const std::pmr::vector<Point> threadHull = convex_hull_from_points(points.data(), points.size(), &thread_local_arena(), predicate);
+        const std::vector<Point> otherPoints = CreateRandomPoints(500);
+        convex_hull_from_points(otherPoints.data(), otherPoints.size(), std::pmr::get_default_resource(), predicate);
+        ASSERT_EQ(std::vector<Point>(threadHull.begin(), threadHull.end()), expected);
+    }
+}
+
+TEST(PolygonBatch, Memory_resource)
+{
+    MonotonicArena arena;
+    WorkStealingThreadPool pool(4);
+    const BoundingBox rectangle{-5.0, -5.0, 5.0, 5.0};
+    for (size_t batchId = 0; batchId < 3; ++batchId)
+    {
+        {
+            PolygonBatch polygons(&arena);
+            for (size_t polygonId = 0; polygonId < 200; ++polygonId)
+                polygons.Add(StackToVector(convex_hull_from_points(CreateRandomPoints(20))));
+
+            const PolygonBatch clipped = clip_convex_polygons(polygons, rectangle, pool);
+            ASSERT_EQ(clipped.Resource(), &arena);
+            for (size_t polygonId = 0; polygonId < polygons.Size(); ++polygonId)
+                ASSERT_EQ(clipped.ToVector(polygonId), clip_convex_polygon(polygons.ToVector(polygonId), rectangle));
+
+            const std::vector<PolygonMetrics> metrics = polygon_metrics_batch(polygons, pool);
+            for (size_t polygonId = 0; polygonId < polygons.Size(); ++polygonId)
+                ASSERT_NEAR(metrics[polygonId].area, polygon_metrics(polygons.ToVector(polygonId)).area, 1e-9);
+        }
+        // All the memory of the batch is reclaimed at once
+        arena.Reset();
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,12 @@
+/* Compiled as C to check that the header of the C ABI does not depend on C++ */
+#include "polygon_operations/c_api.h"
+
+int c_api_square_hull_size(void)
+{
+    const double points[] = {0.0, 0.0, 1.0, 0.0, 0.5, 0.5, 1.0, 1.0, 0.0, 1.0};
+    double hull[10];
+    size_t hullSize = 0;
+    if (po_convex_hull(points, 5, PO_PREDICATE_ADAPTIVE, hull, &hullSize) != PO_OK)
+        return -1;
+    return (int)hullSize;
+}
@@ -0,0 +1,185 @@
+#include "polygon_operations/c_api.h"
+#include "polygon_operations/convex_hull.h"
+#include "polygon_operations/convex_polygon.h"
+#include "gtest/gtest.h"
+#include <random>
+#include <cmath>
+#include <cstring>
+
+extern "C" int c_api_square_hull_size(void);
+
+std::random_device rd;  // Will be used to obtain a seed for the random number engine
+std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+
+// Utility functions
+std::vector<double> CreateRandomCoordinates(size_t pointsNumber, double minimum, double maximum)
+{
+    std::uniform_real_distribution<double> distribution(minimum, maximum);
+    std::vector<double> coordinates(2 * pointsNumber, 0.0);
+    for (double& coordinate : coordinates)
+        coordinate = distribution(gen);
+    return coordinates;
+}
+
+std::vector<Point> ToPoints(const double* coordinates, size_t pointsNumber)
+{
+    std::vector<Point> points = {};
+    for (size_t pointId = 0; pointId < pointsNumber; ++pointId)
+        points.emplace_back(Point(coordinates[2 * pointId], coordinates[2 * pointId + 1]));
+    return points;
+}
+
+// Random polygon with counterclockwise vertices on a circle, as coordinates
+std::vector<double> CreateRandomPolygon(double centerX, double centerY, double radius, size_t verticesNumber)
+{
+    std::uniform_real_distribution<double> angleDistribution(0.0, 2.0 * M_PI);
+    std::vector<double> angles(verticesNumber, 0.0);
+    for (double& angle : angles)
+        angle = angleDistribution(gen);
+    std::sort(angles.begin(), angles.end());
+
+    std::vector<double> coordinates = {};
+    for (double angle : angles)
+    {
+        coordinates.push_back(centerX + radius * cos(angle));
+        coordinates.push_back(centerY + radius * sin(angle));
+    }
+    return coordinates;
+}
+
+TEST(CApi, Version_and_header)
+{
+    ASSERT_EQ(po_abi_version(), PO_ABI_VERSION);
+    ASSERT_EQ(c_api_square_hull_size(), 4);
+    ASSERT_STREQ(po_last_error_message(), "");
+}
+
+TEST(CApi, Convex_hull)
+{
+    const std::vector<double> coordinates = CreateRandomCoordinates(1000, -1.0, 1.0);
+    const std::vector<Point> expected = StackToVectorFromBottom(convex_hull_from_points(ToPoints(coordinates.data(), 1000)));
+
+    std::vector<double> hull(coordinates.size(), 0.0);
+    size_t hullSize = 0;
+    ASSERT_EQ(po_convex_hull(coordinates.data(), 1000, PO_PREDICATE_FAST, hull.data(), &hullSize), PO_OK);
+    ASSERT_EQ(ToPoints(hull.data(), hullSize), expected);
+
+    // Errors are returned as codes with a message
+    const double collinear[] = {0.0, 0.0, 1.0, 1.0, 2.0, 2.0};
+    ASSERT_EQ(po_convex_hull(collinear, 3, PO_PREDICATE_ADAPTIVE, hull.data(), &hullSize), PO_INVALID_ARGUMENT);
+    ASSERT_GT(std::strlen(po_last_error_message()), 0);
+    ASSERT_EQ(po_convex_hull(collinear, 2, PO_PREDICATE_ADAPTIVE, hull.data(), &hullSize), PO_INVALID_ARGUMENT);
+    ASSERT_EQ(po_convex_hull(nullptr, 3, PO_PREDICATE_ADAPTIVE, hull.data(), &hullSize), PO_INVALID_ARGUMENT);
+    ASSERT_EQ(po_convex_hull(collinear, 3, static_cast<po_predicate>(7), hull.data(), &hullSize), PO_INVALID_ARGUMENT);
+}
+
+TEST(CApi, Convex_hull_with_collinear_points_on_the_first_ray)
+{
+    // Square with three more points on its bottom edge, which is the first ray from the lowest point
+    const double square[] = {2.0, 0.0, 0.0, 2.0, 1.0, 0.0, 3.0, 3.0, 0.0, 0.0, 3.0, 0.0, 0.0, 3.0, 2.5, 0.0};
+    const std::vector<Point> expected = {Point(0.0, 0.0), Point(3.0, 0.0), Point(3.0, 3.0), Point(0.0, 3.0)};
+    for (po_predicate predicate : {PO_PREDICATE_FAST, PO_PREDICATE_ADAPTIVE, PO_PREDICATE_MIXED_PRECISION})
+    {
+        std::vector<double> hull(16, 0.0);
+        size_t hullSize = 0;
+        ASSERT_EQ(po_convex_hull(square, 8, predicate, hull.data(), &hullSize), PO_OK);
+        ASSERT_EQ(ToPoints(hull.data(), hullSize), expected);
+
+        const uint64_t offsets[] = {0, 8, 16};
+        double squares[32] = {};
+        std::memcpy(squares, square, sizeof(square));
+        std::memcpy(squares + 16, square, sizeof(square));
+        std::vector<double> hulls(32, 0.0);
+        std::vector<uint64_t> hullOffsets(3, 0);
+        ASSERT_EQ(po_convex_hulls(squares, offsets, 2, predicate, hulls.data(), hullOffsets.data()), PO_OK);
+        ASSERT_EQ(ToPoints(hulls.data() + 2 * hullOffsets[1], hullOffsets[2] - hullOffsets[1]), expected);
+    }
+}
+
+TEST(CApi, Convex_hulls_batch)
+{
+    std::vector<double> coordinates = {};
+    std::vector<uint64_t> offsets = {0};
+    for (size_t setId = 0; setId < 100; ++setId)
+    {
+        const std::vector<double> set = CreateRandomCoordinates(3 + setId, -1.0, 1.0);
+        coordinates.insert(coordinates.end(), set.begin(), set.end());
+        offsets.push_back(offsets.back() + 3 + setId);
+    }
+
+    std::vector<double> hulls(coordinates.size(), 0.0);
+    std::vector<uint64_t> hullOffsets(offsets.size(), 0);
+    ASSERT_EQ(po_convex_hulls(coordinates.data(), offsets.data(), 100, PO_PREDICATE_MIXED_PRECISION, hulls.data(), hullOffsets.data()), PO_OK);
+    for (size_t setId = 0; setId < 100; ++setId)
+    {
+        const std::vector<Point> set = ToPoints(coordinates.data() + 2 * offsets[setId], offsets[setId + 1] - offsets[setId]);
+        const std::vector<Point> expected = StackToVectorFromBottom(convex_hull_from_points(set, OrientationPredicate::MixedPrecision));
+        ASSERT_EQ(ToPoints(hulls.data() + 2 * hullOffsets[setId], hullOffsets[setId + 1] - hullOffsets[setId]), expected);
+    }
+
+    const std::vector<uint64_t> decreasing = {0, 5, 3};
+    ASSERT_EQ(po_convex_hulls(coordinates.data(), decreasing.data(), 2, PO_PREDICATE_FAST, hulls.data(), hullOffsets.data()), PO_INVALID_ARGUMENT);
+    ASSERT_EQ(po_convex_hulls(nullptr, offsets.data(), 0, PO_PREDICATE_FAST, nullptr, hullOffsets.data()), PO_OK);
+}
+
+TEST(CApi, Points_in_polygon)
+{
+    const std::vector<double> polygon = CreateRandomPolygon(0.0, 0.0, 1.0, 20);
+    const std::vector<double> coordinates = CreateRandomCoordinates(1000, -1.5, 1.5);
+    const std::vector<bool> expected = points_are_in_polygon(ToPoints(coordinates.data(), 1000), ToPoints(polygon.data(), 20));
+
+    std::vector<uint8_t> inside(1000, 2);
+    ASSERT_EQ(po_points_in_polygon(coordinates.data(), 1000, polygon.data(), 20, PO_PREDICATE_MIXED_PRECISION, inside.data()), PO_OK);
+    for (size_t pointId = 0; pointId < 1000; ++pointId)
+        ASSERT_EQ(inside[pointId], expected[pointId] ? 1 : 0);
+
+    ASSERT_EQ(po_points_in_polygon(coordinates.data(), 1000, polygon.data(), 2, PO_PREDICATE_FAST, inside.data()), PO_INVALID_ARGUMENT);
+}
+
+TEST(CApi, Intersect_pairs)
+{
+    std::vector<double> vertices = {};
+    std::vector<uint64_t> offsets = {0};
+    std::vector<std::vector<Point>> polygons = {};
+    std::uniform_real_distribution<double> centerDistribution(-3.0, 3.0);
+    std::uniform_int_distribution<size_t> sizeDistribution(3, 20);
+    for (size_t polygonId = 0; polygonId < 100; ++polygonId)
+    {
+        const size_t polygonSize = sizeDistribution(gen);
+        const std::vector<double> polygon = CreateRandomPolygon(centerDistribution(gen), centerDistribution(gen), 1.0, polygonSize);
+        vertices.insert(vertices.end(), polygon.begin(), polygon.end());
+        offsets.push_back(offsets.back() + polygonSize);
+        polygons.push_back(ToPoints(polygon.data(), polygonSize));
+    }
+
+    std::vector<uint64_t> pairs = {};
+    for (uint64_t polygon1 = 0; polygon1 < 100; ++polygon1)
+    {
+        for (uint64_t polygon2 = polygon1 + 1; polygon2 < 100; ++polygon2)
+        {
+            pairs.push_back(polygon1);
+            pairs.push_back(polygon2);
+        }
+    }
+
+    const size_t pairsNumber = pairs.size() / 2;
+    std::vector<uint8_t> intersecting(pairsNumber, 2);
+    ASSERT_EQ(po_do_intersect_pairs(vertices.data(), offsets.data(), 100, pairs.data(), pairsNumber, intersecting.data()), PO_OK);
+    size_t intersectingPairs = 0;
+    for (size_t pairId = 0; pairId < pairsNumber; ++pairId)
+    {
+        ASSERT_EQ(intersecting[pairId], do_intersect(polygons[pairs[2 * pairId]], polygons[pairs[2 * pairId + 1]]) ? 1 : 0);
+        intersectingPairs += intersecting[pairId];
+    }
+    ASSERT_GT(intersectingPairs, 0);
+
+    const uint64_t outOfRange[] = {0, 100};
+    ASSERT_EQ(po_do_intersect_pairs(vertices.data(), offsets.data(), 100, outOfRange, 1, intersecting.data()), PO_INVALID_ARGUMENT);
+    ASSERT_EQ(po_do_intersect_pairs(vertices.data(), offsets.data(), 100, pairs.data(), 0, nullptr), PO_OK);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
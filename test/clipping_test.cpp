@@ -0,0 +1,170 @@
+#include "polygon_operations/clipping.h"
+#include "polygon_operations/convex_intersection.h"
+#include "gtest/gtest.h"
+#include "test_utilities.h"
+#include <random>
+#include <cmath>
+
+std::random_device rd;  // Will be used to obtain a seed for the random number engine
+std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+
+// Utility functions
+std::vector<Point> CreateRandomPolygon()
+{
+    std::uniform_real_distribution<double> centerDistribution(-3.0, 3.0);
+    std::uniform_real_distribution<double> radiusDistribution(0.1, 1.5);
+    std::uniform_int_distribution<size_t> sizeDistribution(3, 30);
+    std::vector<Point> polygon = {};
+    while (polygon.size() < 3)
+        polygon = CreateRandomConvexPolygon(centerDistribution(gen), centerDistribution(gen), radiusDistribution(gen), sizeDistribution(gen));
+    return polygon;
+}
+
+double Area(const std::vector<Point>& polygon)
+{
+    double doubleArea = 0.0;
+    for (size_t vertexId = 0; vertexId < polygon.size(); ++vertexId)
+    {
+        const Point& current = polygon[vertexId];
+        const Point& next = polygon[(vertexId + 1) % polygon.size()];
+        doubleArea += current.x * next.y - next.x * current.y;
+    }
+    return doubleArea / 2.0;
+}
+
+TEST(Clipping, Square_against_half_plane)
+{
+    std::vector<Point> square = {{0, 0}, {2, 0}, {2, 2}, {0, 2}};
+
+    // Keep x <= 1
+    std::vector<Point> clipped = clip_convex_polygon(square, Vector(1, 0), 1.0);
+    ASSERT_EQ(clipped, std::vector<Point>({{0, 0}, {1, 0}, {1, 2}, {0, 2}}));
+
+    // Keep x + y <= 1, a corner triangle
+    clipped = clip_convex_polygon(square, Vector(1, 1), 1.0);
+    ASSERT_EQ(clipped.size(), 3);
+    ASSERT_DOUBLE_EQ(Area(clipped), 0.5);
+
+    // Boundary through two vertices, without repeated vertices
+    clipped = clip_convex_polygon(square, Vector(1, 1), 2.0);
+    ASSERT_EQ(clipped, std::vector<Point>({{0, 0}, {2, 0}, {0, 2}}));
+
+    // Everything and nothing kept, and an edge only touching the line
+    ASSERT_EQ(clip_convex_polygon(square, Vector(1, 0), 5.0), square);
+    ASSERT_TRUE(clip_convex_polygon(square, Vector(1, 0), -1.0).empty());
+    ASSERT_TRUE(clip_convex_polygon(square, Vector(1, 0), 0.0).empty());
+}
+
+TEST(Clipping, Half_plane_complements)
+{
+    std::uniform_real_distribution<double> angleDistribution(0.0, 2.0 * M_PI);
+    std::uniform_real_distribution<double> offsetDistribution(-3.0, 3.0);
+    for (size_t iter = 0; iter < 2000; ++iter)
+    {
+        std::vector<Point> polygon = CreateRandomPolygon();
+        const double angle = angleDistribution(gen);
+        const Vector normal(cos(angle), sin(angle));
+        const double offset = offsetDistribution(gen);
+
+        std::vector<Point> inside = clip_convex_polygon(polygon, normal, offset);
+        std::vector<Point> outside = clip_convex_polygon(polygon, Vector(-normal.x, -normal.y), -offset);
+        ASSERT_NEAR(Area(inside) + Area(outside), Area(polygon), 1e-12);
+        ASSERT_LE(inside.size(), polygon.size() + 1);
+        for (const auto& vertex : inside)
+            ASSERT_LE(DotProduct(normal, vertex), offset + 1e-12);
+        for (const auto& vertex : polygon)
+            if (DotProduct(normal, vertex) <= offset)
+            {
+                ASSERT_NE(std::find(inside.begin(), inside.end(), vertex), inside.end());
+            }
+    }
+}
+
+TEST(Clipping, Rectangle_against_intersection)
+{
+    const BoundingBox rectangle{-1.0, -0.5, 1.5, 2.0};
+    std::vector<Point> rectanglePolygon = {{-1.0, -0.5}, {1.5, -0.5}, {1.5, 2.0}, {-1.0, 2.0}};
+    std::vector<Point> intersection = {};
+    for (size_t iter = 0; iter < 2000; ++iter)
+    {
+        std::vector<Point> polygon = CreateRandomPolygon();
+        std::vector<Point> clipped = clip_convex_polygon(polygon, rectangle);
+        convex_polygon_intersection(polygon, rectanglePolygon, intersection);
+        ASSERT_NEAR(Area(clipped), Area(intersection), 1e-12);
+        ASSERT_LE(clipped.size(), polygon.size() + 4);
+        for (const auto& vertex : clipped)
+        {
+            ASSERT_TRUE((rectangle.minX <= vertex.x) && (vertex.x <= rectangle.maxX));
+            ASSERT_TRUE((rectangle.minY <= vertex.y) && (vertex.y <= rectangle.maxY));
+        }
+    }
+}
+
+TEST(Clipping, Batch_against_single)
+{
+    PolygonBatch polygons;
+    for (size_t polygonId = 0; polygonId < 3000; ++polygonId)
+        polygons.Add(CreateRandomPolygon());
+    polygons.Add({});
+    const BoundingBox rectangle{-1.0, -1.0, 1.0, 1.0};
+
+    WorkStealingThreadPool pool(4);
+    const PolygonBatch clipped = clip_convex_polygons(polygons, rectangle, pool);
+    ASSERT_EQ(clipped.Size(), polygons.Size());
+    ASSERT_EQ(clipped.offsets.back(), clipped.vertices.size());
+    size_t passedThrough = 0;
+    size_t dropped = 0;
+    for (size_t polygonId = 0; polygonId < polygons.Size(); ++polygonId)
+    {
+        const std::vector<Point> polygon = polygons.ToVector(polygonId);
+        const std::vector<Point> expected = clip_convex_polygon(polygon, rectangle);
+        ASSERT_EQ(clipped.ToVector(polygonId), expected);
+        passedThrough += (!polygon.empty() && (expected == polygon));
+        dropped += expected.empty();
+    }
+    ASSERT_GT(passedThrough, 0);
+    ASSERT_GT(dropped, 0);
+
+    ASSERT_EQ(clip_convex_polygons(PolygonBatch(), rectangle, pool).Size(), 0);
+}
+
+TEST(Clipping, Non_convex_entry_does_not_overflow)
+{
+    // A comb whose teeth alternate above and below the top side of the rectangle, crossing it at every edge
+    std::vector<Point> comb = {{-1.0, -1.0}, {11.0, -1.0}};
+    for (size_t toothId = 0; toothId <= 24; ++toothId)
+        comb.emplace_back(Point(11.0 - 0.5 * toothId, (toothId % 2 == 0) ? 2.0 : 0.5));
+    const BoundingBox rectangle{0.0, 0.0, 10.0, 1.0};
+
+    const std::vector<Point> expected = clip_convex_polygon(comb, rectangle);
+    ASSERT_GT(expected.size(), comb.size() + 4);
+    for (const auto& vertex : expected)
+    {
+        ASSERT_TRUE((rectangle.minX <= vertex.x) && (vertex.x <= rectangle.maxX));
+        ASSERT_TRUE((rectangle.minY <= vertex.y) && (vertex.y <= rectangle.maxY));
+    }
+
+    PolygonBatch polygons;
+    for (size_t polygonId = 0; polygonId < 100; ++polygonId)
+    {
+        polygons.Add(CreateRandomPolygon());
+        if (polygonId % 10 == 0)
+            polygons.Add(comb);
+    }
+    WorkStealingThreadPool pool(4);
+    const PolygonBatch clipped = clip_convex_polygons(polygons, rectangle, pool);
+    ASSERT_EQ(clipped.Size(), polygons.Size());
+    for (size_t polygonId = 0; polygonId < polygons.Size(); ++polygonId)
+        ASSERT_EQ(clipped.ToVector(polygonId), clip_convex_polygon(polygons.ToVector(polygonId), rectangle));
+
+    // The buffer of the pointer variant is only sized for convex polygons
+    std::vector<Point> buffer(comb.size() + 1, Point(0.0, 0.0));
+    ASSERT_THROW(clip_convex_polygon(comb.data(), comb.size(), Vector(0.0, 1.0), 1.0, buffer.data()), std::invalid_argument);
+    ASSERT_GT(clip_convex_polygon(comb, Vector(0.0, 1.0), 1.0).size(), comb.size() + 1);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,224 @@
+#include "polygon_operations/continuous_collision.h"
+#include "polygon_operations/convex_polygon.h"
+#include "polygon_operations/gjk.h"
+#include "gtest/gtest.h"
+#include "test_utilities.h"
+#include <random>
+#include <cmath>
+
+std::random_device rd;  // Will be used to obtain a seed for the random number engine
+std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+
+// Utility functions
+PolygonMotion CreateRandomMotion(const Point& center, bool rotating)
+{
+    std::uniform_real_distribution<double> velocityDistribution(-4.0, 4.0);
+    std::uniform_real_distribution<double> angularDistribution(-3.0, 3.0);
+    PolygonMotion motion;
+    motion.linearVelocity = Vector(velocityDistribution(gen), velocityDistribution(gen));
+    motion.angularVelocity = rotating ? angularDistribution(gen) : 0.0;
+    motion.rotationCenter = center;
+    return motion;
+}
+
+std::vector<Point> AtTime(const std::vector<Point>& polygon, const PolygonMotion& motion, double time)
+{
+    const double angle = motion.angularVelocity * time;
+    std::vector<Point> moved = {};
+    for (const auto& vertex : polygon)
+    {
+        const double armX = vertex.x - motion.rotationCenter.x;
+        const double armY = vertex.y - motion.rotationCenter.y;
+        moved.emplace_back(Point(motion.rotationCenter.x + cos(angle) * armX - sin(angle) * armY + motion.linearVelocity.x * time,
+                                 motion.rotationCenter.y + sin(angle) * armX + cos(angle) * armY + motion.linearVelocity.y * time));
+    }
+    return moved;
+}
+
+TEST(TimeOfImpact, Head_on_squares)
+{
+    std::vector<Point> square1 = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+    std::vector<Point> square2 = {{3, 0}, {4, 0}, {4, 1}, {3, 1}};
+    PolygonMotion motion1;
+    motion1.linearVelocity = Vector(2.5, 0.0);
+    PolygonMotion motion2;
+    motion2.linearVelocity = Vector(-2.5, 0.0);
+
+    const TimeOfImpact impact = time_of_impact(square1, motion1, square2, motion2, 1.0);
+    ASSERT_TRUE(impact.hit);
+    ASSERT_NEAR(impact.time, 0.4, 1e-9);
+    ASSERT_NEAR(impact.normal.x, 1.0, 1e-9);
+    ASSERT_NEAR(impact.normal.y, 0.0, 1e-9);
+
+    // Contact after the end of the interval
+    ASSERT_FALSE(time_of_impact(square1, motion1, square2, motion2, 0.3).hit);
+}
+
+TEST(TimeOfImpact, Tunneling_and_miss)
+{
+    // A thin wall crossed within a single step of a discrete simulation
+    std::vector<Point> bullet = {{0, 0}, {0.1, 0}, {0.1, 0.1}, {0, 0.1}};
+    std::vector<Point> wall = {{5, -1}, {5.05, -1}, {5.05, 1}, {5, 1}};
+    PolygonMotion bulletMotion;
+    bulletMotion.linearVelocity = Vector(100.0, 0.0);
+    PolygonMotion wallMotion;
+
+    ASSERT_FALSE(do_intersect(AtTime(bullet, bulletMotion, 0.1), wall));
+    TimeOfImpact impact = time_of_impact(bullet, bulletMotion, wall, wallMotion, 0.1);
+    ASSERT_TRUE(impact.hit);
+    ASSERT_NEAR(impact.time, 0.049, 1e-9);
+
+    // Moving away and passing by
+    bulletMotion.linearVelocity = Vector(-100.0, 0.0);
+    ASSERT_FALSE(time_of_impact(bullet, bulletMotion, wall, wallMotion, 0.1).hit);
+    bulletMotion.linearVelocity = Vector(100.0, 100.0);
+    impact = time_of_impact(bullet, bulletMotion, wall, wallMotion, 0.1);
+    ASSERT_FALSE(impact.hit);
+    ASSERT_EQ(impact.time, 0.1);
+}
+
+TEST(TimeOfImpact, Initial_overlap)
+{
+    std::vector<Point> square1 = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+    std::vector<Point> square2 = {{0.8, 0.1}, {1.8, 0.1}, {1.8, 1.1}, {0.8, 1.1}};
+    const TimeOfImpact impact = time_of_impact(square1, PolygonMotion(), square2, PolygonMotion(), 1.0);
+    ASSERT_TRUE(impact.hit);
+    ASSERT_EQ(impact.time, 0.0);
+    ASSERT_NEAR(impact.normal.x, 1.0, 1e-12);
+    ASSERT_NEAR(impact.normal.y, 0.0, 1e-12);
+}
+
+TEST(TimeOfImpact, Rotating_bar)
+{
+    // A bar of half length 2 rotating around the origin hits a box placed above its end
+    std::vector<Point> bar = {{-2, -0.05}, {2, -0.05}, {2, 0.05}, {-2, 0.05}};
+    std::vector<Point> box = {{1, 1}, {1.5, 1}, {1.5, 1.5}, {1, 1.5}};
+    PolygonMotion barMotion;
+    barMotion.angularVelocity = 1.0;
+
+    const TimeOfImpact impact = time_of_impact(bar, barMotion, box, PolygonMotion(), M_PI);
+    ASSERT_TRUE(impact.hit);
+    ASSERT_NEAR(gjk_query(AtTime(bar, barMotion, impact.time), box).distance, 0.0, 1e-8);
+    ASSERT_FALSE(do_intersect(AtTime(bar, barMotion, impact.time - 1e-6), box));
+    ASSERT_GT(impact.normal.y, 0.0);
+}
+
+TEST(TimeOfImpact, Conservative_when_out_of_steps)
+{
+    // The rotating bar needs many steps, since its approach speed is bounded by the speed of its end
+    std::vector<Point> bar = {{-2, -0.05}, {2, -0.05}, {2, 0.05}, {-2, 0.05}};
+    std::vector<Point> box = {{1, 1}, {1.5, 1}, {1.5, 1.5}, {1, 1.5}};
+    PolygonMotion barMotion;
+    barMotion.angularVelocity = 1.0;
+
+    const TimeOfImpact converged = time_of_impact(bar, barMotion, box, PolygonMotion(), M_PI);
+    ASSERT_TRUE(converged.converged);
+    ASSERT_GT(converged.iterations, 3);
+
+    const TimeOfImpact impact = time_of_impact(bar, barMotion, box, PolygonMotion(), M_PI, 1e-9, 3);
+    ASSERT_TRUE(impact.hit);
+    ASSERT_FALSE(impact.converged);
+    ASSERT_EQ(impact.iterations, 3);
+    ASSERT_GT(impact.time, 0.0);
+    ASSERT_LT(impact.time, converged.time);
+    ASSERT_FALSE(do_intersect(AtTime(bar, barMotion, impact.time), box));
+
+    // Disjoint polygons moving apart are proven to never touch in a single step
+    const TimeOfImpact miss = time_of_impact(bar, PolygonMotion(), box, PolygonMotion(), 1.0, 1e-9, 1);
+    ASSERT_FALSE(miss.hit);
+    ASSERT_TRUE(miss.converged);
+
+    ASSERT_THROW(time_of_impact(bar, barMotion, box, PolygonMotion(), M_PI, 1e-9, 0), std::invalid_argument);
+}
+
+TEST(TimeOfImpact, Random_against_sampling)
+{
+    std::uniform_real_distribution<double> centerDistribution(-4.0, 4.0);
+    std::uniform_real_distribution<double> radiusDistribution(0.2, 1.0);
+    std::uniform_int_distribution<size_t> sizeDistribution(3, 12);
+    const size_t samplesNumber = 400;
+    for (size_t iter = 0; iter < 300; ++iter)
+    {
+        const Point center1(centerDistribution(gen), centerDistribution(gen));
+        const Point center2(centerDistribution(gen), centerDistribution(gen));
+        std::vector<Point> polygon1 = CreateRandomConvexPolygon(center1.x, center1.y, radiusDistribution(gen), sizeDistribution(gen));
+        std::vector<Point> polygon2 = CreateRandomConvexPolygon(center2.x, center2.y, radiusDistribution(gen), sizeDistribution(gen));
+        if (polygon1.size() < 3 || polygon2.size() < 3 || do_intersect(polygon1, polygon2))
+            continue;
+        const PolygonMotion motion1 = CreateRandomMotion(center1, iter % 2 == 0);
+        const PolygonMotion motion2 = CreateRandomMotion(center2, iter % 3 == 0);
+
+        const TimeOfImpact impact = time_of_impact(polygon1, motion1, polygon2, motion2, 1.0, 1e-9, 1000);
+
+        // No sampled time before the time of impact has intersecting polygons
+        double firstSampledContact = 2.0;
+        for (size_t sample = 0; sample <= samplesNumber; ++sample)
+        {
+            const double time = static_cast<double>(sample) / samplesNumber;
+            if (do_intersect(AtTime(polygon1, motion1, time), AtTime(polygon2, motion2, time)))
+            {
+                firstSampledContact = time;
+                break;
+            }
+        }
+        ASSERT_LE(impact.time, firstSampledContact + 1e-12);
+        if (firstSampledContact <= 1.0)
+        {
+            ASSERT_TRUE(impact.hit);
+        }
+        if (impact.hit && impact.converged)
+        {
+            ASSERT_NEAR(gjk_query(AtTime(polygon1, motion1, impact.time), AtTime(polygon2, motion2, impact.time)).distance, 0.0, 1e-8);
+        }
+    }
+}
+
+TEST(TimeOfImpact, Batch_against_single)
+{
+    std::uniform_real_distribution<double> centerDistribution(-10.0, 10.0);
+    std::vector<std::vector<Point>> polygons = {};
+    std::vector<PolygonMotion> motions = {};
+    for (size_t polygonId = 0; polygonId < 100; ++polygonId)
+    {
+        const Point center(centerDistribution(gen), centerDistribution(gen));
+        polygons.push_back(CreateRandomConvexPolygon(center.x, center.y, 0.8, 10));
+        motions.push_back(CreateRandomMotion(center, polygonId % 2 == 0));
+    }
+    std::vector<PolygonPair> candidatePairs = {};
+    for (size_t id1 = 0; id1 < polygons.size(); ++id1)
+        for (size_t id2 = id1 + 1; id2 < polygons.size(); id2 += 7)
+            candidatePairs.emplace_back(id1, id2);
+
+    WorkStealingThreadPool pool(4);
+    const std::vector<TimeOfImpact> impacts = time_of_impact_batch(polygons, motions, candidatePairs, 1.0, pool);
+    ASSERT_EQ(impacts.size(), candidatePairs.size());
+    for (size_t pairId = 0; pairId < candidatePairs.size(); ++pairId)
+    {
+        const PolygonPair& pair = candidatePairs[pairId];
+        const TimeOfImpact impact = time_of_impact(polygons[pair.first], motions[pair.first],
+                                                   polygons[pair.second], motions[pair.second], 1.0);
+        ASSERT_EQ(impacts[pairId].hit, impact.hit);
+        ASSERT_EQ(impacts[pairId].time, impact.time);
+    }
+
+    // The limit of steps is passed to every pair
+    const std::vector<TimeOfImpact> limitedImpacts = time_of_impact_batch(polygons, motions, candidatePairs, 1.0, pool, 1e-9, 2);
+    for (size_t pairId = 0; pairId < candidatePairs.size(); ++pairId)
+    {
+        const PolygonPair& pair = candidatePairs[pairId];
+        const TimeOfImpact impact = time_of_impact(polygons[pair.first], motions[pair.first],
+                                                   polygons[pair.second], motions[pair.second], 1.0, 1e-9, 2);
+        ASSERT_LE(limitedImpacts[pairId].iterations, 2);
+        ASSERT_EQ(limitedImpacts[pairId].converged, impact.converged);
+        ASSERT_EQ(limitedImpacts[pairId].time, impact.time);
+    }
+
+    motions.pop_back();
+    ASSERT_THROW(time_of_impact_batch(polygons, motions, candidatePairs, 1.0, pool), std::invalid_argument);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
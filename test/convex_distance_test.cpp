@@ -0,0 +1,145 @@
+#include "polygon_operations/convex_distance.h"
+#include "polygon_operations/convex_polygon.h"
+#include "gtest/gtest.h"
+#include "test_utilities.h"
+#include <random>
+#include <cmath>
+#include <limits>
+
+std::random_device rd;  // Will be used to obtain a seed for the random number engine
+std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+
+// Utility functions
+std::vector<Point> CreateRandomPolygon(size_t maximumSize)
+{
+    std::uniform_real_distribution<double> centerDistribution(-4.0, 4.0);
+    std::uniform_real_distribution<double> radiusDistribution(0.2, 1.5);
+    std::uniform_int_distribution<size_t> sizeDistribution(3, maximumSize);
+    std::vector<Point> polygon = {};
+    while (polygon.size() < 3)
+        polygon = CreateRandomConvexPolygon(centerDistribution(gen), centerDistribution(gen), radiusDistribution(gen), sizeDistribution(gen));
+    return polygon;
+}
+
+double PointSegmentDistance(const Point& point, const Point& tail, const Point& head)
+{
+    const Vector edge(tail, head);
+    const double t = std::min(1.0, std::max(0.0, DotProduct(Vector(tail, point), edge) / DotProduct(edge, edge)));
+    return EuclideanDistance(point, Point(tail.x + t * edge.x, tail.y + t * edge.y));
+}
+
+// Minimum over all the vertex-edge pairs of the two polygons, with O(nm) complexity
+double DistanceReference(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2)
+{
+    if (do_intersect(polygon1, polygon2))
+        return 0.0;
+
+    double distance = std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < polygon1.size(); ++i)
+    {
+        for (size_t j = 0; j < polygon2.size(); ++j)
+        {
+            distance = std::min(distance, PointSegmentDistance(polygon1[i], polygon2[j], polygon2[(j + 1) % polygon2.size()]));
+            distance = std::min(distance, PointSegmentDistance(polygon2[j], polygon1[i], polygon1[(i + 1) % polygon1.size()]));
+        }
+    }
+    return distance;
+}
+
+// Distance of a point from the boundary of a polygon
+double BoundaryDistance(const Point& point, const std::vector<Point>& polygon)
+{
+    double distance = std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < polygon.size(); ++i)
+        distance = std::min(distance, PointSegmentDistance(point, polygon[i], polygon[(i + 1) % polygon.size()]));
+    return distance;
+}
+
+void CheckWitnesses(const PolygonDistance& result, const std::vector<Point>& polygon1, const std::vector<Point>& polygon2)
+{
+    ASSERT_NEAR(EuclideanDistance(result.witness1, result.witness2), result.distance, 1e-12);
+    ASSERT_NEAR(BoundaryDistance(result.witness1, polygon1), 0.0, 1e-12);
+    ASSERT_NEAR(BoundaryDistance(result.witness2, polygon2), 0.0, 1e-12);
+}
+
+TEST(ConvexDistance, Squares)
+{
+    std::vector<Point> square1 = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+    std::vector<Point> square2 = {{3, 0.5}, {4, 0.5}, {4, 1.5}, {3, 1.5}};
+    std::vector<Point> square3 = {{2, 2}, {3, 2}, {3, 3}, {2, 3}};
+
+    PolygonDistance result = convex_polygon_distance(square1, square2);
+    ASSERT_DOUBLE_EQ(result.distance, 2.0);
+    ASSERT_DOUBLE_EQ(result.witness1.x, 1.0);
+    ASSERT_DOUBLE_EQ(result.witness2.x, 3.0);
+
+    // Vertex to vertex
+    result = convex_polygon_distance(square1, square3);
+    ASSERT_DOUBLE_EQ(result.distance, std::sqrt(2.0));
+    ASSERT_EQ(result.witness1, Point(1, 1));
+    ASSERT_EQ(result.witness2, Point(2, 2));
+    result = convex_polygon_distance_logarithmic(square1, square3);
+    ASSERT_DOUBLE_EQ(result.distance, std::sqrt(2.0));
+    ASSERT_EQ(result.witness1, Point(1, 1));
+    ASSERT_EQ(result.witness2, Point(2, 2));
+
+    // Intersecting and touching
+    std::vector<Point> square4 = {{0.5, 0.5}, {1.5, 0.5}, {1.5, 1.5}, {0.5, 1.5}};
+    std::vector<Point> square5 = {{1, 0}, {2, 0}, {2, 1}, {1, 1}};
+    ASSERT_EQ(convex_polygon_distance(square1, square4).distance, 0.0);
+    ASSERT_EQ(convex_polygon_distance_logarithmic(square1, square4).distance, 0.0);
+    ASSERT_EQ(convex_polygon_distance(square1, square5).distance, 0.0);
+
+    ASSERT_THROW(convex_polygon_distance(square1, {{0, 0}, {1, 1}}), std::invalid_argument);
+    ASSERT_THROW(convex_polygons_closer_than(square1, {{0, 0}, {1, 1}}, 1.0), std::invalid_argument);
+}
+
+TEST(ConvexDistance, Calipers_against_reference)
+{
+    for (size_t iter = 0; iter < 2000; ++iter)
+    {
+        std::vector<Point> polygon1 = CreateRandomPolygon(30);
+        std::vector<Point> polygon2 = CreateRandomPolygon(30);
+
+        const PolygonDistance result = convex_polygon_distance(polygon1, polygon2);
+        ASSERT_NEAR(result.distance, DistanceReference(polygon1, polygon2), 1e-12);
+        if (result.distance > 0.0)
+            CheckWitnesses(result, polygon1, polygon2);
+    }
+}
+
+TEST(ConvexDistance, Logarithmic_against_calipers)
+{
+    for (size_t iter = 0; iter < 2000; ++iter)
+    {
+        std::vector<Point> polygon1 = CreateRandomPolygon((iter % 2 == 0) ? 10 : 1000);
+        std::vector<Point> polygon2 = CreateRandomPolygon((iter % 3 == 0) ? 10 : 1000);
+
+        const PolygonDistance expected = convex_polygon_distance(polygon1, polygon2);
+        const PolygonDistance result = convex_polygon_distance_logarithmic(polygon1, polygon2);
+        ASSERT_NEAR(result.distance, expected.distance, 1e-12);
+        if (result.distance > 0.0)
+            CheckWitnesses(result, polygon1, polygon2);
+    }
+}
+
+TEST(ConvexDistance, Closer_than_against_distance)
+{
+    std::uniform_real_distribution<double> thresholdDistribution(0.0, 3.0);
+    for (size_t iter = 0; iter < 2000; ++iter)
+    {
+        std::vector<Point> polygon1 = CreateRandomPolygon(30);
+        std::vector<Point> polygon2 = CreateRandomPolygon(30);
+
+        const double distance = convex_polygon_distance(polygon1, polygon2).distance;
+        const double threshold = thresholdDistribution(gen);
+        ASSERT_EQ(convex_polygons_closer_than(polygon1, polygon2, threshold), distance < threshold);
+        ASSERT_FALSE(convex_polygons_closer_than(polygon1, polygon2, 0.0));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
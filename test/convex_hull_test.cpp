@@ -1,5 +1,6 @@
 #include "polygon_operations/convex_hull.h"
 #include "gtest/gtest.h"
+#include <algorithm>
 #include <random>
 #include <chrono>
 
@@ -163,6 +164,58 @@ TEST(ConvexHull, Collinear_points)
 }
 
 
+TEST(ConvexHull, Views_against_stack)
+{
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+    for (OrientationPredicate predicate : {OrientationPredicate::Fast, OrientationPredicate::Adaptive, OrientationPredicate::MixedPrecision})
+    {
+        std::vector<Point> points = {};
+        for (size_t iter = 0; iter < 2000; ++iter)
+            points.emplace_back(Point(distribution(gen), distribution(gen)));
+        const std::vector<Point> expected = StackToVectorFromBottom(convex_hull_from_points(points, predicate));
+
+        // Output buffer, leaving the points untouched
+        const std::vector<Point> original = points;
+        std::vector<Point> convexHull(points.size(), Point(0.0, 0.0));
+        const size_t hullSize = convex_hull_from_points(static_cast<const Point*>(points.data()), points.size(), convexHull.data(), predicate);
+        ASSERT_EQ(std::vector<Point>(convexHull.begin(), convexHull.begin() + hullSize), expected);
+        ASSERT_EQ(points, original);
+
+        // In place, where the hull is moved to the beginning of the buffer
+        const size_t inPlaceSize = convex_hull_from_points(points.data(), points.size(), predicate);
+        ASSERT_EQ(std::vector<Point>(points.begin(), points.begin() + inPlaceSize), expected);
+    }
+
+    const Point collinear[] = {{0.0, 0.0}, {1.0, 1.0}, {2.0, 2.0}};
+    Point convexHull[3] = {{0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}};
+    EXPECT_THROW(convex_hull_from_points(collinear, 3, convexHull), std::invalid_argument);
+    EXPECT_THROW(convex_hull_from_points(collinear, 2, convexHull), std::invalid_argument);
+}
+
+TEST(ConvexHull, Views_of_grid)
+{
+    // Collinear points on the first ray from the lowest point, where the scan starts
+    std::vector<Point> points = {};
+    for (int i = 0; i < 8; ++i)
+        for (int j = 0; j < 8; ++j)
+            points.emplace_back(Point(i, j));
+    std::shuffle(points.begin(), points.end(), gen);
+    const std::vector<Point> expected = {Point(0.0, 0.0), Point(7.0, 0.0), Point(7.0, 7.0), Point(0.0, 7.0)};
+
+    for (OrientationPredicate predicate : {OrientationPredicate::Fast, OrientationPredicate::Adaptive, OrientationPredicate::MixedPrecision})
+    {
+        // Buffers of the exact size, as owned by a caller
+        std::vector<Point> input = points;
+        std::vector<Point> convexHull(points.size(), Point(0.0, 0.0));
+        const size_t hullSize = convex_hull_from_points(static_cast<const Point*>(input.data()), input.size(), convexHull.data(), predicate);
+        ASSERT_EQ(std::vector<Point>(convexHull.begin(), convexHull.begin() + hullSize), expected);
+
+        const size_t inPlaceSize = convex_hull_from_points(input.data(), input.size(), predicate);
+        ASSERT_EQ(std::vector<Point>(input.begin(), input.begin() + inPlaceSize), expected);
+    }
+}
+
 int main(int argc, char **argv) 
 {
     ::testing::InitGoogleTest(&argc, argv);
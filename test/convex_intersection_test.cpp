@@ -0,0 +1,196 @@
+#include "polygon_operations/convex_intersection.h"
+#include "polygon_operations/convex_polygon.h"
+#include "gtest/gtest.h"
+#include "test_utilities.h"
+#include <random>
+#include <cmath>
+
+std::random_device rd;  // Will be used to obtain a seed for the random number engine
+std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+
+// Utility functions
+double Area(const std::vector<Point>& polygon)
+{
+    double doubleArea = 0.0;
+    for (size_t vertexId = 0; vertexId < polygon.size(); ++vertexId)
+    {
+        const Point& current = polygon[vertexId];
+        const Point& next = polygon[(vertexId + 1) % polygon.size()];
+        doubleArea += current.x * next.y - next.x * current.y;
+    }
+    return doubleArea / 2.0;
+}
+
+// Sutherland-Hodgman clipping of a polygon by all the edges of a convex polygon, with O(nm) complexity
+std::vector<Point> ClipReference(const std::vector<Point>& polygon, const std::vector<Point>& clipPolygon)
+{
+    std::vector<Point> result = polygon;
+    for (size_t edgeId = 0; (edgeId < clipPolygon.size()) && !result.empty(); ++edgeId)
+    {
+        const Point& tail = clipPolygon[edgeId];
+        const Point& head = clipPolygon[(edgeId + 1) % clipPolygon.size()];
+        auto side = [&](const Point& point) { return (head.x - tail.x) * (point.y - tail.y) - (head.y - tail.y) * (point.x - tail.x); };
+
+        std::vector<Point> clipped = {};
+        for (size_t vertexId = 0; vertexId < result.size(); ++vertexId)
+        {
+            const Point& current = result[vertexId];
+            const Point& next = result[(vertexId + 1) % result.size()];
+            const double currentSide = side(current);
+            const double nextSide = side(next);
+            if (currentSide >= 0)
+                clipped.push_back(current);
+            if ((currentSide >= 0) != (nextSide >= 0))
+            {
+                const double t = currentSide / (currentSide - nextSide);
+                clipped.emplace_back(Point(current.x + t * (next.x - current.x), current.y + t * (next.y - current.y)));
+            }
+        }
+        result = clipped;
+    }
+    return result;
+}
+
+void ExpectConvexCounterclockwise(const std::vector<Point>& polygon)
+{
+    for (size_t vertexId = 0; vertexId < polygon.size(); ++vertexId)
+    {
+        const Point& p = polygon[vertexId];
+        const Point& q = polygon[(vertexId + 1) % polygon.size()];
+        const Point& r = polygon[(vertexId + 2) % polygon.size()];
+        EXPECT_GE((q.x - p.x) * (r.y - q.y) - (q.y - p.y) * (r.x - q.x), -1e-12);
+    }
+}
+
+TEST(ConvexPolygonIntersection, Invalid_polygon_exception)
+{
+    std::vector<Point> triangle = {{0, 0}, {1, 0}, {0, 1}};
+    std::vector<Point> segment = {{0, 0}, {1, 1}};
+    std::vector<Point> intersection = {};
+    EXPECT_THROW(convex_polygon_intersection(triangle, segment, intersection), std::invalid_argument);
+}
+
+TEST(ConvexPolygonIntersection, Overlapping_squares)
+{
+    std::vector<Point> square1 = {{0, 0}, {2, 0}, {2, 2}, {0, 2}};
+    std::vector<Point> square2 = {{1, 1}, {3, 1}, {3, 3}, {1, 3}};
+    std::vector<Point> intersection = {};
+    convex_polygon_intersection(square1, square2, intersection);
+    ASSERT_EQ(intersection.size(), 4);
+    ASSERT_DOUBLE_EQ(Area(intersection), 1.0);
+}
+
+TEST(ConvexPolygonIntersection, Polygon_contained)
+{
+    // The polygons of ConvexPolygonIntersect.Intersection_polygon_contained
+    std::vector<Point> rectangle = {{-1, -1}, {1, -1}, {1, 1}, {-1, 1}};
+    std::vector<Point> square = {{-0.5, -0.5}, {0.5, -0.5}, {0.5, 0.5}, {-0.5, 0.5}};
+
+    std::vector<Point> intersection = {};
+    convex_polygon_intersection(rectangle, square, intersection);
+    ASSERT_EQ(intersection, square);
+    convex_polygon_intersection(square, rectangle, intersection);
+    ASSERT_EQ(intersection, square);
+}
+
+TEST(ConvexPolygonIntersection, Identical_polygons)
+{
+    std::vector<Point> polygon = {{0, 0}, {2, 0}, {3, 1}, {1, 2}};
+    std::vector<Point> rotated = {{3, 1}, {1, 2}, {0, 0}, {2, 0}};
+
+    std::vector<Point> intersection = {};
+    convex_polygon_intersection(polygon, polygon, intersection);
+    ASSERT_DOUBLE_EQ(Area(intersection), Area(polygon));
+    convex_polygon_intersection(polygon, rotated, intersection);
+    ASSERT_DOUBLE_EQ(Area(intersection), Area(polygon));
+}
+
+TEST(ConvexPolygonIntersection, Disjoint_and_touching)
+{
+    std::vector<Point> square = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+    std::vector<Point> farSquare = {{3, 0}, {4, 0}, {4, 1}, {3, 1}};
+    std::vector<Point> edgeNeighbour = {{1, 0}, {2, 0}, {2, 1}, {1, 1}};
+    std::vector<Point> cornerNeighbour = {{1, 1}, {2, 1}, {2, 2}, {1, 2}};
+
+    std::vector<Point> intersection = {};
+    convex_polygon_intersection(square, farSquare, intersection);
+    ASSERT_TRUE(intersection.empty());
+    convex_polygon_intersection(square, edgeNeighbour, intersection);
+    ASSERT_LT(intersection.size(), 3);
+    convex_polygon_intersection(square, cornerNeighbour, intersection);
+    ASSERT_LT(intersection.size(), 3);
+}
+
+TEST(ConvexPolygonIntersection, Random_polygons_against_clipping)
+{
+    std::uniform_real_distribution<double> centerDistribution(-1.0, 1.0);
+    std::uniform_real_distribution<double> radiusDistribution(0.2, 1.5);
+    std::uniform_int_distribution<size_t> sizeDistribution(3, 40);
+
+    std::vector<Point> intersection = {};
+    for (size_t iter = 0; iter < 5000; ++iter)
+    {
+        std::vector<Point> polygon1 = CreateRandomConvexPolygon(centerDistribution(gen), centerDistribution(gen), radiusDistribution(gen), sizeDistribution(gen));
+        std::vector<Point> polygon2 = CreateRandomConvexPolygon(centerDistribution(gen), centerDistribution(gen), radiusDistribution(gen), sizeDistribution(gen));
+        if ((polygon1.size() < 3) || (polygon2.size() < 3))
+            continue;
+
+        convex_polygon_intersection(polygon1, polygon2, intersection);
+        ASSERT_LE(intersection.size(), polygon1.size() + polygon2.size());
+        ASSERT_NEAR(Area(intersection), Area(ClipReference(polygon1, polygon2)), 1e-9);
+        ExpectConvexCounterclockwise(intersection);
+        if (intersection.size() >= 3)
+        {
+            ASSERT_TRUE(do_intersect(polygon1, polygon2));
+        }
+    }
+}
+
+TEST(ConvexPolygonIntersection, Random_grid_polygons_with_shared_edges_and_vertices)
+{
+    // Rectangles and right triangles on a small integer grid share many collinear edges and vertices
+    std::uniform_int_distribution<int> cornerDistribution(0, 4);
+    std::uniform_int_distribution<int> shapeDistribution(0, 2);
+    auto createGridPolygon = [&]() {
+        const double x0 = cornerDistribution(gen);
+        const double y0 = cornerDistribution(gen);
+        const double x1 = x0 + 1 + cornerDistribution(gen);
+        const double y1 = y0 + 1 + cornerDistribution(gen);
+        std::vector<Point> polygon = {};
+        switch (shapeDistribution(gen))
+        {
+            case 0: polygon = {{x0, y0}, {x1, y0}, {x1, y1}, {x0, y1}}; break;
+            case 1: polygon = {{x0, y0}, {x1, y0}, {x0, y1}}; break;
+            default: polygon = {{x1, y0}, {x1, y1}, {x0, y1}}; break;
+        }
+        std::rotate(polygon.begin(), polygon.begin() + std::uniform_int_distribution<size_t>(0, polygon.size() - 1)(gen), polygon.end());
+        return polygon;
+    };
+
+    std::vector<Point> intersection = {};
+    for (size_t iter = 0; iter < 20000; ++iter)
+    {
+        std::vector<Point> polygon1 = createGridPolygon();
+        std::vector<Point> polygon2 = createGridPolygon();
+        convex_polygon_intersection(polygon1, polygon2, intersection);
+        const double area = (intersection.size() >= 3) ? Area(intersection) : 0.0;
+        ASSERT_NEAR(area, Area(ClipReference(polygon1, polygon2)), 1e-12);
+    }
+}
+
+TEST(ConvexPolygonIntersection, Pointer_overload)
+{
+    std::vector<Point> triangle1 = {{0, 0}, {4, 0}, {0, 4}};
+    std::vector<Point> triangle2 = {{0, 0}, {4, 4}, {0, 4}};
+    std::vector<Point> buffer(triangle1.size() + triangle2.size(), Point(0, 0));
+
+    const size_t verticesNumber = convex_polygon_intersection(triangle1.data(), triangle1.size(), triangle2.data(), triangle2.size(), buffer.data());
+    buffer.resize(verticesNumber, Point(0, 0));
+    ASSERT_DOUBLE_EQ(Area(buffer), 4.0);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
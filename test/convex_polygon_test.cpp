@@ -1,8 +1,11 @@
 #include "polygon_operations/convex_polygon.h"
 #include "polygon_operations/convex_hull.h"
 #include "gtest/gtest.h"
+#include "test_utilities.h"
 #include <random>
 #include <chrono>
+#include <cmath>
+#include <memory>
 
 std::random_device rd;  // Will be used to obtain a seed for the random number engine
 std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
@@ -201,7 +204,7 @@ TEST(ConvexPolygonIntersect, Intersection_polygon_contained)
 TEST(ConvexPolygonIntersect, Time_comparison)
 {
     // In case this test becomes flaky, increase maximumIterations
-    const size_t maximumIterations = 1;
+    const size_t maximumIterations = 100000;
     std::stack<Point> polygon1 = CreateRectangular();
 
     Point p1 = {0.0, 0.0};
@@ -247,6 +250,124 @@ TEST(ConvexPolygonIntersect, On_the_edge)
     ASSERT_TRUE(do_intersect(polygon1, polygon2));
 }
 
+TEST(ConvexPolygonExtremeVertex, Rectangular)
+{
+    std::vector<Point> polygon = StackToVectorFromBottom(CreateRectangular());
+
+    ASSERT_EQ(extreme_vertex_index(polygon, Vector(1.0, 1.0)), 2);
+    ASSERT_EQ(extreme_vertex_index(polygon, Vector(-1.0, -1.0)), 0);
+    ASSERT_EQ(extreme_vertex_index(polygon, Vector(1.0, -1.0)), 1);
+    ASSERT_EQ(extreme_vertex_index(polygon, Vector(-1.0, 1.0)), 3);
+}
+
+TEST(ConvexPolygonExtremeVertex, Random_polygons_against_linear_scan)
+{
+    std::uniform_real_distribution<double> angleDistribution(0.0, 2.0 * M_PI);
+
+    for (size_t polygonId = 0; polygonId < 50; ++polygonId)
+    {
+        std::vector<Point> polygon = CreateRandomConvexPolygon(0.0, 0.0, 1.0, 3 + 80 * polygonId);
+        for (size_t directionId = 0; directionId < 100; ++directionId)
+        {
+            const double angle = angleDistribution(gen);
+            const Vector direction(cos(angle), sin(angle));
+
+            double maximumProjection = DotProduct(direction, polygon[0]);
+            for (const auto& vertex : polygon)
+                maximumProjection = std::max(maximumProjection, DotProduct(direction, vertex));
+
+            const size_t extremeIndex = extreme_vertex_index(polygon, direction);
+            ASSERT_DOUBLE_EQ(DotProduct(direction, polygon[extremeIndex]), maximumProjection);
+        }
+    }
+}
+
+TEST(ConvexPolygonIntersectLogarithmic, Invalid_arguments_exception)
+{
+    std::vector<Point> polygon1 = {{-1,-1}, {1,1}};
+    std::vector<Point> polygon2 = {{-1,-1}, {1,-1}, {1,1}, {-1,1}};
+
+    EXPECT_THROW(do_intersect_logarithmic(polygon1, polygon2), std::invalid_argument);
+}
+
+TEST(ConvexPolygonIntersectLogarithmic, Same_as_separating_axis)
+{
+    std::vector<Point> polygon1 = StackToVectorFromBottom(CreateRectangular());
+
+    std::vector<Point> intersecting = {{0.0, 0.0}, {2.0, 0.0}, {2.0, 2.0}, {0.0, 2.0}};
+    std::vector<Point> separated = {{1.5, -1.0}, {2.5, -1.0}, {2.5, 1.0}, {1.5, 1.0}};
+    std::vector<Point> contained = {{-0.5, -0.5}, {0.5, -0.5}, {0.5, 0.5}, {-0.5, 0.5}};
+    std::vector<Point> onTheEdge = {{1.0, -1.0}, {2.0, -1.0}, {2.0, 1.0}, {1.0, 1.0}};
+    std::vector<Point> onTheCorner = {{1.0, 1.0}, {2.0, 1.0}, {2.0, 2.0}};
+    std::vector<Point> diagonallySeparated = {{1.2, 0.9}, {2.0, 2.0}, {0.9, 1.2}};
+
+    ASSERT_TRUE(do_intersect_logarithmic(polygon1, intersecting));
+    ASSERT_FALSE(do_intersect_logarithmic(polygon1, separated));
+    ASSERT_TRUE(do_intersect_logarithmic(polygon1, contained));
+    ASSERT_TRUE(do_intersect_logarithmic(contained, polygon1));
+    ASSERT_TRUE(do_intersect_logarithmic(polygon1, onTheEdge));
+    ASSERT_TRUE(do_intersect_logarithmic(polygon1, onTheCorner));
+    ASSERT_FALSE(do_intersect_logarithmic(polygon1, diagonallySeparated));
+    ASSERT_FALSE(do_intersect(polygon1, diagonallySeparated));
+}
+
+TEST(ConvexPolygonIntersectLogarithmic, Random_polygons_against_separating_axis)
+{
+    std::uniform_real_distribution<double> centerDistribution(-3.0, 3.0);
+    std::uniform_int_distribution<size_t> sizeDistribution(3, 300);
+
+    for (size_t iter = 0; iter < 300; ++iter)
+    {
+        std::vector<Point> polygon1 = CreateRandomConvexPolygon(centerDistribution(gen), centerDistribution(gen), 1.0, sizeDistribution(gen));
+        std::vector<Point> polygon2 = CreateRandomConvexPolygon(centerDistribution(gen), centerDistribution(gen), 1.5, sizeDistribution(gen));
+
+        const bool referenceResult = do_intersect_reference(polygon1, polygon2);
+        ASSERT_EQ(do_intersect_logarithmic(polygon1, polygon2), referenceResult);
+        ASSERT_EQ(do_intersect_logarithmic(polygon2, polygon1), referenceResult);
+    }
+}
+
+TEST(ConvexPolygonViews, Same_as_vector_and_stack)
+{
+    std::uniform_real_distribution<double> distribution(-2.0, 2.0);
+
+    for (size_t iter = 0; iter < 100; ++iter)
+    {
+        const std::vector<Point> polygon1 = CreateRandomConvexPolygon(distribution(gen), distribution(gen), 1.0, 3 + iter);
+        const std::vector<Point> polygon2 = CreateRandomConvexPolygon(distribution(gen), distribution(gen), 1.0, 3 + iter);
+        std::stack<Point> stack1(std::deque<Point>(polygon1.begin(), polygon1.end()));
+        std::stack<Point> stack2(std::deque<Point>(polygon2.begin(), polygon2.end()));
+
+        const bool intersecting = do_intersect(polygon1, polygon2);
+        ASSERT_EQ(do_intersect(polygon1.data(), polygon1.size(), polygon2.data(), polygon2.size()), intersecting);
+        ASSERT_EQ(do_intersect(stack1, stack2), intersecting);
+        ASSERT_EQ(do_intersect_logarithmic(polygon1.data(), polygon1.size(), polygon2.data(), polygon2.size()), intersecting);
+
+        const Vector direction(distribution(gen), distribution(gen));
+        ASSERT_EQ(extreme_vertex_index(polygon1.data(), polygon1.size(), direction), extreme_vertex_index(polygon1, direction));
+        ASSERT_EQ(extreme_vertex_index(polygon1.data(), polygon1.size(), direction, iter % polygon1.size()),
+                  extreme_vertex_index(polygon1, direction, iter % polygon1.size()));
+
+        std::vector<Point> points = {};
+        for (size_t pointId = 0; pointId < 50; ++pointId)
+            points.emplace_back(Point(distribution(gen), distribution(gen)));
+        const std::vector<bool> expected = points_are_in_polygon(points, polygon1);
+        std::unique_ptr<bool[]> inside(new bool[points.size()]);
+        points_are_in_polygon(points.data(), points.size(), polygon1.data(), polygon1.size(), inside.get());
+        for (size_t pointId = 0; pointId < points.size(); ++pointId)
+        {
+            ASSERT_EQ(inside[pointId], expected[pointId]);
+            const bool pointInside = point_is_in_polygon(points[pointId], stack1);
+            ASSERT_EQ(point_is_in_polygon(points[pointId], polygon1.data(), polygon1.size()), pointInside);
+        }
+        ASSERT_EQ(stack1.size(), polygon1.size());
+    }
+
+    const Point segment[] = {{0.0, 0.0}, {1.0, 0.0}};
+    EXPECT_THROW(point_is_in_polygon(Point(0.5, 0.5), segment, 2), std::invalid_argument);
+    EXPECT_THROW(do_intersect(segment, 2, segment, 2), std::invalid_argument);
+}
+
 int main(int argc, char **argv) 
 {
     ::testing::InitGoogleTest(&argc, argv);
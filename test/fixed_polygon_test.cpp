@@ -0,0 +1,175 @@
+#include "polygon_operations/fixed_polygon.h"
+#include "polygon_operations/convex_polygon.h"
+#include "gtest/gtest.h"
+#include "test_utilities.h"
+#include <random>
+#include <cmath>
+
+std::random_device rd;  // Will be used to obtain a seed for the random number engine
+std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+
+// Utility functions
+// Random polygon with exactly N vertices around a random center
+template <size_t N>
+ConvexPolygonN<N> CreateRandomFixedPolygon()
+{
+    std::uniform_real_distribution<double> centerDistribution(-2.0, 2.0);
+    std::uniform_real_distribution<double> radiusDistribution(0.1, 2.0);
+    std::vector<Point> polygon = {};
+    while (polygon.size() != N)
+        polygon = CreateRandomConvexPolygon(centerDistribution(gen), centerDistribution(gen), radiusDistribution(gen), N);
+    return ConvexPolygonN<N>(polygon.data());
+}
+
+template <size_t N, size_t M>
+void ExpectIntersectionAsReference(size_t iterations)
+{
+    for (size_t iter = 0; iter < iterations; ++iter)
+    {
+        const ConvexPolygonN<N> polygon1 = CreateRandomFixedPolygon<N>();
+        const ConvexPolygonN<M> polygon2 = CreateRandomFixedPolygon<M>();
+        const std::vector<Point> vector1(polygon1.vertices.begin(), polygon1.vertices.end());
+        const std::vector<Point> vector2(polygon2.vertices.begin(), polygon2.vertices.end());
+        const bool expected = do_intersect_reference(vector1, vector2);
+        ASSERT_EQ(do_intersect(polygon1, polygon2), expected);
+        ASSERT_EQ(do_intersect(vector1, vector2), expected);
+        ASSERT_EQ(do_intersect(SmallPolygon(polygon1), SmallPolygon(polygon2)), expected);
+    }
+}
+
+// Unit square and a triangle touching its right edge, checked at compile time
+constexpr Quad unitSquare(Point(0.0, 0.0), Point(1.0, 0.0), Point(1.0, 1.0), Point(0.0, 1.0));
+constexpr Triangle touchingTriangle(Point(1.0, 0.5), Point(2.0, 0.0), Point(2.0, 1.0));
+static_assert(do_intersect(unitSquare, touchingTriangle), "Touching polygons intersect");
+static_assert(!do_intersect(unitSquare, Triangle(Point(1.5, 0.5), Point(2.0, 0.0), Point(2.0, 1.0))), "Separated polygons");
+static_assert(point_is_in_polygon(Point(0.5, 0.5), unitSquare), "Interior point");
+static_assert(point_is_in_polygon(Point(1.0, 0.5), unitSquare), "Boundary point");
+static_assert(!point_is_in_polygon(Point(1.5, 0.5), unitSquare), "Exterior point");
+static_assert(polygon_area(unitSquare) == 1.0, "Area of the unit square");
+static_assert(sizeof(Quad) == 4 * sizeof(Point), "Vertices are stored inline");
+
+TEST(ConvexPolygonN, Intersection_against_reference)
+{
+    ExpectIntersectionAsReference<3, 3>(2000);
+    ExpectIntersectionAsReference<3, 4>(2000);
+    ExpectIntersectionAsReference<4, 3>(2000);
+    ExpectIntersectionAsReference<4, 4>(2000);
+    ExpectIntersectionAsReference<5, 8>(1000);
+    ExpectIntersectionAsReference<16, 3>(1000);
+}
+
+TEST(ConvexPolygonN, Containment)
+{
+    std::uniform_real_distribution<double> coordinateDistribution(-4.0, 4.0);
+    for (size_t iter = 0; iter < 200; ++iter)
+    {
+        const Triangle triangle = CreateRandomFixedPolygon<3>();
+        const Quad quad = CreateRandomFixedPolygon<4>();
+        const ConvexPolygonN<7> heptagon = CreateRandomFixedPolygon<7>();
+        std::vector<Point> points = {};
+        for (size_t pointId = 0; pointId < 50; ++pointId)
+            points.emplace_back(Point(coordinateDistribution(gen), coordinateDistribution(gen)));
+
+        const std::vector<bool> inTriangle = points_are_in_polygon(points, SmallPolygon(triangle).ToVector(), OrientationPredicate::Fast);
+        const std::vector<bool> inQuad = points_are_in_polygon(points, SmallPolygon(quad).ToVector(), OrientationPredicate::Fast);
+        const std::vector<bool> inHeptagon = points_are_in_polygon(points, SmallPolygon(heptagon).ToVector(), OrientationPredicate::Fast);
+        for (size_t pointId = 0; pointId < points.size(); ++pointId)
+        {
+            ASSERT_EQ(point_is_in_polygon(points[pointId], triangle), inTriangle[pointId]);
+            ASSERT_EQ(point_is_in_polygon(points[pointId], quad), inQuad[pointId]);
+            ASSERT_EQ(point_is_in_polygon(points[pointId], heptagon), inHeptagon[pointId]);
+            ASSERT_EQ(point_is_in_polygon(points[pointId], SmallPolygon(triangle)), inTriangle[pointId]);
+            ASSERT_EQ(point_is_in_polygon(points[pointId], SmallPolygon(quad)), inQuad[pointId]);
+            ASSERT_EQ(point_is_in_polygon(points[pointId], SmallPolygon(heptagon)), inHeptagon[pointId]);
+            ASSERT_EQ(point_is_in_polygon(points[pointId], quad, OrientationPredicate::Adaptive), inQuad[pointId]);
+        }
+    }
+
+    // Vertices lie on the boundary, on the fixed, generic and batched paths alike
+    const Triangle triangle = CreateRandomFixedPolygon<3>();
+    const std::vector<Point> vertices(triangle.vertices.begin(), triangle.vertices.end());
+    std::stack<Point> stack = {};
+    for (const auto& vertex : vertices)
+        stack.push(vertex);
+    for (OrientationPredicate predicate : {OrientationPredicate::Fast, OrientationPredicate::Adaptive, OrientationPredicate::MixedPrecision})
+    {
+        const std::vector<bool> inside = points_are_in_polygon(vertices, vertices, predicate);
+        for (size_t vertexId = 0; vertexId < vertices.size(); ++vertexId)
+        {
+            ASSERT_TRUE(point_is_in_polygon(vertices[vertexId], triangle, predicate));
+            ASSERT_TRUE(point_is_in_polygon(vertices[vertexId], SmallPolygon(triangle), predicate));
+            ASSERT_TRUE(point_is_in_polygon(vertices[vertexId], vertices.data(), vertices.size(), predicate));
+            ASSERT_TRUE(point_is_in_polygon(vertices[vertexId], stack, predicate));
+            ASSERT_TRUE(inside[vertexId]);
+        }
+    }
+    EXPECT_THROW(point_is_in_polygon(Point(0.0, 0.0), SmallPolygon(std::vector<Point>({{0, 0}, {1, 1}}))), std::invalid_argument);
+}
+
+TEST(ConvexPolygonN, Metrics)
+{
+    // A 4 x 2 rectangle centered at (3, 2)
+    const Quad rectangle(Point(1, 1), Point(5, 1), Point(5, 3), Point(1, 3));
+    const PolygonMetrics metrics = polygon_metrics(rectangle);
+    ASSERT_DOUBLE_EQ(metrics.area, 8.0);
+    ASSERT_EQ(metrics.centroid, Point(3.0, 2.0));
+    ASSERT_DOUBLE_EQ(metrics.perimeter, 12.0);
+    ASSERT_DOUBLE_EQ(metrics.momentXX, 2.0 * 4.0 * 4.0 * 4.0 / 12.0);
+    ASSERT_DOUBLE_EQ(metrics.momentYY, 4.0 * 2.0 * 2.0 * 2.0 / 12.0);
+
+    // Degenerate triangle
+    const PolygonMetrics degenerate = polygon_metrics(Triangle(Point(0, 0), Point(1, 1), Point(2, 2)));
+    ASSERT_EQ(degenerate.area, 0.0);
+    ASSERT_EQ(degenerate.centroid, Point(1.0, 1.0));
+
+    // The generic metrics of larger polygons agree with the expanded formulas
+    for (size_t iter = 0; iter < 1000; ++iter)
+    {
+        const ConvexPolygonN<9> polygon = CreateRandomFixedPolygon<9>();
+        const PolygonMetrics fixed = polygon_metrics(polygon);
+        const PolygonMetrics generic = polygon_metrics(SmallPolygon(polygon));
+        ASSERT_NEAR(fixed.area, generic.area, 1e-12);
+        ASSERT_NEAR(fixed.area, polygon_area(polygon), 1e-12);
+        ASSERT_NEAR(fixed.centroid.x, generic.centroid.x, 1e-12);
+        ASSERT_NEAR(fixed.centroid.y, generic.centroid.y, 1e-12);
+        ASSERT_NEAR(fixed.perimeter, generic.perimeter, 1e-12);
+        ASSERT_NEAR(fixed.momentXX, generic.momentXX, 1e-12);
+        ASSERT_NEAR(fixed.momentYY, generic.momentYY, 1e-12);
+        ASSERT_NEAR(fixed.momentXY, generic.momentXY, 1e-12);
+    }
+}
+
+TEST(SmallPolygon, Inline_storage)
+{
+    SmallPolygon polygon;
+    ASSERT_EQ(polygon.Size(), 0);
+    ASSERT_TRUE(polygon.IsInline());
+
+    std::vector<Point> vertices = {};
+    for (size_t vertexId = 0; vertexId < 40; ++vertexId)
+    {
+        vertices.emplace_back(Point(vertexId, 2.0 * vertexId));
+        polygon.Add(vertices.back());
+        ASSERT_EQ(polygon.IsInline(), vertices.size() <= SmallPolygon::inlineCapacity);
+        ASSERT_EQ(polygon.ToVector(), vertices);
+        ASSERT_EQ(SmallPolygon(vertices).ToVector(), vertices);
+        ASSERT_EQ(SmallPolygon(vertices).IsInline(), polygon.IsInline());
+    }
+
+    // Copies keep the vertices
+    const SmallPolygon copy = polygon;
+    ASSERT_EQ(copy.ToVector(), vertices);
+    ASSERT_EQ(copy[39], Point(39.0, 78.0));
+
+    polygon.Clear();
+    ASSERT_EQ(polygon.Size(), 0);
+    ASSERT_TRUE(polygon.IsInline());
+    polygon.Add(Point(1.0, 2.0));
+    ASSERT_EQ(polygon[0], Point(1.0, 2.0));
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
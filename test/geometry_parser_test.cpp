@@ -0,0 +1,301 @@
+#include "polygon_operations/geometry_parser.h"
+#include "polygon_operations/convex_hull.h"
+#include "gtest/gtest.h"
+#include <random>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+
+std::random_device rd;  // Will be used to obtain a seed for the random number engine
+std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+
+// Utility functions
+GeometryBatch ParseWkt(const std::string& text)
+{
+    GeometryBatch geometries;
+    parse_wkt(text.data(), text.size(), geometries);
+    return geometries;
+}
+
+std::vector<Point> Geometry(const GeometryBatch& geometries, size_t geometryId)
+{
+    return geometries.points.ToVector(geometryId);
+}
+
+// Writer of WKB geometries in either byte order
+struct WkbWriter
+{
+    explicit WkbWriter(bool littleEndian): littleEndian(littleEndian) {}
+
+    void Bytes(const void* value, size_t size)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(value);
+        uint16_t one = 1;
+        const bool hostLittleEndian = *reinterpret_cast<uint8_t*>(&one) == 1;
+        for (size_t byteId = 0; byteId < size; ++byteId)
+            data.push_back(bytes[(littleEndian == hostLittleEndian) ? byteId : size - 1 - byteId]);
+    }
+
+    void Header(uint32_t type)
+    {
+        data.push_back(littleEndian ? 1 : 0);
+        Bytes(&type, 4);
+    }
+
+    void Count(uint32_t count) {Bytes(&count, 4);}
+
+    void Coordinates(const std::vector<double>& coordinates)
+    {
+        for (double coordinate : coordinates)
+            Bytes(&coordinate, 8);
+    }
+
+    void Points(const std::vector<Point>& points)
+    {
+        Count(static_cast<uint32_t>(points.size()));
+        for (const Point& point : points)
+            Coordinates({point.x, point.y});
+    }
+
+    bool littleEndian;
+    std::vector<uint8_t> data;
+};
+
+TEST(ParseWkt, Points_and_multipoints)
+{
+    const GeometryBatch geometries = ParseWkt("POINT (1 2)\n"
+                                              "point(-1.5e1 +3.25)\n"
+                                              "POINT Z (1 2 3)\n"
+                                              "POINTM(4 5 6)\n"
+                                              "POINT ZM (7 8 9 10)\n"
+                                              "POINT EMPTY\n"
+                                              "MULTIPOINT ((0 0), (1 1), (2 0))\n"
+                                              "MULTIPOINT (0 0, 1 1, 2 0) MultiPoint Z ((1 2 3), EMPTY, (4 5 6))\n"
+                                              "MULTIPOINT EMPTY");
+    ASSERT_EQ(geometries.Size(), 10);
+    ASSERT_EQ(Geometry(geometries, 0), std::vector<Point>({Point(1.0, 2.0)}));
+    ASSERT_EQ(Geometry(geometries, 1), std::vector<Point>({Point(-15.0, 3.25)}));
+    ASSERT_EQ(Geometry(geometries, 2), std::vector<Point>({Point(1.0, 2.0)}));
+    ASSERT_EQ(Geometry(geometries, 3), std::vector<Point>({Point(4.0, 5.0)}));
+    ASSERT_EQ(Geometry(geometries, 4), std::vector<Point>({Point(7.0, 8.0)}));
+    ASSERT_TRUE(Geometry(geometries, 5).empty());
+    ASSERT_EQ(Geometry(geometries, 6), std::vector<Point>({Point(0.0, 0.0), Point(1.0, 1.0), Point(2.0, 0.0)}));
+    ASSERT_EQ(Geometry(geometries, 7), Geometry(geometries, 6));
+    ASSERT_EQ(Geometry(geometries, 8), std::vector<Point>({Point(1.0, 2.0), Point(4.0, 5.0)}));
+    ASSERT_TRUE(Geometry(geometries, 9).empty());
+    for (size_t geometryId = 0; geometryId < 6; ++geometryId)
+        ASSERT_EQ(geometries.types[geometryId], GeometryType::Point);
+    for (size_t geometryId = 6; geometryId < 10; ++geometryId)
+        ASSERT_EQ(geometries.types[geometryId], GeometryType::MultiPoint);
+}
+
+TEST(ParseWkt, Polygons)
+{
+    const GeometryBatch geometries = ParseWkt("POLYGON ((0 0, 2 0, 2 2, 0 2, 0 0))\n"
+                                              "POLYGON ((0 0, 0 2, 2 2, 2 0, 0 0))\n"
+                                              "POLYGON ((0 0, 4 0, 4 4, 0 4, 0 0), (1 1, 1 2, 2 2, 2 1, 1 1))\n"
+                                              "POLYGON Z ((0 0 1, 2 0 1, 0 2 1, 0 0 1))\n"
+                                              "POLYGON EMPTY");
+    ASSERT_EQ(geometries.Size(), 5);
+    const std::vector<Point> square = {Point(0.0, 0.0), Point(2.0, 0.0), Point(2.0, 2.0), Point(0.0, 2.0)};
+    ASSERT_EQ(Geometry(geometries, 0), square);
+    // Clockwise rings are reversed
+    ASSERT_EQ(Geometry(geometries, 1), std::vector<Point>({Point(2.0, 0.0), Point(2.0, 2.0), Point(0.0, 2.0), Point(0.0, 0.0)}));
+    // Interior rings are skipped
+    ASSERT_EQ(Geometry(geometries, 2), std::vector<Point>({Point(0.0, 0.0), Point(4.0, 0.0), Point(4.0, 4.0), Point(0.0, 4.0)}));
+    ASSERT_EQ(Geometry(geometries, 3), std::vector<Point>({Point(0.0, 0.0), Point(2.0, 0.0), Point(0.0, 2.0)}));
+    ASSERT_TRUE(Geometry(geometries, 4).empty());
+    for (GeometryType type : geometries.types)
+        ASSERT_EQ(type, GeometryType::Polygon);
+}
+
+TEST(ParseWkt, Convex_hull_of_multipoint)
+{
+    std::uniform_real_distribution<double> distribution(-100.0, 100.0);
+    std::vector<Point> points = {};
+    std::string text = "MULTIPOINT (";
+    char number[64];
+    for (size_t pointId = 0; pointId < 1000; ++pointId)
+    {
+        points.emplace_back(Point(distribution(gen), distribution(gen)));
+        std::snprintf(number, sizeof(number), "%s%.17g %.17g", (pointId > 0) ? ", " : "", points.back().x, points.back().y);
+        text += number;
+    }
+    text += ")";
+
+    const GeometryBatch geometries = ParseWkt(text);
+    ASSERT_EQ(Geometry(geometries, 0), points);
+    std::vector<Point> hull(points.size(), Point(0.0, 0.0));
+    hull.resize(convex_hull_from_points(geometries.points.Polygon(0), geometries.points.PolygonSize(0), hull.data()), Point(0.0, 0.0));
+    ASSERT_EQ(hull, StackToVectorFromBottom(convex_hull_from_points(points)));
+}
+
+TEST(ParseWkt, Errors)
+{
+    GeometryBatch geometries;
+    const std::string valid = "POINT (1 2)";
+    parse_wkt(valid.data(), valid.size(), geometries);
+
+    for (const std::string text : {"LINESTRING (0 0, 1 1)", "POINT (1 2", "POINT 1 2)", "POINT (1 x)", "POINT (1)",
+                                   "POINTS (1 2)", "POINT Q (1 2)", "MULTIPOINT ((0 0), (1 1)", "POLYGON (0 0, 1 0, 0 1)",
+                                   "POINT (1 2) POLYGON ((0 0, 1 0, 0 1, 0 0)"})
+    {
+        ASSERT_THROW(parse_wkt(text.data(), text.size(), geometries), std::invalid_argument);
+        // The geometries parsed before the error are removed
+        ASSERT_EQ(geometries.Size(), 1);
+        ASSERT_EQ(geometries.points.vertices.size(), 1);
+        ASSERT_EQ(geometries.points.offsets.size(), 2);
+    }
+
+    const std::string text = "POINT (1 2)\nPOINT (3 x)";
+    try
+    {
+        parse_wkt(text.data(), text.size(), geometries);
+        FAIL();
+    }
+    catch (const std::invalid_argument& exception)
+    {
+        ASSERT_NE(std::string(exception.what()).find("character 21"), std::string::npos);
+    }
+}
+
+TEST(ParseWkt, Parallel)
+{
+    std::uniform_real_distribution<double> distribution(-100.0, 100.0);
+    std::uniform_int_distribution<int> typeDistribution(0, 2);
+    std::string text = {};
+    char number[64];
+    while (text.size() < (size_t(1) << 20))
+    {
+        const int type = typeDistribution(gen);
+        if (type == 0)
+        {
+            std::snprintf(number, sizeof(number), "POINT (%.17g %.17g)\n", distribution(gen), distribution(gen));
+            text += number;
+        }
+        else
+        {
+            text += (type == 1) ? "MULTIPOINT (" : "POLYGON ((";
+            const double centerX = distribution(gen);
+            const double centerY = distribution(gen);
+            for (size_t vertexId = 0; vertexId < 8; ++vertexId)
+            {
+                const double angle = 2.0 * M_PI * vertexId / 8;
+                std::snprintf(number, sizeof(number), "%s%.17g %.17g", (vertexId > 0) ? ", " : "", centerX + cos(angle), centerY + sin(angle));
+                text += number;
+            }
+            text += (type == 1) ? ")\n" : "))\n";
+        }
+    }
+
+    WorkStealingThreadPool pool(4);
+    const GeometryBatch sequential = ParseWkt(text);
+    GeometryBatch parallel;
+    parse_wkt(text.data(), text.size(), parallel, pool);
+    ASSERT_GT(sequential.Size(), 1000);
+    ASSERT_TRUE(parallel.points.vertices == sequential.points.vertices);
+    ASSERT_TRUE(parallel.points.offsets == sequential.points.offsets);
+    ASSERT_TRUE(parallel.types == sequential.types);
+
+    // The position of an error is the one inside the whole text
+    const size_t errorPosition = text.size() - 100;
+    const size_t lineStart = text.rfind('\n', errorPosition) + 1;
+    text.replace(lineStart, 1, "X");
+    try
+    {
+        parse_wkt(text.data(), text.size(), parallel, pool);
+        FAIL();
+    }
+    catch (const std::invalid_argument& exception)
+    {
+        ASSERT_NE(std::string(exception.what()).find("character " + std::to_string(lineStart)), std::string::npos);
+    }
+    ASSERT_EQ(parallel.Size(), sequential.Size());
+}
+
+TEST(ParseWkb, Geometries)
+{
+    const std::vector<Point> square = {Point(0.0, 0.0), Point(2.0, 0.0), Point(2.0, 2.0), Point(0.0, 2.0), Point(0.0, 0.0)};
+    const std::vector<Point> hole = {Point(0.5, 0.5), Point(0.5, 1.0), Point(1.0, 1.0), Point(0.5, 0.5)};
+    for (bool littleEndian : {true, false})
+    {
+        WkbWriter writer(littleEndian);
+        writer.Header(1);
+        writer.Coordinates({1.0, 2.0});
+        // Point with ISO Z dimension
+        writer.Header(1001);
+        writer.Coordinates({3.0, 4.0, 5.0});
+        // Empty point
+        writer.Header(1);
+        writer.Coordinates({std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN()});
+        // MultiPoint of EWKB with SRID and M dimension
+        writer.Header(0x20000000u | 0x40000000u | 4);
+        writer.Count(4326);
+        writer.Count(2);
+        writer.Header(0x40000000u | 1);
+        writer.Coordinates({6.0, 7.0, 8.0});
+        writer.Header(0x40000000u | 1);
+        writer.Coordinates({9.0, 10.0, 11.0});
+        // Polygon with a hole
+        writer.Header(3);
+        writer.Count(2);
+        writer.Points(square);
+        writer.Points(hole);
+        // Clockwise polygon
+        writer.Header(3);
+        writer.Count(1);
+        writer.Points(std::vector<Point>(square.rbegin(), square.rend()));
+
+        GeometryBatch geometries;
+        parse_wkb(writer.data.data(), writer.data.size(), geometries);
+        ASSERT_EQ(geometries.Size(), 6);
+        ASSERT_EQ(Geometry(geometries, 0), std::vector<Point>({Point(1.0, 2.0)}));
+        ASSERT_EQ(Geometry(geometries, 1), std::vector<Point>({Point(3.0, 4.0)}));
+        ASSERT_TRUE(Geometry(geometries, 2).empty());
+        ASSERT_EQ(Geometry(geometries, 3), std::vector<Point>({Point(6.0, 7.0), Point(9.0, 10.0)}));
+        ASSERT_EQ(Geometry(geometries, 4), std::vector<Point>(square.begin(), square.end() - 1));
+        ASSERT_EQ(Geometry(geometries, 5), std::vector<Point>({Point(2.0, 0.0), Point(2.0, 2.0), Point(0.0, 2.0), Point(0.0, 0.0)}));
+        ASSERT_EQ(geometries.types, std::pmr::vector<GeometryType>({GeometryType::Point, GeometryType::Point, GeometryType::Point,
+                                                                    GeometryType::MultiPoint, GeometryType::Polygon, GeometryType::Polygon}));
+    }
+}
+
+TEST(ParseWkb, Errors)
+{
+    WkbWriter writer(true);
+    writer.Header(3);
+    writer.Count(1);
+    writer.Points({Point(0.0, 0.0), Point(1.0, 0.0), Point(0.0, 1.0), Point(0.0, 0.0)});
+
+    GeometryBatch geometries;
+    parse_wkb(writer.data.data(), writer.data.size(), geometries);
+    ASSERT_EQ(geometries.Size(), 1);
+
+    // Truncated geometries
+    for (size_t length = 1; length < writer.data.size(); ++length)
+    {
+        ASSERT_THROW(parse_wkb(writer.data.data(), length, geometries), std::invalid_argument);
+        ASSERT_EQ(geometries.Size(), 1);
+        ASSERT_EQ(geometries.points.vertices.size(), 3);
+    }
+
+    // Unsupported type, invalid byte order and a count beyond the data
+    WkbWriter lineString(true);
+    lineString.Header(2);
+    lineString.Points({Point(0.0, 0.0), Point(1.0, 1.0)});
+    ASSERT_THROW(parse_wkb(lineString.data.data(), lineString.data.size(), geometries), std::invalid_argument);
+    std::vector<uint8_t> invalid = writer.data;
+    invalid[0] = 2;
+    ASSERT_THROW(parse_wkb(invalid.data(), invalid.size(), geometries), std::invalid_argument);
+    invalid = writer.data;
+    invalid[9] = 0xFF;
+    ASSERT_THROW(parse_wkb(invalid.data(), invalid.size(), geometries), std::invalid_argument);
+    ASSERT_EQ(geometries.Size(), 1);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
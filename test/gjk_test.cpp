@@ -0,0 +1,155 @@
+#include "polygon_operations/gjk.h"
+#include "polygon_operations/convex_polygon.h"
+#include "polygon_operations/convex_hull.h"
+#include "gtest/gtest.h"
+#include "test_utilities.h"
+#include <random>
+#include <cmath>
+
+std::random_device rd;  // Will be used to obtain a seed for the random number engine
+std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+
+// Utility functions
+double PointToSegmentDistance(const Point& point, const Point& tail, const Point& head)
+{
+    const Vector edge(tail, head);
+    const Vector toPoint(tail, point);
+    double t = DotProduct(toPoint, edge) / DotProduct(edge, edge);
+    t = std::min(std::max(t, 0.0), 1.0);
+    return EuclideanDistance(point, Point(tail.x + t * edge.x, tail.y + t * edge.y));
+}
+
+/// Brute force distance between two disjoint polygons
+double BruteForceDistance(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2)
+{
+    double distance = EuclideanDistance(polygon1[0], polygon2[0]);
+    for (size_t i = 0; i < polygon1.size(); ++i)
+    {
+        for (size_t j = 0; j < polygon2.size(); ++j)
+        {
+            const Point& tail2 = polygon2[j];
+            const Point& head2 = polygon2[(j + 1) % polygon2.size()];
+            const Point& tail1 = polygon1[i];
+            const Point& head1 = polygon1[(i + 1) % polygon1.size()];
+            distance = std::min(distance, PointToSegmentDistance(polygon1[i], tail2, head2));
+            distance = std::min(distance, PointToSegmentDistance(polygon2[j], tail1, head1));
+        }
+    }
+    return distance;
+}
+
+std::vector<Point> Translate(const std::vector<Point>& polygon, double dx, double dy)
+{
+    std::vector<Point> translated = {};
+    for (const auto& vertex : polygon)
+        translated.emplace_back(Point(vertex.x + dx, vertex.y + dy));
+    return translated;
+}
+
+TEST(GJK, Invalid_arguments_exception)
+{
+    std::vector<Point> polygon1 = {{-1,-1}, {1,1}};
+    std::vector<Point> polygon2 = {{-1,-1}, {1,-1}, {1,1}, {-1,1}};
+
+    EXPECT_THROW(gjk_query(polygon1, polygon2), std::invalid_argument);
+}
+
+TEST(GJK, Separated_squares)
+{
+    std::vector<Point> polygon1 = {{-1,-1}, {1,-1}, {1,1}, {-1,1}};
+    std::vector<Point> polygon2 = {{1.5,-0.5}, {2.5,-0.5}, {2.5,0.5}, {1.5,0.5}};
+
+    GJKResult result = gjk_query(polygon1, polygon2);
+
+    ASSERT_FALSE(result.intersect);
+    ASSERT_NEAR(result.distance, 0.5, 1e-12);
+    ASSERT_NEAR(result.witness1.x, 1.0, 1e-12);
+    ASSERT_NEAR(result.witness2.x, 1.5, 1e-12);
+    ASSERT_NEAR(result.witness1.y, result.witness2.y, 1e-12);
+    ASSERT_LE(std::abs(result.witness1.y), 0.5 + 1e-12);
+}
+
+TEST(GJK, Intersecting_touching_and_contained)
+{
+    std::vector<Point> polygon1 = {{-1,-1}, {1,-1}, {1,1}, {-1,1}};
+    std::vector<Point> intersecting = {{0,0}, {2,0}, {2,2}, {0,2}};
+    std::vector<Point> touching = {{1,-1}, {2,-1}, {2,1}, {1,1}};
+    std::vector<Point> contained = {{-0.5,-0.5}, {0.5,-0.5}, {0.5,0.5}, {-0.5,0.5}};
+
+    for (const auto& polygon2 : {intersecting, touching, contained})
+    {
+        GJKResult result = gjk_query(polygon1, polygon2);
+        ASSERT_TRUE(result.intersect);
+        ASSERT_EQ(result.distance, 0.0);
+    }
+}
+
+TEST(GJK, Random_polygons_against_separating_axis)
+{
+    std::uniform_real_distribution<double> centerDistribution(-3.0, 3.0);
+    std::uniform_int_distribution<size_t> sizeDistribution(3, 200);
+
+    for (size_t iter = 0; iter < 300; ++iter)
+    {
+        std::vector<Point> polygon1 = CreateRandomConvexPolygon(centerDistribution(gen), centerDistribution(gen), 1.0, sizeDistribution(gen));
+        std::vector<Point> polygon2 = CreateRandomConvexPolygon(centerDistribution(gen), centerDistribution(gen), 1.5, sizeDistribution(gen));
+
+        GJKResult result = gjk_query(polygon1, polygon2);
+        ASSERT_EQ(result.intersect, do_intersect(polygon1, polygon2));
+
+        if (!result.intersect)
+        {
+            ASSERT_NEAR(result.distance, BruteForceDistance(polygon1, polygon2), 1e-9);
+            ASSERT_NEAR(result.distance, EuclideanDistance(result.witness1, result.witness2), 1e-12);
+        }
+    }
+}
+
+TEST(GJK, Warm_start_with_coherent_motion)
+{
+    std::vector<Point> polygon1 = CreateRandomConvexPolygon(0.0, 0.0, 1.0, 500);
+    std::vector<Point> polygon2 = CreateRandomConvexPolygon(3.0, 0.5, 1.0, 500);
+
+    GJKCache cache;
+    gjk_query(polygon1, polygon2, cache);
+    ASSERT_GT(cache.simplexSize, 0);
+
+    // Move the second polygon towards the first one in small steps until they intersect
+    size_t totalIterations = 0;
+    size_t frames = 0;
+    bool intersect = false;
+    for (double offset = 0.0; offset < 1.5; offset += 0.001, ++frames)
+    {
+        std::vector<Point> moved = Translate(polygon2, -offset, 0.0);
+        GJKResult result = gjk_query(polygon1, moved, cache);
+        GJKResult coldResult = gjk_query(polygon1, moved);
+
+        ASSERT_EQ(result.intersect, coldResult.intersect);
+        ASSERT_NEAR(result.distance, coldResult.distance, 1e-9);
+        intersect = intersect || result.intersect;
+        totalIterations += result.iterations;
+    }
+
+    ASSERT_TRUE(intersect);
+    ASSERT_LE(totalIterations, 2 * frames);
+}
+
+TEST(GJK, Invalid_cache_is_ignored)
+{
+    std::vector<Point> polygon1 = {{-1,-1}, {1,-1}, {1,1}, {-1,1}};
+    std::vector<Point> polygon2 = {{1.5,-0.5}, {2.5,-0.5}, {2.5,0.5}, {1.5,0.5}};
+
+    GJKCache cache;
+    cache.simplexSize = 2;
+    cache.indices1[0] = 100;
+
+    GJKResult result = gjk_query(polygon1, polygon2, cache);
+    ASSERT_FALSE(result.intersect);
+    ASSERT_NEAR(result.distance, 0.5, 1e-12);
+}
+
+int main(int argc, char **argv) 
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
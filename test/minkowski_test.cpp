@@ -0,0 +1,151 @@
+#include "polygon_operations/minkowski.h"
+#include "polygon_operations/convex_hull.h"
+#include "polygon_operations/convex_polygon.h"
+#include "polygon_operations/gjk.h"
+#include "gtest/gtest.h"
+#include "test_utilities.h"
+#include <random>
+#include <cmath>
+
+std::random_device rd;  // Will be used to obtain a seed for the random number engine
+std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+
+// Utility functions
+std::vector<Point> CreateRandomPolygon()
+{
+    std::uniform_real_distribution<double> centerDistribution(-2.0, 2.0);
+    std::uniform_real_distribution<double> radiusDistribution(0.2, 1.5);
+    std::uniform_int_distribution<size_t> sizeDistribution(3, 30);
+    return CreateRandomConvexPolygon(centerDistribution(gen), centerDistribution(gen), radiusDistribution(gen), sizeDistribution(gen));
+}
+
+double Area(const std::vector<Point>& polygon)
+{
+    double doubleArea = 0.0;
+    for (size_t vertexId = 0; vertexId < polygon.size(); ++vertexId)
+    {
+        const Point& current = polygon[vertexId];
+        const Point& next = polygon[(vertexId + 1) % polygon.size()];
+        doubleArea += current.x * next.y - next.x * current.y;
+    }
+    return doubleArea / 2.0;
+}
+
+// Convex hull of all the pairwise vertex sums, with O(nm log(nm)) complexity
+std::vector<Point> SumReference(const std::vector<Point>& polygon1, const std::vector<Point>& polygon2)
+{
+    std::vector<Point> sums = {};
+    for (const auto& vertex1 : polygon1)
+        for (const auto& vertex2 : polygon2)
+            sums.emplace_back(Point(vertex1.x + vertex2.x, vertex1.y + vertex2.y));
+    return StackToVectorFromBottom(convex_hull_from_points(sums));
+}
+
+std::vector<Point> Translated(const std::vector<Point>& polygon, const Point& translation)
+{
+    std::vector<Point> translated = {};
+    for (const auto& vertex : polygon)
+        translated.emplace_back(Point(vertex.x + translation.x, vertex.y + translation.y));
+    return translated;
+}
+
+TEST(Minkowski, Empty_polygon_exception)
+{
+    std::vector<Point> square = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+    EXPECT_THROW(minkowski_sum(square, {}), std::invalid_argument);
+    EXPECT_THROW(minkowski_difference({}, square), std::invalid_argument);
+}
+
+TEST(Minkowski, Sum_with_point_and_segment)
+{
+    std::vector<Point> square = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+
+    std::vector<Point> sum = minkowski_sum(square, {{2, 3}});
+    ASSERT_EQ(sum, std::vector<Point>({{2, 3}, {3, 3}, {3, 4}, {2, 4}}));
+
+    sum = minkowski_sum(square, {{0, 0}, {2, 0}});
+    ASSERT_EQ(sum.size(), 4);
+    ASSERT_DOUBLE_EQ(Area(sum), 3.0);
+
+    // Two perpendicular segments give a square
+    sum = minkowski_sum({{0, 0}, {1, 0}}, {{0, 0}, {0, 1}});
+    ASSERT_EQ(sum, square);
+}
+
+TEST(Minkowski, Sum_against_hull_of_vertex_sums)
+{
+    for (size_t iter = 0; iter < 500; ++iter)
+    {
+        std::vector<Point> polygon1 = CreateRandomPolygon();
+        std::vector<Point> polygon2 = CreateRandomPolygon();
+
+        std::vector<Point> sum = minkowski_sum(polygon1, polygon2);
+        std::vector<Point> reference = SumReference(polygon1, polygon2);
+        ASSERT_LE(sum.size(), polygon1.size() + polygon2.size());
+        ASSERT_NEAR(Area(sum), Area(reference), 1e-9);
+        for (const auto& vertex : reference)
+            ASSERT_NE(std::find(sum.begin(), sum.end(), vertex), sum.end());
+    }
+}
+
+TEST(Minkowski, Difference_contains_origin_when_intersecting)
+{
+    for (size_t iter = 0; iter < 500; ++iter)
+    {
+        std::vector<Point> polygon1 = CreateRandomPolygon();
+        std::vector<Point> polygon2 = CreateRandomPolygon();
+
+        Point closestPoint(0, 0);
+        const double signedDistance = minkowski_signed_distance(minkowski_difference(polygon1, polygon2), closestPoint);
+        ASSERT_EQ(signedDistance <= 0.0, do_intersect(polygon1, polygon2));
+        ASSERT_NEAR(std::fabs(signedDistance), EuclideanDistance(closestPoint, Point(0, 0)), 1e-12);
+        if (signedDistance > 0.0)
+        {
+            ASSERT_NEAR(signedDistance, gjk_query(polygon1, polygon2).distance, 1e-9);
+        }
+    }
+}
+
+TEST(Minkowski, Closest_point_gives_minimum_translation)
+{
+    for (size_t iter = 0; iter < 500; ++iter)
+    {
+        std::vector<Point> polygon1 = CreateRandomPolygon();
+        std::vector<Point> polygon2 = CreateRandomPolygon();
+
+        Point closestPoint(0, 0);
+        const double signedDistance = minkowski_signed_distance(minkowski_difference(polygon1, polygon2), closestPoint);
+        if (std::fabs(signedDistance) < 1e-6)
+            continue;
+
+        // Translating by -closestPoint makes the polygons touch, slightly less or more does not
+        const double factor = (signedDistance < 0.0) ? 1.001 : 0.999;
+        ASSERT_NEAR(gjk_query(Translated(polygon1, Point(-closestPoint.x, -closestPoint.y)), polygon2).distance, 0.0, 1e-9);
+        ASSERT_FALSE(do_intersect(Translated(polygon1, Point(-factor * closestPoint.x, -factor * closestPoint.y)), polygon2));
+    }
+}
+
+TEST(Minkowski, Batch_against_single)
+{
+    std::vector<std::vector<Point>> obstacles = {};
+    for (size_t obstacleId = 0; obstacleId < 300; ++obstacleId)
+        obstacles.push_back(CreateRandomPolygon());
+    std::vector<Point> shape = CreateRandomPolygon();
+
+    WorkStealingThreadPool pool(4);
+    std::vector<std::vector<Point>> sums = minkowski_sum_batch(obstacles, shape, pool);
+    std::vector<std::vector<Point>> differences = minkowski_difference_batch(obstacles, shape, pool);
+    ASSERT_EQ(sums.size(), obstacles.size());
+    ASSERT_EQ(differences.size(), obstacles.size());
+    for (size_t obstacleId = 0; obstacleId < obstacles.size(); ++obstacleId)
+    {
+        ASSERT_EQ(sums[obstacleId], minkowski_sum(obstacles[obstacleId], shape));
+        ASSERT_EQ(differences[obstacleId], minkowski_difference(obstacles[obstacleId], shape));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,155 @@
+#include "polygon_operations/parallel_intersection.h"
+#include "polygon_operations/convex_polygon.h"
+#include "polygon_operations/sweep_and_prune.h"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <random>
+#include <cmath>
+#include <stdexcept>
+
+std::random_device rd;  // Will be used to obtain a seed for the random number engine
+std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+
+// Utility functions
+std::vector<Point> CreateRegularPolygon(double centerX, double centerY, double radius, size_t verticesNumber)
+{
+    std::vector<Point> polygon = {};
+    for (size_t vertexId = 0; vertexId < verticesNumber; ++vertexId)
+    {
+        const double angle = 2.0 * M_PI * vertexId / verticesNumber;
+        polygon.emplace_back(Point(centerX + radius * cos(angle), centerY + radius * sin(angle)));
+    }
+    return polygon;
+}
+
+std::vector<std::vector<Point>> CreateRandomPolygons(size_t polygonsNumber, double areaSize, size_t maximumSize)
+{
+    std::uniform_real_distribution<double> centerDistribution(-areaSize / 2, areaSize / 2);
+    std::uniform_real_distribution<double> radiusDistribution(0.4, 0.6);
+    std::uniform_int_distribution<size_t> sizeDistribution(3, maximumSize);
+
+    std::vector<std::vector<Point>> polygons = {};
+    for (size_t polygonId = 0; polygonId < polygonsNumber; ++polygonId)
+        polygons.emplace_back(CreateRegularPolygon(centerDistribution(gen), centerDistribution(gen), radiusDistribution(gen), sizeDistribution(gen)));
+    return polygons;
+}
+
+std::vector<PolygonPair> Sorted(std::vector<PolygonPair> pairs)
+{
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+TEST(WorkStealingThreadPool, Every_task_runs_once)
+{
+    for (size_t threadsNumber : {1, 2, 4, 7})
+    {
+        WorkStealingThreadPool pool(threadsNumber);
+        ASSERT_EQ(pool.ThreadsNumber(), threadsNumber);
+
+        for (size_t tasksNumber : {0, 1, 5, 1000})
+        {
+            std::vector<std::atomic<size_t>> runs(tasksNumber);
+            pool.Run(tasksNumber, [&](size_t taskId, size_t threadId) {
+                ASSERT_LT(threadId, threadsNumber);
+                ++runs[taskId];
+            });
+            for (const auto& taskRuns : runs)
+                ASSERT_EQ(taskRuns.load(), 1);
+        }
+    }
+}
+
+TEST(WorkStealingThreadPool, Unbalanced_tasks_are_stolen)
+{
+    // All the slow tasks start in the range of the first thread
+    WorkStealingThreadPool pool(4);
+    std::vector<std::atomic<size_t>> threadTasks(pool.ThreadsNumber());
+    pool.Run(64, [&](size_t taskId, size_t threadId) {
+        if (taskId < 16)
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        ++threadTasks[threadId];
+    });
+    ASSERT_LT(threadTasks[0].load(), 16);
+}
+
+TEST(WorkStealingThreadPool, Task_exception_is_rethrown)
+{
+    WorkStealingThreadPool pool(3);
+    EXPECT_THROW(pool.Run(100, [](size_t taskId, size_t) {
+        if (taskId == 42)
+            throw std::invalid_argument("Task failed");
+    }), std::invalid_argument);
+
+    // The pool is still usable
+    std::atomic<size_t> runs(0);
+    pool.Run(10, [&](size_t, size_t) { ++runs; });
+    ASSERT_EQ(runs.load(), 10);
+}
+
+TEST(WorkStealingThreadPool, Task_exception_skips_the_remaining_tasks)
+{
+    // The first task throws at once, so the other workers stop after a few of their tasks
+    WorkStealingThreadPool pool(4);
+    std::atomic<size_t> runs(0);
+    EXPECT_THROW(pool.Run(10000, [&](size_t taskId, size_t) {
+        ++runs;
+        if (taskId == 0)
+            throw std::invalid_argument("Task failed");
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }), std::invalid_argument);
+    ASSERT_LT(runs.load(), 1000);
+}
+
+TEST(ParallelIntersection, Candidate_pairs_against_serial)
+{
+    std::vector<std::vector<Point>> polygons = CreateRandomPolygons(1000, 20.0, 64);
+    // Mix in a few expensive polygons
+    for (size_t polygonId = 0; polygonId < 20; ++polygonId)
+        polygons[polygonId] = CreateRegularPolygon(polygons[polygonId][0].x, polygons[polygonId][0].y, 1.0, 500);
+
+    SweepAndPrune sweepAndPrune;
+    const std::vector<PolygonPair> candidatePairs = sweepAndPrune.FindCandidatePairs(polygons);
+    const std::vector<PolygonPair> serialPairs = Sorted(sweepAndPrune.FindIntersectingPairs(polygons));
+
+    for (size_t threadsNumber : {1, 4})
+    {
+        WorkStealingThreadPool pool(threadsNumber);
+        ASSERT_EQ(Sorted(parallel_do_intersect(polygons, candidatePairs, pool)), serialPairs);
+    }
+}
+
+TEST(ParallelIntersection, Two_sets_against_serial)
+{
+    std::vector<std::vector<Point>> polygons1 = CreateRandomPolygons(150, 10.0, 32);
+    std::vector<std::vector<Point>> polygons2 = CreateRandomPolygons(200, 10.0, 32);
+
+    std::vector<PolygonPair> serialPairs = {};
+    for (size_t id1 = 0; id1 < polygons1.size(); ++id1)
+        for (size_t id2 = 0; id2 < polygons2.size(); ++id2)
+            if (do_intersect(polygons1[id1], polygons2[id2]))
+                serialPairs.emplace_back(id1, id2);
+
+    WorkStealingThreadPool pool(4);
+    ASSERT_EQ(Sorted(parallel_do_intersect(polygons1, polygons2, pool)), serialPairs);
+}
+
+TEST(ParallelIntersection, Empty_input)
+{
+    WorkStealingThreadPool pool(2);
+    ASSERT_TRUE(parallel_do_intersect({}, std::vector<PolygonPair>(), pool).empty());
+    ASSERT_TRUE(parallel_do_intersect(std::vector<std::vector<Point>>(), std::vector<std::vector<Point>>(), pool).empty());
+}
+
+TEST(ParallelIntersection, Invalid_polygon_exception)
+{
+    std::vector<std::vector<Point>> polygons = {{{0, 0}, {1, 0}, {1, 1}}, {{0, 0}, {1, 0}}};
+    WorkStealingThreadPool pool(2);
+    EXPECT_THROW(parallel_do_intersect(polygons, std::vector<PolygonPair>{{0, 1}}, pool), std::invalid_argument);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,146 @@
+#include "polygon_operations/polygon_metrics.h"
+#include "polygon_operations/convex_hull.h"
+#include "gtest/gtest.h"
+#include "test_utilities.h"
+#include <random>
+#include <cmath>
+
+std::random_device rd;  // Will be used to obtain a seed for the random number engine
+std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+
+// Utility functions
+// One loop per metric, integrating over the triangles fanning from the first vertex
+PolygonMetrics MetricsReference(const std::vector<Point>& originalPolygon)
+{
+    PolygonMetrics metrics;
+    const size_t n = originalPolygon.size();
+    const Point origin = originalPolygon[0];
+    std::vector<Point> polygon = {};
+    for (const auto& vertex : originalPolygon)
+        polygon.emplace_back(Point(vertex.x - origin.x, vertex.y - origin.y));
+
+    for (size_t i = 0; i < n; ++i)
+        metrics.area += (polygon[i].x * polygon[(i + 1) % n].y - polygon[(i + 1) % n].x * polygon[i].y) / 2.0;
+
+    for (size_t i = 0; i < n; ++i)
+        metrics.perimeter += EuclideanDistance(polygon[i], polygon[(i + 1) % n]);
+
+    double centroidX = 0.0;
+    double centroidY = 0.0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        const Point& a = polygon[i];
+        const Point& b = polygon[(i + 1) % n];
+        const double triangleArea = (a.x * b.y - b.x * a.y) / 2.0;
+        centroidX += triangleArea * (a.x + b.x) / 3.0;
+        centroidY += triangleArea * (a.y + b.y) / 3.0;
+    }
+    metrics.centroid = Point(centroidX / metrics.area, centroidY / metrics.area);
+
+    // Second moments of the triangles (centroid, a, b), exact for quadratic integrands with the edge midpoints rule
+    for (size_t i = 0; i < n; ++i)
+    {
+        const Point a(polygon[i].x - metrics.centroid.x, polygon[i].y - metrics.centroid.y);
+        const Point b(polygon[(i + 1) % n].x - metrics.centroid.x, polygon[(i + 1) % n].y - metrics.centroid.y);
+        const double triangleArea = (a.x * b.y - b.x * a.y) / 2.0;
+        const Point midpoints[3] = {Point(a.x / 2.0, a.y / 2.0), Point(b.x / 2.0, b.y / 2.0), Point((a.x + b.x) / 2.0, (a.y + b.y) / 2.0)};
+        for (const auto& midpoint : midpoints)
+        {
+            metrics.momentXX += triangleArea * midpoint.x * midpoint.x / 3.0;
+            metrics.momentYY += triangleArea * midpoint.y * midpoint.y / 3.0;
+            metrics.momentXY += triangleArea * midpoint.x * midpoint.y / 3.0;
+        }
+    }
+    metrics.centroid = Point(metrics.centroid.x + origin.x, metrics.centroid.y + origin.y);
+    return metrics;
+}
+
+void ExpectMetricsNear(const PolygonMetrics& metrics, const PolygonMetrics& expected, double tolerance)
+{
+    ASSERT_NEAR(metrics.area, expected.area, tolerance);
+    ASSERT_NEAR(metrics.centroid.x, expected.centroid.x, tolerance);
+    ASSERT_NEAR(metrics.centroid.y, expected.centroid.y, tolerance);
+    ASSERT_NEAR(metrics.perimeter, expected.perimeter, tolerance);
+    ASSERT_NEAR(metrics.momentXX, expected.momentXX, tolerance);
+    ASSERT_NEAR(metrics.momentYY, expected.momentYY, tolerance);
+    ASSERT_NEAR(metrics.momentXY, expected.momentXY, tolerance);
+}
+
+TEST(PolygonMetrics, Rectangle)
+{
+    // A 4 x 2 rectangle centered at (3, 2)
+    std::vector<Point> rectangle = {{1, 1}, {5, 1}, {5, 3}, {1, 3}};
+    PolygonMetrics metrics = polygon_metrics(rectangle);
+    ASSERT_DOUBLE_EQ(metrics.area, 8.0);
+    ASSERT_EQ(metrics.centroid, Point(3.0, 2.0));
+    ASSERT_DOUBLE_EQ(metrics.perimeter, 12.0);
+    ASSERT_DOUBLE_EQ(metrics.momentXX, 2.0 * 4.0 * 4.0 * 4.0 / 12.0);
+    ASSERT_DOUBLE_EQ(metrics.momentYY, 4.0 * 2.0 * 2.0 * 2.0 / 12.0);
+    ASSERT_NEAR(metrics.momentXY, 0.0, 1e-12);
+
+    // Clockwise order flips the signs of the area and the moments
+    std::reverse(rectangle.begin(), rectangle.end());
+    metrics = polygon_metrics(rectangle);
+    ASSERT_DOUBLE_EQ(metrics.area, -8.0);
+    ASSERT_EQ(metrics.centroid, Point(3.0, 2.0));
+
+    // Degenerate polygons
+    metrics = polygon_metrics(std::vector<Point>({{0, 0}, {2, 2}}));
+    ASSERT_EQ(metrics.area, 0.0);
+    ASSERT_EQ(metrics.centroid, Point(1.0, 1.0));
+    ASSERT_DOUBLE_EQ(metrics.perimeter, 4.0 * std::sqrt(2.0));
+    metrics = polygon_metrics(std::vector<Point>());
+    ASSERT_EQ(metrics.perimeter, 0.0);
+}
+
+TEST(PolygonMetrics, Random_against_reference)
+{
+    std::uniform_real_distribution<double> centerDistribution(-100.0, 100.0);
+    std::uniform_real_distribution<double> radiusDistribution(0.1, 10.0);
+    for (size_t iter = 0; iter < 2000; ++iter)
+    {
+        // All the sizes modulo the SIMD width
+        std::vector<Point> polygon = CreateRandomConvexPolygon(centerDistribution(gen), centerDistribution(gen),
+                                                               radiusDistribution(gen), 3 + iter % 40);
+        if (polygon.size() < 3)
+            continue;
+        const PolygonMetrics expected = MetricsReference(polygon);
+        const double scale = std::max(1.0, std::fabs(expected.momentXX) + std::fabs(expected.momentYY));
+        ExpectMetricsNear(polygon_metrics(polygon), expected, 1e-9 * scale);
+    }
+}
+
+TEST(PolygonMetrics, Convex_hull_stack)
+{
+    std::uniform_real_distribution<double> coordinateDistribution(-1.0, 1.0);
+    std::vector<Point> points = {};
+    for (size_t pointId = 0; pointId < 1000; ++pointId)
+        points.emplace_back(Point(coordinateDistribution(gen), coordinateDistribution(gen)));
+
+    const std::vector<Point> hull = StackToVectorFromBottom(convex_hull_from_points(points));
+    const PolygonMetrics metrics = polygon_metrics(hull);
+    ExpectMetricsNear(metrics, MetricsReference(hull), 1e-12);
+    ASSERT_GT(metrics.area, 3.5);
+    ASSERT_LE(metrics.area, 4.0);
+}
+
+TEST(PolygonMetrics, Batch_against_single)
+{
+    PolygonBatch polygons;
+    std::uniform_int_distribution<size_t> sizeDistribution(3, 50);
+    for (size_t polygonId = 0; polygonId < 3000; ++polygonId)
+        polygons.Add(CreateRandomConvexPolygon(polygonId, 0.0, 1.0, sizeDistribution(gen)));
+    polygons.Add({});
+
+    WorkStealingThreadPool pool(4);
+    const std::vector<PolygonMetrics> metrics = polygon_metrics_batch(polygons, pool);
+    ASSERT_EQ(metrics.size(), polygons.Size());
+    for (size_t polygonId = 0; polygonId < polygons.Size(); ++polygonId)
+        ExpectMetricsNear(metrics[polygonId], polygon_metrics(polygons.ToVector(polygonId)), 0.0);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
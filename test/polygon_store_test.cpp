@@ -0,0 +1,273 @@
+#include "polygon_operations/polygon_store.h"
+#include "polygon_operations/convex_polygon.h"
+#include "gtest/gtest.h"
+#include <random>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+std::random_device rd;  // Will be used to obtain a seed for the random number engine
+std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+
+// Utility functions
+// Random polygon with counterclockwise vertices on a circle
+std::vector<Point> CreateRandomPolygon(double centerX, double centerY, double radius, size_t verticesNumber)
+{
+    std::uniform_real_distribution<double> angleDistribution(0.0, 2.0 * M_PI);
+    std::vector<double> angles(verticesNumber, 0.0);
+    for (double& angle : angles)
+        angle = angleDistribution(gen);
+    std::sort(angles.begin(), angles.end());
+
+    std::vector<Point> polygon = {};
+    for (double angle : angles)
+        polygon.emplace_back(Point(centerX + radius * cos(angle), centerY + radius * sin(angle)));
+    return polygon;
+}
+
+// Whether a point lies on the left of every edge of a counterclockwise polygon
+bool PointIsInPolygon(const Point& point, const std::vector<Point>& polygon)
+{
+    for (size_t vertexId = 0; vertexId < polygon.size(); ++vertexId)
+    {
+        const Point& tail = polygon[vertexId];
+        const Point& head = polygon[(vertexId + 1) % polygon.size()];
+        if ((head.x - tail.x) * (point.y - tail.y) - (head.y - tail.y) * (point.x - tail.x) < 0.0)
+            return false;
+    }
+    return true;
+}
+
+PolygonBatch CreateRandomBatch(size_t polygonsNumber)
+{
+    std::uniform_real_distribution<double> centerDistribution(-10.0, 10.0);
+    std::uniform_int_distribution<size_t> sizeDistribution(3, 30);
+    PolygonBatch batch;
+    for (size_t polygonId = 0; polygonId < polygonsNumber; ++polygonId)
+        batch.Add(CreateRandomPolygon(centerDistribution(gen), centerDistribution(gen), 1.0, sizeDistribution(gen)));
+    return batch;
+}
+
+// Path of a temporary file removed at the end of the test
+struct TemporaryFile
+{
+    explicit TemporaryFile(const std::string& name): path((std::filesystem::temp_directory_path() / name).string()) {}
+    ~TemporaryFile() {std::remove(path.c_str());}
+    std::string path;
+};
+
+TEST(PolygonStore, Round_trip)
+{
+    const PolygonBatch batch = CreateRandomBatch(1000);
+    TemporaryFile file("polygon_store_round_trip.bin");
+    PolygonStoreOptions options;
+    options.edgeNormals = true;
+    write_polygon_store(file.path, batch, options);
+
+    const PolygonStore store(file.path);
+    ASSERT_EQ(store.Size(), batch.Size());
+    ASSERT_EQ(store.VerticesNumber(), batch.vertices.size());
+    ASSERT_TRUE(store.HasBoundingBoxes());
+    ASSERT_TRUE(store.HasEdgeNormals());
+    for (size_t polygonId = 0; polygonId < batch.Size(); ++polygonId)
+    {
+        ASSERT_EQ(store.PolygonSize(polygonId), batch.PolygonSize(polygonId));
+        const std::vector<Point> polygon(store.Polygon(polygonId), store.Polygon(polygonId) + store.PolygonSize(polygonId));
+        ASSERT_EQ(polygon, batch.ToVector(polygonId));
+
+        const BoundingBox box = ComputeBoundingBox(polygon);
+        ASSERT_EQ(store.Box(polygonId).minX, box.minX);
+        ASSERT_EQ(store.Box(polygonId).minY, box.minY);
+        ASSERT_EQ(store.Box(polygonId).maxX, box.maxX);
+        ASSERT_EQ(store.Box(polygonId).maxY, box.maxY);
+
+        // Every normal points towards the inside of its counterclockwise polygon
+        for (size_t vertexId = 0; vertexId < polygon.size(); ++vertexId)
+        {
+            const Point& normal = store.EdgeNormals(polygonId)[vertexId];
+            const Point& opposite = polygon[(vertexId + 2) % polygon.size()];
+            ASSERT_GT(normal.x * (opposite.x - polygon[vertexId].x) + normal.y * (opposite.y - polygon[vertexId].y), 0.0);
+        }
+    }
+
+    const PolygonBatch copy = store.ToBatch();
+    ASSERT_TRUE(copy.vertices == batch.vertices);
+    ASSERT_TRUE(copy.offsets == batch.offsets);
+}
+
+TEST(PolygonStore, Queries_on_views)
+{
+    const PolygonBatch batch = CreateRandomBatch(200);
+    TemporaryFile file("polygon_store_queries.bin");
+    write_polygon_store(file.path, batch);
+    const PolygonStore store(file.path);
+    ASSERT_FALSE(store.HasEdgeNormals());
+
+    std::uniform_real_distribution<double> distribution(-11.0, 11.0);
+    for (size_t pointId = 0; pointId < 1000; ++pointId)
+    {
+        const Point point(distribution(gen), distribution(gen));
+        const size_t polygonId = pointId % store.Size();
+        ASSERT_EQ(point_is_in_polygon(point, store.Polygon(polygonId), store.PolygonSize(polygonId)),
+                  PointIsInPolygon(point, batch.ToVector(polygonId)));
+    }
+
+    for (size_t polygon1 = 0; polygon1 < store.Size(); ++polygon1)
+    {
+        for (size_t polygon2 = polygon1 + 1; polygon2 < store.Size(); ++polygon2)
+        {
+            const bool intersect = do_intersect(store.Polygon(polygon1), store.PolygonSize(polygon1),
+                                                store.Polygon(polygon2), store.PolygonSize(polygon2));
+            ASSERT_EQ(intersect, do_intersect(batch.ToVector(polygon1), batch.ToVector(polygon2)));
+            // Intersecting polygons have overlapping boxes
+            if (intersect)
+            {
+                ASSERT_TRUE(store.Box(polygon1).Overlaps(store.Box(polygon2)));
+            }
+        }
+    }
+}
+
+TEST(PolygonStore, Empty_batch_and_sections)
+{
+    TemporaryFile file("polygon_store_empty.bin");
+    PolygonStoreOptions options;
+    options.boundingBoxes = false;
+    write_polygon_store(file.path, PolygonBatch(), options);
+    const PolygonStore store(file.path);
+    ASSERT_EQ(store.Size(), 0);
+    ASSERT_EQ(store.VerticesNumber(), 0);
+    ASSERT_FALSE(store.HasBoundingBoxes());
+    ASSERT_FALSE(store.HasEdgeNormals());
+}
+
+TEST(PolygonStore, Move)
+{
+    const PolygonBatch batch = CreateRandomBatch(10);
+    TemporaryFile file("polygon_store_move.bin");
+    write_polygon_store(file.path, batch);
+
+    PolygonStore store(file.path);
+    const Point* polygon = store.Polygon(3);
+    PolygonStore moved(std::move(store));
+    ASSERT_EQ(store.Size(), 0);
+    ASSERT_EQ(moved.Size(), 10);
+    ASSERT_EQ(moved.Polygon(3), polygon);
+
+    store = std::move(moved);
+    ASSERT_EQ(store.Size(), 10);
+    ASSERT_EQ(store.Polygon(3)[0], batch.Polygon(3)[0]);
+}
+
+TEST(PolygonStore, Invalid_files)
+{
+    const PolygonBatch batch = CreateRandomBatch(10);
+    TemporaryFile file("polygon_store_invalid.bin");
+    ASSERT_THROW(PolygonStore store(file.path), std::runtime_error);
+
+    write_polygon_store(file.path, batch);
+    std::ifstream input(file.path, std::ios::binary);
+    const std::string bytes((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+    input.close();
+
+    const auto writeBytes = [&](const std::string& content) {
+        std::ofstream output(file.path, std::ios::binary | std::ios::trunc);
+        output.write(content.data(), static_cast<std::streamsize>(content.size()));
+    };
+
+    // Shorter than the header
+    writeBytes(bytes.substr(0, 32));
+    ASSERT_THROW(PolygonStore store(file.path), std::invalid_argument);
+
+    // Wrong magic
+    std::string corrupted = bytes;
+    corrupted[0] = 'X';
+    writeBytes(corrupted);
+    ASSERT_THROW(PolygonStore store(file.path), std::invalid_argument);
+
+    // Unsupported version
+    corrupted = bytes;
+    corrupted[8] = 99;
+    writeBytes(corrupted);
+    ASSERT_THROW(PolygonStore store(file.path), std::invalid_argument);
+
+    // Truncated sections
+    writeBytes(bytes.substr(0, bytes.size() - 64));
+    ASSERT_THROW(PolygonStore store(file.path), std::invalid_argument);
+
+    // Number of polygons beyond the file
+    corrupted = bytes;
+    const uint64_t polygonsNumber = uint64_t(1) << 62;
+    std::memcpy(&corrupted[16], &polygonsNumber, sizeof(polygonsNumber));
+    writeBytes(corrupted);
+    ASSERT_THROW(PolygonStore store(file.path), std::invalid_argument);
+
+    writeBytes(bytes);
+    ASSERT_NO_THROW(PolygonStore store(file.path));
+}
+
+TEST(PolygonStore, Validate)
+{
+    const PolygonBatch batch = CreateRandomBatch(10);
+    TemporaryFile file("polygon_store_validate.bin");
+    write_polygon_store(file.path, batch);
+    {
+        const PolygonStore store(file.path);
+        ASSERT_NO_THROW(store.Validate());
+    }
+
+    std::ifstream input(file.path, std::ios::binary);
+    const std::string bytes((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+    input.close();
+
+    const auto writeOffset = [&](size_t polygonId, uint64_t offset) {
+        // The offsets follow the header of 64 bytes
+        std::string corrupted = bytes;
+        std::memcpy(&corrupted[64 + polygonId * sizeof(uint64_t)], &offset, sizeof(offset));
+        std::ofstream output(file.path, std::ios::binary | std::ios::trunc);
+        output.write(corrupted.data(), static_cast<std::streamsize>(corrupted.size()));
+    };
+
+    // Interior offsets are trusted by the constructor and rejected by Validate
+    writeOffset(5, uint64_t(1) << 40);
+    {
+        const PolygonStore store(file.path);
+        ASSERT_THROW(store.Validate(), std::invalid_argument);
+    }
+
+    writeOffset(5, 0);
+    {
+        const PolygonStore store(file.path);
+        ASSERT_THROW(store.Validate(), std::invalid_argument);
+    }
+}
+
+TEST(PolygonStore, Atomic_write)
+{
+    TemporaryFile file("polygon_store_atomic.bin");
+    write_polygon_store(file.path, CreateRandomBatch(10));
+    const PolygonStore store(file.path);
+
+    // Rewriting replaces the file instead of truncating it, so the mapped store keeps its polygons
+    const PolygonBatch batch = CreateRandomBatch(20);
+    write_polygon_store(file.path, batch);
+    ASSERT_EQ(store.Size(), 10u);
+    ASSERT_NO_THROW(store.Validate());
+    ASSERT_EQ(PolygonStore(file.path).Size(), batch.Size());
+
+    // No temporary file is left next to the store
+    const std::filesystem::path path(file.path);
+    for (const auto& entry : std::filesystem::directory_iterator(path.has_parent_path() ? path.parent_path() : "."))
+        ASSERT_EQ(entry.path().filename().string().find(path.filename().string() + ".tmp"), std::string::npos);
+
+    // A write into a missing directory fails before replacing anything
+    ASSERT_THROW(write_polygon_store(file.path + "_missing/store.bin", batch), std::runtime_error);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
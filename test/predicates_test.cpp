@@ -0,0 +1,412 @@
+#include "polygon_operations/predicates.h"
+#include "polygon_operations/convex_hull.h"
+#include "polygon_operations/convex_polygon.h"
+#include "polygon_operations/convex_intersection.h"
+#include "gtest/gtest.h"
+#include <random>
+#include <cmath>
+
+// Fixed seed, so that the statistical bounds on the fallbacks are checked on the same points at every run
+std::mt19937 gen(20240611);
+
+// Utility functions
+int Sign(double value)
+{
+    return (value > 0.0) - (value < 0.0);
+}
+
+// Exact sign of the orientation of points given by integer coordinates
+int ExactSign(long long ax, long long ay, long long bx, long long by, long long cx, long long cy)
+{
+    const __int128 determinant = (__int128)(bx - ax) * (cy - ay) - (__int128)(cx - ax) * (by - ay);
+    return (determinant > 0) - (determinant < 0);
+}
+
+// Points on the grid of spacing 2^-20, whose products need more bits than a double holds
+const double gridSpacing = std::ldexp(1.0, -20);
+
+Point GridPoint(long long x, long long y)
+{
+    return Point(x * gridSpacing, y * gridSpacing);
+}
+
+TEST(Predicates, Exactly_collinear)
+{
+    ASSERT_EQ(orient2d_adaptive({0, 0}, {1, 1}, {3, 3}), 0.0);
+    ASSERT_EQ(orient2d_adaptive({0.1, 0.1}, {0.2, 0.2}, {0.1, 0.1}), 0.0);
+    ASSERT_GT(orient2d_adaptive({0, 0}, {1, 0}, {0, 1}), 0.0);
+    ASSERT_LT(orient2d_adaptive({0, 0}, {0, 1}, {1, 0}), 0.0);
+    ASSERT_EQ(orient2d({0, 0}, {1, 0}, {0, 1}, OrientationPredicate::Fast), 1.0);
+    ASSERT_EQ(orient2d({0, 0}, {1, 0}, {0, 1}, OrientationPredicate::Adaptive), 1.0);
+}
+
+TEST(Predicates, Nearly_collinear_against_exact)
+{
+    // Shewchuk's example: a sweeps a 256 x 256 grid of doubles next to 0.5 and b, c lie on the line y = x.
+    // Scaled by 2^53 all the coordinates are integers.
+    const double unit = std::ldexp(1.0, -53);
+    const long long half = 1LL << 52;
+    const Point b(12.0, 12.0);
+    const Point c(24.0, 24.0);
+    size_t fastWrongSigns = 0;
+    for (long long i = 0; i < 256; ++i)
+    {
+        for (long long j = 0; j < 256; ++j)
+        {
+            const Point a(0.5 + i * unit, 0.5 + j * unit);
+            const int exact = ExactSign(half + i, half + j, 12LL << 53, 12LL << 53, 24LL << 53, 24LL << 53);
+            ASSERT_EQ(Sign(orient2d_adaptive(a, b, c)), exact);
+            ASSERT_EQ(Sign(orient2d_adaptive(b, c, a)), exact);
+            ASSERT_EQ(Sign(orient2d_adaptive(c, b, a)), -exact);
+            fastWrongSigns += (Sign(orient2d_fast(a, b, c)) != exact);
+        }
+    }
+    // The plain double determinant is wrong for a sizable part of the grid
+    ASSERT_GT(fastWrongSigns, 0);
+}
+
+TEST(Predicates, Static_bound_against_exact)
+{
+    // Same grid as above, tested by a kernel certifying the signs with the bounding box of the points
+    const double unit = std::ldexp(1.0, -53);
+    const long long half = 1LL << 52;
+    const Point b(12.0, 12.0);
+    const Point c(24.0, 24.0);
+    const OrientationKernel<OrientationPredicate::Adaptive> orientation(BoundingBox{0.5, 0.5, 24.0, 24.0});
+    const int orientationOfSign[3] = {1, 0, 2};
+    for (long long i = 0; i < 256; ++i)
+    {
+        for (long long j = 0; j < 256; ++j)
+        {
+            const Point a(0.5 + i * unit, 0.5 + j * unit);
+            const int exact = ExactSign(half + i, half + j, 12LL << 53, 12LL << 53, 24LL << 53, 24LL << 53);
+            ASSERT_EQ(orientation.Sign(a, b, c), exact);
+            ASSERT_EQ(orientation.Sign(c, b, a), -exact);
+            ASSERT_EQ(orientation.ThreePointOrientation(a, b, c), orientationOfSign[exact + 1]);
+        }
+    }
+    // Points far from collinear are certified by the bound on both sides
+    ASSERT_EQ(orientation.Sign(Point(0.5, 0.5), Point(24.0, 0.5), Point(24.0, 24.0)), 1);
+    ASSERT_EQ(orientation.Sign(Point(0.5, 0.5), Point(24.0, 24.0), Point(24.0, 0.5)), -1);
+}
+
+TEST(Predicates, Random_grid_against_exact)
+{
+    std::uniform_int_distribution<long long> coordinateDistribution(-(1LL << 31), 1LL << 31);
+    std::uniform_real_distribution<double> parameterDistribution(0.0, 1.0);
+    std::uniform_int_distribution<long long> offsetDistribution(-2, 2);
+    for (size_t iter = 0; iter < 100000; ++iter)
+    {
+        const long long ax = coordinateDistribution(gen), ay = coordinateDistribution(gen);
+        const long long bx = coordinateDistribution(gen), by = coordinateDistribution(gen);
+        // c next to the line through a and b
+        const double t = parameterDistribution(gen);
+        const long long cx = ax + std::llround(t * (bx - ax)) + offsetDistribution(gen);
+        const long long cy = ay + std::llround(t * (by - ay)) + offsetDistribution(gen);
+
+        const Point a = GridPoint(ax, ay), b = GridPoint(bx, by), c = GridPoint(cx, cy);
+        ASSERT_EQ(Sign(orient2d_adaptive(a, b, c)), ExactSign(ax, ay, bx, by, cx, cy));
+    }
+}
+
+TEST(Predicates, Filter_success_rate)
+{
+    std::uniform_real_distribution<double> coordinateDistribution(-1.0, 1.0);
+    const size_t maximumIterations = 100000;
+    size_t certified = 0;
+    for (size_t iter = 0; iter < maximumIterations; ++iter)
+    {
+        const Point a(coordinateDistribution(gen), coordinateDistribution(gen));
+        const Point b(coordinateDistribution(gen), coordinateDistribution(gen));
+        const Point c(coordinateDistribution(gen), coordinateDistribution(gen));
+        double determinant = 0.0;
+        if (orient2d_filter(a, b, c, determinant))
+        {
+            ++certified;
+            ASSERT_EQ(determinant, orient2d_adaptive(a, b, c));
+        }
+    }
+    ASSERT_GT(certified, 0.999 * maximumIterations);
+}
+
+TEST(Predicates, Three_point_orientation_agrees)
+{
+    std::uniform_real_distribution<double> coordinateDistribution(-100.0, 100.0);
+    for (size_t iter = 0; iter < 10000; ++iter)
+    {
+        const Point P(coordinateDistribution(gen), coordinateDistribution(gen));
+        const Point Q(coordinateDistribution(gen), coordinateDistribution(gen));
+        const Point R(coordinateDistribution(gen), coordinateDistribution(gen));
+        ASSERT_EQ(ThreePointOrientation(P, Q, R, OrientationPredicate::Adaptive), ThreePointOrientation(P, Q, R));
+    }
+}
+
+TEST(Predicates, Convex_hull_of_rotated_grid)
+{
+    // Rotation makes the collinear rows and columns of the grid only nearly collinear
+    const double angle = 0.3;
+    std::vector<Point> points = {};
+    for (int i = 0; i < 30; ++i)
+        for (int j = 0; j < 30; ++j)
+            points.emplace_back(Point(0.1 * (i * cos(angle) - j * sin(angle)), 0.1 * (i * sin(angle) + j * cos(angle))));
+    std::shuffle(points.begin(), points.end(), gen);
+
+    const std::vector<Point> hull = StackToVectorFromBottom(convex_hull_from_points(points, OrientationPredicate::Adaptive));
+    ASSERT_GE(hull.size(), 4);
+    for (size_t vertexId = 0; vertexId < hull.size(); ++vertexId)
+    {
+        const Point& a = hull[vertexId];
+        const Point& b = hull[(vertexId + 1) % hull.size()];
+        const Point& c = hull[(vertexId + 2) % hull.size()];
+        ASSERT_GT(orient2d_adaptive(a, b, c), 0.0);
+        // No point lies strictly outside of an edge of the hull
+        for (const auto& point : points)
+            ASSERT_GE(orient2d_adaptive(a, b, point), 0.0);
+    }
+}
+
+TEST(Predicates, Convex_hull_of_axis_aligned_grid)
+{
+    // Rows and columns of the grid are exactly collinear, including the first and the last ray from the lowest point
+    for (int gridSize : {4, 64})
+    {
+        std::vector<Point> points = {};
+        for (int i = 0; i < gridSize; ++i)
+            for (int j = 0; j < gridSize; ++j)
+                points.emplace_back(Point(i, j));
+        std::shuffle(points.begin(), points.end(), gen);
+
+        const double last = gridSize - 1;
+        const std::vector<Point> expected = {Point(0.0, 0.0), Point(last, 0.0), Point(last, last), Point(0.0, last)};
+        for (OrientationPredicate predicate : {OrientationPredicate::Fast, OrientationPredicate::Adaptive, OrientationPredicate::MixedPrecision})
+            ASSERT_EQ(StackToVectorFromBottom(convex_hull_from_points(points, predicate)), expected);
+    }
+}
+
+TEST(Predicates, Point_in_polygon_near_the_edges)
+{
+    // Counterclockwise quadrilateral on the grid
+    const long long vertices[4][2] = {{-1500000001, -700000003}, {1300000007, -900000011},
+                                      {1700000013, 1100000017}, {-900000019, 1500000023}};
+    std::stack<Point> polygon = {};
+    for (const auto& vertex : vertices)
+        polygon.push(GridPoint(vertex[0], vertex[1]));
+
+    std::uniform_int_distribution<size_t> edgeDistribution(0, 3);
+    std::uniform_real_distribution<double> parameterDistribution(0.0, 1.0);
+    std::uniform_int_distribution<long long> offsetDistribution(-2, 2);
+    for (size_t iter = 0; iter < 20000; ++iter)
+    {
+        const size_t edgeId = edgeDistribution(gen);
+        const long long* tail = vertices[edgeId];
+        const long long* head = vertices[(edgeId + 1) % 4];
+        const double t = parameterDistribution(gen);
+        const long long x = tail[0] + std::llround(t * (head[0] - tail[0])) + offsetDistribution(gen);
+        const long long y = tail[1] + std::llround(t * (head[1] - tail[1])) + offsetDistribution(gen);
+
+        // The point is inside or on the boundary when it is not right of any edge
+        bool inside = true;
+        for (size_t vertexId = 0; vertexId < 4; ++vertexId)
+        {
+            const long long* a = vertices[vertexId];
+            const long long* b = vertices[(vertexId + 1) % 4];
+            inside = inside && (ExactSign(a[0], a[1], b[0], b[1], x, y) >= 0);
+        }
+        ASSERT_EQ(point_is_in_polygon(GridPoint(x, y), polygon, OrientationPredicate::Adaptive), inside);
+    }
+}
+
+TEST(Predicates, Convex_intersection_agrees)
+{
+    std::uniform_real_distribution<double> centerDistribution(-1.0, 1.0);
+    for (size_t iter = 0; iter < 1000; ++iter)
+    {
+        std::vector<Point> polygon1 = {}, polygon2 = {};
+        for (size_t vertexId = 0; vertexId < 12; ++vertexId)
+        {
+            const double angle = 2.0 * M_PI * vertexId / 12;
+            polygon1.emplace_back(Point(cos(angle), sin(angle)));
+            polygon2.emplace_back(Point(centerDistribution(gen) + cos(angle + 0.1), centerDistribution(gen) + sin(angle + 0.1)));
+        }
+        std::vector<Point> fast = {}, adaptive = {};
+        convex_polygon_intersection(polygon1, polygon2, fast);
+        convex_polygon_intersection(polygon1, polygon2, adaptive, OrientationPredicate::Adaptive);
+        ASSERT_EQ(fast.size(), adaptive.size());
+        for (size_t vertexId = 0; vertexId < fast.size(); ++vertexId)
+            ASSERT_EQ(fast[vertexId], adaptive[vertexId]);
+    }
+
+    // A polygon intersected with itself is the polygon itself
+    std::vector<Point> polygon = {GridPoint(-1500000001, -700000003), GridPoint(1300000007, -900000011),
+                                  GridPoint(1700000013, 1100000017), GridPoint(-900000019, 1500000023)};
+    std::vector<Point> intersection = {};
+    convex_polygon_intersection(polygon, polygon, intersection, OrientationPredicate::Adaptive);
+    ASSERT_EQ(intersection.size(), polygon.size());
+}
+
+TEST(MixedPrecisionPredicates, Signs_against_exact)
+{
+    std::uniform_int_distribution<long long> coordinateDistribution(-(1LL << 31), 1LL << 31);
+    std::uniform_real_distribution<double> parameterDistribution(0.0, 1.0);
+    std::uniform_int_distribution<long long> offsetDistribution(-2, 2);
+    for (size_t iter = 0; iter < 200; ++iter)
+    {
+        const long long ax = coordinateDistribution(gen), ay = coordinateDistribution(gen);
+        const long long bx = coordinateDistribution(gen), by = coordinateDistribution(gen);
+        // Points next to the line through a and b and arbitrary points, with all the sizes modulo the SIMD width
+        std::vector<long long> xs = {}, ys = {};
+        std::vector<Point> points = {};
+        for (size_t pointId = 0; pointId < 300 + iter; ++pointId)
+        {
+            const double t = parameterDistribution(gen);
+            const bool nearTheLine = pointId % 2;
+            xs.push_back(nearTheLine ? ax + std::llround(t * (bx - ax)) + offsetDistribution(gen) : coordinateDistribution(gen));
+            ys.push_back(nearTheLine ? ay + std::llround(t * (by - ay)) + offsetDistribution(gen) : coordinateDistribution(gen));
+            points.push_back(GridPoint(xs.back(), ys.back()));
+        }
+
+        std::vector<signed char> signs(points.size(), 2);
+        const size_t fallbacks = orient2d_signs(GridPoint(ax, ay), GridPoint(bx, by), points.data(), points.size(),
+                                                signs.data(), OrientationPredicate::MixedPrecision);
+        // Only the points next to the line and the rare arbitrary points nearly collinear with a and b need the fallback
+        std::vector<Point> arbitraryPoints = {};
+        for (size_t pointId = 0; pointId < points.size(); pointId += 2)
+            arbitraryPoints.push_back(points[pointId]);
+        std::vector<signed char> arbitrarySigns(arbitraryPoints.size(), 2);
+        const size_t arbitraryFallbacks = orient2d_signs(GridPoint(ax, ay), GridPoint(bx, by), arbitraryPoints.data(), arbitraryPoints.size(),
+                                                         arbitrarySigns.data(), OrientationPredicate::MixedPrecision);
+        ASSERT_LE(arbitraryFallbacks, arbitraryPoints.size() / 100);
+        ASSERT_LE(fallbacks, points.size() / 2 + arbitraryFallbacks);
+        for (size_t pointId = 0; pointId < points.size(); ++pointId)
+        {
+            ASSERT_EQ(signs[pointId], ExactSign(ax, ay, bx, by, xs[pointId], ys[pointId]));
+            ASSERT_EQ(Sign(orient2d(GridPoint(ax, ay), GridPoint(bx, by), points[pointId], OrientationPredicate::MixedPrecision)),
+                      signs[pointId]);
+        }
+    }
+}
+
+TEST(MixedPrecisionPredicates, Predicates_agree)
+{
+    std::uniform_real_distribution<double> coordinateDistribution(-1.0, 1.0);
+    std::vector<Point> points = {};
+    for (size_t pointId = 0; pointId < 1000; ++pointId)
+        points.emplace_back(Point(coordinateDistribution(gen), coordinateDistribution(gen)));
+    const Point a(coordinateDistribution(gen), coordinateDistribution(gen));
+    const Point b(coordinateDistribution(gen), coordinateDistribution(gen));
+
+    std::vector<signed char> fast(points.size()), adaptive(points.size()), mixed(points.size());
+    ASSERT_EQ(orient2d_signs(a, b, points.data(), points.size(), fast.data(), OrientationPredicate::Fast), 0);
+    orient2d_signs(a, b, points.data(), points.size(), adaptive.data(), OrientationPredicate::Adaptive);
+    // Uniform points are nearly always certified in float
+    ASSERT_LT(orient2d_signs(a, b, points.data(), points.size(), mixed.data(), OrientationPredicate::MixedPrecision), 10);
+    ASSERT_EQ(fast, adaptive);
+    ASSERT_EQ(mixed, adaptive);
+
+    // Points on the line and the endpoints themselves
+    std::vector<Point> onTheLine = {a, b, Point(2.0 * b.x - a.x, 2.0 * b.y - a.y), Point(0.0, 0.0), Point(0.0, 0.0)};
+    std::vector<signed char> signs(onTheLine.size());
+    orient2d_signs(Point(-1.0, -1.0), Point(1.0, 1.0), onTheLine.data() + 3, 2, signs.data(), OrientationPredicate::MixedPrecision);
+    ASSERT_EQ(signs[0], 0);
+    ASSERT_EQ(signs[1], 0);
+    orient2d_signs(a, b, onTheLine.data(), 3, signs.data(), OrientationPredicate::MixedPrecision);
+    ASSERT_EQ(signs[0], 0);
+    ASSERT_EQ(signs[1], 0);
+    ASSERT_EQ(signs[2], Sign(orient2d_exact(a, b, onTheLine[2])));
+}
+
+TEST(MixedPrecisionPredicates, Out_of_float_range)
+{
+    // Scaling by powers of two keeps the exact signs, while the float differences underflow or overflow
+    std::uniform_int_distribution<long long> coordinateDistribution(-1000, 1000);
+    for (int exponent : {-160, -140, -130, 0, 100, 130, 200})
+    {
+        const long long ax = coordinateDistribution(gen), ay = coordinateDistribution(gen);
+        const long long bx = coordinateDistribution(gen), by = coordinateDistribution(gen);
+        std::vector<long long> xs = {}, ys = {};
+        std::vector<Point> points = {};
+        for (size_t pointId = 0; pointId < 100; ++pointId)
+        {
+            xs.push_back(coordinateDistribution(gen));
+            ys.push_back(coordinateDistribution(gen));
+            points.emplace_back(Point(std::ldexp(xs.back(), exponent), std::ldexp(ys.back(), exponent)));
+        }
+        std::vector<signed char> signs(points.size());
+        orient2d_signs(Point(std::ldexp(ax, exponent), std::ldexp(ay, exponent)),
+                       Point(std::ldexp(bx, exponent), std::ldexp(by, exponent)), points.data(), points.size(),
+                       signs.data(), OrientationPredicate::MixedPrecision);
+        for (size_t pointId = 0; pointId < points.size(); ++pointId)
+            ASSERT_EQ(signs[pointId], ExactSign(ax, ay, bx, by, xs[pointId], ys[pointId])) << exponent;
+    }
+}
+
+TEST(MixedPrecisionPredicates, Points_in_polygon)
+{
+    const long long vertices[4][2] = {{-1500000001, -700000003}, {1300000007, -900000011},
+                                      {1700000013, 1100000017}, {-900000019, 1500000023}};
+    std::vector<Point> polygon = {};
+    std::stack<Point> polygonStack = {};
+    for (const auto& vertex : vertices)
+    {
+        polygon.push_back(GridPoint(vertex[0], vertex[1]));
+        polygonStack.push(polygon.back());
+    }
+
+    // Points next to the edges and points spread over the bounding box
+    std::uniform_int_distribution<size_t> edgeDistribution(0, 3);
+    std::uniform_real_distribution<double> parameterDistribution(0.0, 1.0);
+    std::uniform_int_distribution<long long> offsetDistribution(-2, 2);
+    std::uniform_int_distribution<long long> coordinateDistribution(-1800000000, 1800000000);
+    std::vector<Point> points = {};
+    for (size_t pointId = 0; pointId < 5001; ++pointId)
+    {
+        if (pointId % 2)
+        {
+            points.push_back(GridPoint(coordinateDistribution(gen), coordinateDistribution(gen)));
+            continue;
+        }
+        const size_t edgeId = edgeDistribution(gen);
+        const long long* tail = vertices[edgeId];
+        const long long* head = vertices[(edgeId + 1) % 4];
+        const double t = parameterDistribution(gen);
+        points.push_back(GridPoint(tail[0] + std::llround(t * (head[0] - tail[0])) + offsetDistribution(gen),
+                                   tail[1] + std::llround(t * (head[1] - tail[1])) + offsetDistribution(gen)));
+    }
+
+    const std::vector<bool> inside = points_are_in_polygon(points, polygon);
+    ASSERT_EQ(inside.size(), points.size());
+    for (size_t pointId = 0; pointId < points.size(); ++pointId)
+        ASSERT_EQ(inside[pointId], point_is_in_polygon(points[pointId], polygonStack, OrientationPredicate::Adaptive));
+    ASSERT_EQ(points_are_in_polygon(points, polygon, OrientationPredicate::Adaptive), inside);
+
+    EXPECT_THROW(points_are_in_polygon(points, std::vector<Point>({{0, 0}, {1, 1}})), std::invalid_argument);
+    ASSERT_TRUE(points_are_in_polygon({}, polygon).empty());
+}
+
+TEST(MixedPrecisionPredicates, Convex_hull_with_culling)
+{
+    std::uniform_real_distribution<double> coordinateDistribution(-1.0, 1.0);
+    for (size_t iter = 0; iter < 50; ++iter)
+    {
+        std::vector<Point> points = {};
+        for (size_t pointId = 0; pointId < 10 + 50 * iter; ++pointId)
+            points.emplace_back(Point(coordinateDistribution(gen), coordinateDistribution(gen)));
+        ASSERT_EQ(StackToVectorFromBottom(convex_hull_from_points(points, OrientationPredicate::MixedPrecision)),
+                  StackToVectorFromBottom(convex_hull_from_points(points, OrientationPredicate::Adaptive)));
+    }
+
+    // Nearly collinear rows and columns
+    std::vector<Point> grid = {};
+    for (int i = 0; i < 30; ++i)
+        for (int j = 0; j < 30; ++j)
+            grid.emplace_back(Point(0.1 * (i * cos(0.3) - j * sin(0.3)), 0.1 * (i * sin(0.3) + j * cos(0.3))));
+    std::shuffle(grid.begin(), grid.end(), gen);
+    ASSERT_EQ(StackToVectorFromBottom(convex_hull_from_points(grid, OrientationPredicate::MixedPrecision)),
+              StackToVectorFromBottom(convex_hull_from_points(grid, OrientationPredicate::Adaptive)));
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
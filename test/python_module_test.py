@@ -0,0 +1,168 @@
+"""Tests of the Python extension module, run by ctest with the module directory in PYTHONPATH.
+
+The arrays are built with the array module, reshaped through memoryview, so that NumPy is not
+required; the NumPy specific tests are skipped when it is not installed.
+"""
+import array
+import math
+import random
+import threading
+import unittest
+
+import polygon_operations
+
+try:
+    import numpy
+except ImportError:
+    numpy = None
+
+
+def points_array(points, typecode='d'):
+    """(n, 2) buffer of the points"""
+    values = array.array(typecode, [coordinate for point in points for coordinate in point])
+    return memoryview(values).cast('B').cast(typecode, (len(points), 2))
+
+
+def offsets_array(polygons):
+    """Offsets of the polygons packed in CSR form"""
+    offsets = array.array('q', [0])
+    for polygon in polygons:
+        offsets.append(offsets[-1] + len(polygon))
+    return offsets
+
+
+def to_list(result):
+    """Nested lists of a result, viewed through the buffer protocol"""
+    return memoryview(result).tolist()
+
+
+def random_convex_polygon(center_x, center_y, radius, vertices_number):
+    """Random polygon moving counterclockwise with vertices on a circle"""
+    angles = sorted(random.uniform(0.0, 2.0 * math.pi) for _ in range(vertices_number))
+    return [(center_x + radius * math.cos(angle), center_y + radius * math.sin(angle)) for angle in angles]
+
+
+def cross(o, a, b):
+    return (a[0] - o[0]) * (b[1] - o[1]) - (a[1] - o[1]) * (b[0] - o[0])
+
+
+class ConvexHullTest(unittest.TestCase):
+    def test_square_with_interior_points(self):
+        points = [(0.5, 0.5), (0.0, 0.0), (1.0, 1.0), (0.2, 0.7), (1.0, 0.0), (0.0, 1.0)]
+        for predicate in ('fast', 'adaptive', 'mixed_precision'):
+            hull = to_list(polygon_operations.convex_hull(points_array(points), predicate))
+            self.assertEqual(hull, [[0.0, 0.0], [1.0, 0.0], [1.0, 1.0], [0.0, 1.0]])
+
+    def test_random_points_are_inside(self):
+        points = [(random.uniform(-1.0, 1.0), random.uniform(-1.0, 1.0)) for _ in range(1000)]
+        hull = [tuple(vertex) for vertex in to_list(polygon_operations.convex_hull(points_array(points)))]
+        for vertexId in range(len(hull)):
+            tail, head = hull[vertexId], hull[(vertexId + 1) % len(hull)]
+            self.assertTrue(all(cross(tail, head, point) >= 0.0 for point in points))
+
+    def test_float32(self):
+        points = [(0.0, 0.0), (2.0, 0.0), (2.0, 2.0), (0.0, 2.0), (1.0, 1.0)]
+        hull = to_list(polygon_operations.convex_hull(points_array(points, 'f')))
+        self.assertEqual(hull, [[0.0, 0.0], [2.0, 0.0], [2.0, 2.0], [0.0, 2.0]])
+
+    def test_invalid_arguments(self):
+        with self.assertRaises(ValueError):
+            polygon_operations.convex_hull(points_array([(0.0, 0.0), (1.0, 1.0), (2.0, 2.0)]))
+        with self.assertRaises(ValueError):
+            polygon_operations.convex_hull(points_array([(0.0, 0.0), (1.0, 0.0), (0.0, 1.0)]), 'exact')
+        with self.assertRaises(TypeError):
+            polygon_operations.convex_hull(array.array('d', [0.0, 0.0, 1.0, 0.0, 0.0, 1.0]))
+        with self.assertRaises(TypeError):
+            polygon_operations.convex_hull(points_array([(0, 0), (1, 0), (0, 1)], 'q'))
+
+
+class PointsInPolygonTest(unittest.TestCase):
+    def test_square(self):
+        square = points_array([(-1.0, -1.0), (1.0, -1.0), (1.0, 1.0), (-1.0, 1.0)])
+        points = points_array([(0.0, 0.0), (1.0, 0.5), (2.0, 0.0), (0.0, -1.5)])
+        for predicate in ('fast', 'adaptive', 'mixed_precision'):
+            inside = to_list(polygon_operations.points_in_polygon(points, square, predicate))
+            self.assertEqual(inside, [True, True, False, False])
+
+    def test_random_points(self):
+        polygon = random_convex_polygon(0.0, 0.0, 1.0, 30)
+        points = [(random.uniform(-1.5, 1.5), random.uniform(-1.5, 1.5)) for _ in range(1000)]
+        inside = to_list(polygon_operations.points_in_polygon(points_array(points), points_array(polygon)))
+        for point, pointInside in zip(points, inside):
+            edges = zip(polygon, polygon[1:] + polygon[:1])
+            self.assertEqual(pointInside, all(cross(tail, head, point) >= 0.0 for tail, head in edges))
+
+
+class BatchTest(unittest.TestCase):
+    def test_do_intersect_batch(self):
+        square = [(-1.0, -1.0), (1.0, -1.0), (1.0, 1.0), (-1.0, 1.0)]
+        polygons = [[(0.0, 0.0), (2.0, 0.0), (2.0, 2.0), (0.0, 2.0)],
+                    [(1.5, -1.0), (2.5, -1.0), (2.5, 1.0)],
+                    [(1.0, -1.0), (2.0, -1.0), (2.0, 1.0), (1.0, 1.0)]]
+        vertices = points_array([vertex for polygon in polygons for vertex in polygon])
+
+        # Against a single polygon and pairwise
+        result = polygon_operations.do_intersect_batch(vertices, offsets_array(polygons), points_array(square), offsets_array([square]))
+        self.assertEqual(to_list(result), [True, False, True])
+        squares = points_array(square * 3)
+        result = polygon_operations.do_intersect_batch(vertices, offsets_array(polygons), squares, offsets_array([square] * 3))
+        self.assertEqual(to_list(result), [True, False, True])
+
+        with self.assertRaises(ValueError):
+            polygon_operations.do_intersect_batch(vertices, offsets_array(polygons), squares, offsets_array([square] * 2))
+        with self.assertRaises(ValueError):
+            polygon_operations.do_intersect_batch(vertices, array.array('q', [0, 20]), squares, offsets_array([square]))
+
+    def test_polygon_metrics_batch(self):
+        polygons = [[(0.0, 0.0), (2.0, 0.0), (2.0, 1.0), (0.0, 1.0)], [], [(0.0, 0.0), (1.0, 0.0), (0.0, 1.0)]]
+        vertices = points_array([vertex for polygon in polygons for vertex in polygon])
+        for offsets in (offsets_array(polygons), array.array('i', offsets_array(polygons))):
+            metrics = to_list(polygon_operations.polygon_metrics_batch(vertices, offsets))
+            self.assertEqual(len(metrics), 3)
+            self.assertAlmostEqual(metrics[0][0], 2.0)
+            self.assertAlmostEqual(metrics[0][1], 1.0)
+            self.assertAlmostEqual(metrics[0][2], 0.5)
+            self.assertAlmostEqual(metrics[0][3], 6.0)
+            self.assertAlmostEqual(metrics[0][4], 2.0 / 3.0)
+            self.assertEqual(metrics[1], [0.0] * 7)
+            self.assertAlmostEqual(metrics[2][0], 0.5)
+
+    def test_threads(self):
+        polygon = points_array(random_convex_polygon(0.0, 0.0, 1.0, 50))
+        points = points_array([(random.uniform(-1.5, 1.5), random.uniform(-1.5, 1.5)) for _ in range(20000)])
+        expected = to_list(polygon_operations.points_in_polygon(points, polygon))
+        results = [None] * 4
+
+        def run(threadId):
+            results[threadId] = to_list(polygon_operations.points_in_polygon(points, polygon))
+
+        threads = [threading.Thread(target=run, args=(threadId,)) for threadId in range(4)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        self.assertEqual(results, [expected] * 4)
+
+
+@unittest.skipIf(numpy is None, "NumPy is not installed")
+class NumPyTest(unittest.TestCase):
+    def test_arrays(self):
+        points = numpy.random.default_rng().uniform(-1.0, 1.0, (1000, 2))
+        hull = polygon_operations.convex_hull(points)
+        self.assertIsInstance(hull, numpy.ndarray)
+        self.assertEqual(hull.dtype, numpy.float64)
+        self.assertEqual(hull.shape[1], 2)
+
+        inside = polygon_operations.points_in_polygon(points, hull)
+        self.assertEqual(inside.dtype, numpy.bool_)
+        self.assertTrue(inside.all())
+        self.assertEqual(polygon_operations.points_in_polygon(points.astype(numpy.float32), hull).shape, (1000,))
+
+        metrics = polygon_operations.polygon_metrics_batch(hull, numpy.array([0, len(hull)]))
+        self.assertEqual(metrics.shape, (1, 7))
+        with self.assertRaises(TypeError):
+            polygon_operations.convex_hull(points[:, ::-1])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,179 @@
+#include "polygon_operations/rotated_box.h"
+#include "gtest/gtest.h"
+#include <random>
+#include <cmath>
+
+std::random_device rd;  // Will be used to obtain a seed for the random number engine
+std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+
+// Utility functions
+RotatedBoxes CreateRandomBoxes(size_t boxesNumber, double areaSize)
+{
+    std::uniform_real_distribution<double> centerDistribution(0.0, areaSize);
+    std::uniform_real_distribution<double> sideDistribution(0.5, 3.0);
+    std::uniform_real_distribution<double> angleDistribution(-M_PI, M_PI);
+
+    RotatedBoxes boxes;
+    for (size_t boxId = 0; boxId < boxesNumber; ++boxId)
+    {
+        boxes.centerX.push_back(centerDistribution(gen));
+        boxes.centerY.push_back(centerDistribution(gen));
+        boxes.width.push_back(sideDistribution(gen));
+        boxes.height.push_back(sideDistribution(gen));
+        boxes.angle.push_back(angleDistribution(gen));
+    }
+    return boxes;
+}
+
+double Area(const std::vector<Point>& polygon)
+{
+    double doubleArea = 0.0;
+    for (size_t vertexId = 0; vertexId < polygon.size(); ++vertexId)
+    {
+        const Point& current = polygon[vertexId];
+        const Point& next = polygon[(vertexId + 1) % polygon.size()];
+        doubleArea += current.x * next.y - next.x * current.y;
+    }
+    return doubleArea / 2.0;
+}
+
+// Sutherland-Hodgman clipping of a polygon by all the edges of a convex polygon
+std::vector<Point> ClipReference(const std::vector<Point>& polygon, const std::vector<Point>& clipPolygon)
+{
+    std::vector<Point> result = polygon;
+    for (size_t edgeId = 0; (edgeId < clipPolygon.size()) && !result.empty(); ++edgeId)
+    {
+        const Point& tail = clipPolygon[edgeId];
+        const Point& head = clipPolygon[(edgeId + 1) % clipPolygon.size()];
+        auto side = [&](const Point& point) { return (head.x - tail.x) * (point.y - tail.y) - (head.y - tail.y) * (point.x - tail.x); };
+
+        std::vector<Point> clipped = {};
+        for (size_t vertexId = 0; vertexId < result.size(); ++vertexId)
+        {
+            const Point& current = result[vertexId];
+            const Point& next = result[(vertexId + 1) % result.size()];
+            if (side(current) >= 0)
+                clipped.push_back(current);
+            if ((side(current) >= 0) != (side(next) >= 0))
+            {
+                const double t = side(current) / (side(current) - side(next));
+                clipped.emplace_back(Point(current.x + t * (next.x - current.x), current.y + t * (next.y - current.y)));
+            }
+        }
+        result = clipped;
+    }
+    return result;
+}
+
+double ReferenceIou(const RotatedBoxes& boxes1, size_t boxId1, const RotatedBoxes& boxes2, size_t boxId2)
+{
+    const double intersectionArea = Area(ClipReference(rotated_box_corners(boxes1, boxId1), rotated_box_corners(boxes2, boxId2)));
+    const double unionArea = boxes1.width[boxId1] * boxes1.height[boxId1] + boxes2.width[boxId2] * boxes2.height[boxId2] - intersectionArea;
+    return intersectionArea / unionArea;
+}
+
+// Greedy suppression computing the whole IoU matrix
+std::vector<size_t> ReferenceNms(const RotatedBoxes& boxes, const std::vector<double>& scores, double iouThreshold)
+{
+    WorkStealingThreadPool pool(1);
+    std::vector<double> iou = {};
+    rotated_box_iou_matrix(boxes, boxes, pool, iou);
+
+    std::vector<size_t> order(scores.size());
+    for (size_t boxId = 0; boxId < order.size(); ++boxId)
+        order[boxId] = boxId;
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return scores[a] > scores[b]; });
+
+    std::vector<bool> suppressed(scores.size(), false);
+    std::vector<size_t> kept = {};
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        if (suppressed[order[i]])
+            continue;
+        kept.push_back(order[i]);
+        for (size_t j = i + 1; j < order.size(); ++j)
+            if (iou[order[i] * scores.size() + order[j]] > iouThreshold)
+                suppressed[order[j]] = true;
+    }
+    return kept;
+}
+
+TEST(RotatedBox, Parameter_arrays_of_different_sizes_exception)
+{
+    RotatedBoxes boxes = CreateRandomBoxes(3, 10.0);
+    boxes.angle.pop_back();
+    EXPECT_THROW(boxes.Size(), std::invalid_argument);
+    EXPECT_THROW(rotated_nms(CreateRandomBoxes(3, 10.0), {1.0, 2.0}, 0.5), std::invalid_argument);
+}
+
+TEST(RotatedBox, Corners)
+{
+    RotatedBoxes boxes = {{1.0}, {2.0}, {4.0}, {2.0}, {M_PI / 2}};
+    std::vector<Point> corners = rotated_box_corners(boxes, 0);
+    ASSERT_EQ(corners.size(), 4);
+    ASSERT_NEAR(corners[0].x, 2.0, 1e-12);
+    ASSERT_NEAR(corners[0].y, 0.0, 1e-12);
+    ASSERT_NEAR(corners[2].x, 0.0, 1e-12);
+    ASSERT_NEAR(corners[2].y, 4.0, 1e-12);
+    ASSERT_NEAR(Area(corners), 8.0, 1e-12);
+}
+
+TEST(RotatedBox, Iou_of_simple_boxes)
+{
+    RotatedBoxes boxes = {{0.0, 1.0, 0.0, 10.0, 0.0}, {0.0, 0.0, 0.0, 0.0, 0.0}, {2.0, 2.0, 2.0, 2.0, 0.0},
+                          {2.0, 2.0, 2.0, 2.0, 2.0}, {0.0, 0.0, M_PI / 4, 0.0, 0.0}};
+    ASSERT_DOUBLE_EQ(rotated_box_iou(boxes, 0, boxes, 0), 1.0);
+    ASSERT_NEAR(rotated_box_iou(boxes, 0, boxes, 1), 1.0 / 3.0, 1e-12);
+    ASSERT_NEAR(rotated_box_iou(boxes, 0, boxes, 2), ReferenceIou(boxes, 0, boxes, 2), 1e-12);
+    ASSERT_EQ(rotated_box_iou(boxes, 0, boxes, 3), 0.0);
+    // Zero-area box
+    ASSERT_EQ(rotated_box_iou(boxes, 0, boxes, 4), 0.0);
+}
+
+TEST(RotatedBox, Iou_matrix_against_clipping)
+{
+    RotatedBoxes boxes1 = CreateRandomBoxes(203, 20.0);
+    RotatedBoxes boxes2 = CreateRandomBoxes(157, 20.0);
+
+    for (size_t threadsNumber : {1, 4})
+    {
+        WorkStealingThreadPool pool(threadsNumber);
+        std::vector<double> iou = {};
+        rotated_box_iou_matrix(boxes1, boxes2, pool, iou);
+        ASSERT_EQ(iou.size(), boxes1.Size() * boxes2.Size());
+        for (size_t boxId1 = 0; boxId1 < boxes1.Size(); ++boxId1)
+        {
+            for (size_t boxId2 = 0; boxId2 < boxes2.Size(); ++boxId2)
+            {
+                ASSERT_NEAR(iou[boxId1 * boxes2.Size() + boxId2], ReferenceIou(boxes1, boxId1, boxes2, boxId2), 1e-9);
+                ASSERT_EQ(iou[boxId1 * boxes2.Size() + boxId2], rotated_box_iou(boxes1, boxId1, boxes2, boxId2));
+            }
+        }
+    }
+}
+
+TEST(RotatedBox, Nms_against_full_matrix)
+{
+    std::uniform_real_distribution<double> scoreDistribution(0.0, 1.0);
+    for (double iouThreshold : {0.0, 0.1, 0.5, 0.9})
+    {
+        RotatedBoxes boxes = CreateRandomBoxes(500, 15.0);
+        std::vector<double> scores = {};
+        for (size_t boxId = 0; boxId < boxes.Size(); ++boxId)
+            scores.push_back(scoreDistribution(gen));
+
+        ASSERT_EQ(rotated_nms(boxes, scores, iouThreshold), ReferenceNms(boxes, scores, iouThreshold));
+    }
+}
+
+TEST(RotatedBox, Nms_keeps_best_of_duplicates)
+{
+    RotatedBoxes boxes = {{0.0, 0.1, 5.0}, {0.0, 0.0, 5.0}, {2.0, 2.0, 2.0}, {1.0, 1.0, 1.0}, {0.3, 0.3, 0.3}};
+    ASSERT_EQ(rotated_nms(boxes, {0.5, 0.9, 0.7}, 0.5), std::vector<size_t>({1, 2}));
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
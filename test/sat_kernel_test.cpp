@@ -0,0 +1,138 @@
+#include "polygon_operations/sat_kernel.h"
+#include "polygon_operations/convex_polygon.h"
+#include "polygon_operations/convex_hull.h"
+#include "polygon_operations/minkowski.h"
+#include "gtest/gtest.h"
+#include "test_utilities.h"
+#include <random>
+#include <cmath>
+
+std::random_device rd;  // Will be used to obtain a seed for the random number engine
+std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+
+// Utility functions
+std::stack<Point> VectorToStack(const std::vector<Point>& polygon)
+{
+    std::stack<Point> polygonStack = {};
+    for (const auto& vertex : polygon)
+        polygonStack.push(vertex);
+    return polygonStack;
+}
+
+TEST(SATKernel, Projection_extents_against_linear_scan)
+{
+    std::uniform_real_distribution<double> distribution(-10.0, 10.0);
+
+    // Cover the scalar path, the SIMD path and the scalar tails
+    for (size_t verticesNumber = 1; verticesNumber < 70; ++verticesNumber)
+    {
+        std::vector<Point> vertices = {};
+        for (size_t iter = 0; iter < verticesNumber; ++iter)
+            vertices.emplace_back(Point(distribution(gen), distribution(gen)));
+        const Vector axis(distribution(gen), distribution(gen));
+
+        double minimum = DotProduct(axis, vertices[0]);
+        double maximum = minimum;
+        for (const auto& vertex : vertices)
+        {
+            minimum = std::min(minimum, DotProduct(axis, vertex));
+            maximum = std::max(maximum, DotProduct(axis, vertex));
+        }
+
+        ProjectionExtents extents = projection_extents(vertices.data(), vertices.size(), axis);
+        ASSERT_NEAR(extents.minimum, minimum, 1e-12);
+        ASSERT_NEAR(extents.maximum, maximum, 1e-12);
+    }
+}
+
+TEST(SATKernel, Invalid_arguments_exception)
+{
+    std::vector<Point> polygon1 = {{-1,-1}, {1,1}};
+    std::vector<Point> polygon2 = {{-1,-1}, {1,-1}, {1,1}, {-1,1}};
+
+    EXPECT_THROW(sat_do_intersect(polygon1.data(), polygon1.size(), polygon2.data(), polygon2.size()), std::invalid_argument);
+}
+
+TEST(SATKernel, Squares)
+{
+    std::vector<Point> polygon1 = {{-1,-1}, {1,-1}, {1,1}, {-1,1}};
+    std::vector<Point> intersecting = {{0,0}, {2,0}, {2,2}, {0,2}};
+    std::vector<Point> separated = {{1.5,-1}, {2.5,-1}, {2.5,1}, {1.5,1}};
+    std::vector<Point> onTheEdge = {{1,-1}, {2,-1}, {2,1}, {1,1}};
+
+    ASSERT_TRUE(sat_do_intersect(polygon1.data(), polygon1.size(), intersecting.data(), intersecting.size()));
+    ASSERT_FALSE(sat_do_intersect(polygon1.data(), polygon1.size(), separated.data(), separated.size()));
+    ASSERT_TRUE(sat_do_intersect(polygon1.data(), polygon1.size(), onTheEdge.data(), onTheEdge.size()));
+}
+
+TEST(SATKernel, Random_polygons_against_reference)
+{
+    std::uniform_real_distribution<double> centerDistribution(-3.0, 3.0);
+    std::uniform_int_distribution<size_t> sizeDistribution(3, 100);
+
+    for (size_t iter = 0; iter < 1000; ++iter)
+    {
+        std::vector<Point> polygon1 = CreateRandomConvexPolygon(centerDistribution(gen), centerDistribution(gen), 1.0, sizeDistribution(gen));
+        std::vector<Point> polygon2 = CreateRandomConvexPolygon(centerDistribution(gen), centerDistribution(gen), 1.5, sizeDistribution(gen));
+
+        const bool referenceResult = do_intersect_reference(polygon1, polygon2);
+        ASSERT_EQ(sat_do_intersect(polygon1.data(), polygon1.size(), polygon2.data(), polygon2.size()), referenceResult);
+        ASSERT_EQ(do_intersect(polygon1, polygon2), referenceResult);
+        ASSERT_EQ(do_intersect(VectorToStack(polygon1), VectorToStack(polygon2)), referenceResult);
+    }
+}
+
+TEST(SATKernel, Minimum_translation_of_squares)
+{
+    std::vector<Point> polygon1 = {{-1,-1}, {1,-1}, {1,1}, {-1,1}};
+    std::vector<Point> intersecting = {{0.5,-1}, {2.5,-1}, {2.5,1}, {0.5,1}};
+    std::vector<Point> separated = {{1.5,-1}, {2.5,-1}, {2.5,1}, {1.5,1}};
+
+    MinimumTranslation translation;
+    ASSERT_TRUE(do_intersect(polygon1, intersecting, translation));
+    ASSERT_DOUBLE_EQ(translation.direction.x, -1.0);
+    ASSERT_DOUBLE_EQ(translation.direction.y, 0.0);
+    ASSERT_DOUBLE_EQ(translation.depth, 0.5);
+
+    ASSERT_FALSE(do_intersect(polygon1, separated, translation));
+    EXPECT_THROW(do_intersect({{-1,-1}, {1,1}}, polygon1, translation), std::invalid_argument);
+}
+
+TEST(SATKernel, Random_minimum_translation_against_minkowski_difference)
+{
+    std::uniform_real_distribution<double> centerDistribution(-2.0, 2.0);
+    std::uniform_int_distribution<size_t> sizeDistribution(3, 60);
+
+    for (size_t iter = 0; iter < 1000; ++iter)
+    {
+        std::vector<Point> polygon1 = CreateRandomConvexPolygon(centerDistribution(gen), centerDistribution(gen), 1.0, sizeDistribution(gen));
+        std::vector<Point> polygon2 = CreateRandomConvexPolygon(centerDistribution(gen), centerDistribution(gen), 1.5, sizeDistribution(gen));
+
+        MinimumTranslation translation;
+        const bool intersect = do_intersect(polygon1, polygon2, translation);
+        ASSERT_EQ(intersect, do_intersect(polygon1, polygon2));
+        if (!intersect)
+            continue;
+
+        // The penetration depth is the distance of the origin from the boundary of the Minkowski difference
+        Point closestPoint(0, 0);
+        const double signedDistance = minkowski_signed_distance(minkowski_difference(polygon1, polygon2), closestPoint);
+        ASSERT_NEAR(translation.depth, -signedDistance, 1e-9);
+        ASSERT_NEAR(translation.direction.x * translation.direction.x + translation.direction.y * translation.direction.y, 1.0, 1e-12);
+        if (translation.depth < 1e-6)
+            continue;
+
+        // Moving polygon1 slightly further than the translation separates the polygons
+        std::vector<Point> moved = {};
+        for (const auto& vertex : polygon1)
+            moved.emplace_back(Point(vertex.x + 1.001 * translation.depth * translation.direction.x,
+                                     vertex.y + 1.001 * translation.depth * translation.direction.y));
+        ASSERT_FALSE(do_intersect(moved, polygon2));
+    }
+}
+
+int main(int argc, char **argv) 
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
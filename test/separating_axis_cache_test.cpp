@@ -0,0 +1,122 @@
+#include "polygon_operations/separating_axis_cache.h"
+#include "polygon_operations/convex_polygon.h"
+#include "gtest/gtest.h"
+#include <random>
+#include <cmath>
+
+std::random_device rd;  // Will be used to obtain a seed for the random number engine
+std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+
+// Utility functions
+std::vector<Point> CreateRegularPolygon(double centerX, double centerY, double radius, size_t verticesNumber)
+{
+    std::vector<Point> polygon = {};
+    for (size_t vertexId = 0; vertexId < verticesNumber; ++vertexId)
+    {
+        const double angle = 2.0 * M_PI * vertexId / verticesNumber;
+        polygon.emplace_back(Point(centerX + radius * cos(angle), centerY + radius * sin(angle)));
+    }
+    return polygon;
+}
+
+std::vector<Point> Translate(const std::vector<Point>& polygon, double dx, double dy)
+{
+    std::vector<Point> translated = {};
+    for (const auto& vertex : polygon)
+        translated.emplace_back(Point(vertex.x + dx, vertex.y + dy));
+    return translated;
+}
+
+TEST(SeparatingAxisCache, Invalid_capacity_exception)
+{
+    EXPECT_THROW(SeparatingAxisCache(0), std::invalid_argument);
+}
+
+TEST(SeparatingAxisCache, Lookup_and_store)
+{
+    SeparatingAxisCache cache(16);
+    CachedPairState state = {true, 0, 0};
+
+    ASSERT_FALSE(cache.Lookup(1, 2, state));
+    cache.Store(1, 2, {false, 2, 3});
+
+    // The pair is unordered
+    ASSERT_TRUE(cache.Lookup(2, 1, state));
+    ASSERT_FALSE(state.overlapping);
+    ASSERT_EQ(state.edgePolygonId, 2);
+    ASSERT_EQ(state.edgeIndex, 3);
+    ASSERT_EQ(cache.Size(), 1);
+
+    ASSERT_EQ(cache.Statistics().lookups, 2);
+    ASSERT_EQ(cache.Statistics().hits, 1);
+    ASSERT_DOUBLE_EQ(cache.Statistics().HitRate(), 0.5);
+
+    cache.Clear();
+    ASSERT_FALSE(cache.Lookup(1, 2, state));
+    ASSERT_EQ(cache.Size(), 0);
+}
+
+TEST(SeparatingAxisCache, Bounded_memory_with_eviction)
+{
+    SeparatingAxisCache cache(64);
+    const size_t capacity = cache.Capacity();
+    ASSERT_GE(capacity, 64);
+
+    for (size_t pairId = 0; pairId < 10 * capacity; ++pairId)
+        cache.Store(pairId, pairId + 1, {true, 0, 0});
+
+    ASSERT_EQ(cache.Size(), capacity);
+    ASSERT_EQ(cache.Statistics().evictions, 9 * capacity);
+
+    // The most recently stored pair survives
+    CachedPairState state = {false, 0, 0};
+    ASSERT_TRUE(cache.Lookup(10 * capacity - 1, 10 * capacity, state));
+    ASSERT_TRUE(state.overlapping);
+}
+
+TEST(SeparatingAxisCache, Same_results_as_do_intersect_over_frames)
+{
+    std::uniform_real_distribution<double> centerDistribution(-5.0, 5.0);
+    std::uniform_real_distribution<double> stepDistribution(-0.05, 0.05);
+    std::uniform_int_distribution<size_t> sizeDistribution(3, 40);
+
+    std::vector<std::vector<Point>> polygons = {};
+    for (size_t polygonId = 0; polygonId < 20; ++polygonId)
+        polygons.emplace_back(CreateRegularPolygon(centerDistribution(gen), centerDistribution(gen), 1.0, sizeDistribution(gen)));
+
+    SeparatingAxisCache cache(1024);
+    for (size_t frame = 0; frame < 50; ++frame)
+    {
+        for (auto& polygon : polygons)
+            polygon = Translate(polygon, stepDistribution(gen), stepDistribution(gen));
+
+        for (size_t i = 0; i < polygons.size(); ++i)
+        {
+            for (size_t j = i + 1; j < polygons.size(); ++j)
+            {
+                // Alternate the order of the pair between the frames
+                if (frame % 2 == 0)
+                {
+                    ASSERT_EQ(do_intersect(polygons[i], i, polygons[j], j, cache), do_intersect(polygons[i], polygons[j]));
+                }
+                else
+                {
+                    ASSERT_EQ(do_intersect(polygons[j], j, polygons[i], i, cache), do_intersect(polygons[j], polygons[i]));
+                }
+            }
+        }
+    }
+
+    // Every pair is found after the first frame and most separating axes still separate in the next frame
+    const auto& statistics = cache.Statistics();
+    const size_t pairsNumber = polygons.size() * (polygons.size() - 1) / 2;
+    ASSERT_EQ(statistics.hits, 49 * pairsNumber);
+    ASSERT_GT(statistics.axisReuses, statistics.hits / 2);
+    ASSERT_EQ(statistics.evictions, 0);
+}
+
+int main(int argc, char **argv) 
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,147 @@
+#include "polygon_operations/spatial_hash.h"
+#include "polygon_operations/convex_polygon.h"
+#include "gtest/gtest.h"
+#include <random>
+#include <cmath>
+
+std::random_device rd;  // Will be used to obtain a seed for the random number engine
+std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+
+// Utility functions
+std::vector<Point> CreateRegularPolygon(double centerX, double centerY, double radius, size_t verticesNumber)
+{
+    std::vector<Point> polygon = {};
+    for (size_t vertexId = 0; vertexId < verticesNumber; ++vertexId)
+    {
+        const double angle = 2.0 * M_PI * vertexId / verticesNumber;
+        polygon.emplace_back(Point(centerX + radius * cos(angle), centerY + radius * sin(angle)));
+    }
+    return polygon;
+}
+
+std::vector<std::vector<Point>> CreateRandomPolygons(size_t polygonsNumber, double areaSize)
+{
+    std::uniform_real_distribution<double> centerDistribution(-areaSize / 2, areaSize / 2);
+    std::uniform_real_distribution<double> radiusDistribution(0.4, 0.6);
+    std::uniform_int_distribution<size_t> sizeDistribution(3, 8);
+
+    std::vector<std::vector<Point>> polygons = {};
+    for (size_t polygonId = 0; polygonId < polygonsNumber; ++polygonId)
+        polygons.emplace_back(CreateRegularPolygon(centerDistribution(gen), centerDistribution(gen), radiusDistribution(gen), sizeDistribution(gen)));
+    return polygons;
+}
+
+std::vector<PolygonPair> BruteForceIntersectingPairs(const std::vector<std::vector<Point>>& polygons)
+{
+    std::vector<PolygonPair> pairs = {};
+    for (size_t i = 0; i < polygons.size(); ++i)
+        for (size_t j = i + 1; j < polygons.size(); ++j)
+            if (do_intersect(polygons[i], polygons[j]))
+                pairs.emplace_back(i, j);
+    return pairs;
+}
+
+std::vector<PolygonPair> Sorted(std::vector<PolygonPair> pairs)
+{
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+TEST(SpatialHashGrid, Invalid_cell_size_exception)
+{
+    EXPECT_THROW(SpatialHashGrid(-1.0), std::invalid_argument);
+}
+
+TEST(SpatialHashGrid, Non_finite_coordinates_exception)
+{
+    std::vector<Point> polygon1 = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+    std::vector<Point> polygon2 = {{0, 0}, {NAN, 0}, {1, 1}, {0, 1}};
+    std::vector<Point> polygon3 = {{0, 0}, {INFINITY, 0}, {1, 1}, {0, 1}};
+
+    SpatialHashGrid grid(1.0);
+    EXPECT_THROW(grid.FindCandidatePairs({polygon1, polygon2}), std::invalid_argument);
+    EXPECT_THROW(grid.FindCandidatePairs({polygon1, polygon3}), std::invalid_argument);
+    EXPECT_THROW(SpatialHashGrid grid2(INFINITY), std::invalid_argument);
+    EXPECT_THROW(SpatialHashGrid grid3(1.0, 0), std::invalid_argument);
+}
+
+TEST(SpatialHashGrid, Empty_input)
+{
+    SpatialHashGrid grid;
+    ASSERT_TRUE(grid.FindIntersectingPairs({}).empty());
+}
+
+TEST(SpatialHashGrid, Pairs_sharing_several_cells_are_reported_once)
+{
+    // Both squares cover the same 3x3 cells
+    std::vector<Point> polygon1 = {{0.1, 0.1}, {2.9, 0.1}, {2.9, 2.9}, {0.1, 2.9}};
+    std::vector<Point> polygon2 = {{0.2, 0.2}, {2.8, 0.2}, {2.8, 2.8}, {0.2, 2.8}};
+
+    SpatialHashGrid grid(1.0);
+    const std::vector<PolygonPair>& pairs = grid.FindIntersectingPairs({polygon1, polygon2});
+    ASSERT_EQ(pairs.size(), 1);
+    ASSERT_EQ(pairs[0], PolygonPair(0, 1));
+    ASSERT_EQ(grid.LastTimings().moves, 18);
+}
+
+TEST(SpatialHashGrid, Auto_tuned_cell_size)
+{
+    std::vector<std::vector<Point>> polygons = {{{0, 0}, {1, 0}, {1, 1}, {0, 1}}, {{5, 5}, {8, 5}, {8, 8}, {5, 8}}};
+
+    SpatialHashGrid grid;
+    grid.FindCandidatePairs(polygons);
+    ASSERT_DOUBLE_EQ(grid.CellSize(), 2.0);
+}
+
+TEST(SpatialHashGrid, Random_dense_polygons_against_brute_force)
+{
+    for (double cellSize : {0.0, 0.3, 1.0, 5.0})
+    {
+        std::vector<std::vector<Point>> polygons = CreateRandomPolygons(1500, 30.0);
+
+        SpatialHashGrid grid(cellSize);
+        ASSERT_EQ(Sorted(grid.FindIntersectingPairs(polygons)), BruteForceIntersectingPairs(polygons));
+        ASSERT_EQ(grid.LastTimings().confirmedPairs, grid.FindIntersectingPairs(polygons).size());
+        ASSERT_GE(grid.LastTimings().candidatePairs, grid.LastTimings().confirmedPairs);
+    }
+}
+
+TEST(SpatialHashGrid, Outliers_in_overflow_list_against_brute_force)
+{
+    std::vector<std::vector<Point>> polygons = CreateRandomPolygons(1000, 25.0);
+    // Polygons covering far more cells than the maximum, including two overlapping each other
+    // and one whose cells do not fit in 64-bit integers
+    polygons.push_back(CreateRegularPolygon(0.0, 0.0, 12.0, 16));
+    polygons.push_back(CreateRegularPolygon(3.0, -2.0, 1.0e6, 16));
+    polygons.push_back({{1.0e300, 1.0e300}, {1.1e300, 1.0e300}, {1.1e300, 1.1e300}, {1.0e300, 1.1e300}});
+
+    SpatialHashGrid grid(1.0, 16);
+    ASSERT_EQ(Sorted(grid.FindIntersectingPairs(polygons)), BruteForceIntersectingPairs(polygons));
+    ASSERT_EQ(grid.OverflowSize(), 3);
+    ASSERT_LE(grid.LastTimings().moves, 16 * polygons.size());
+}
+
+TEST(SpatialHashGrid, Rebuilds_over_frames)
+{
+    std::vector<std::vector<Point>> polygons = CreateRandomPolygons(1000, 25.0);
+    std::uniform_real_distribution<double> stepDistribution(-0.1, 0.1);
+
+    SpatialHashGrid grid;
+    for (size_t frame = 0; frame < 5; ++frame)
+    {
+        for (auto& polygon : polygons)
+        {
+            const double dx = stepDistribution(gen);
+            const double dy = stepDistribution(gen);
+            for (auto& vertex : polygon)
+                vertex = Point(vertex.x + dx, vertex.y + dy);
+        }
+        ASSERT_EQ(Sorted(grid.FindIntersectingPairs(polygons)), BruteForceIntersectingPairs(polygons));
+    }
+}
+
+int main(int argc, char **argv) 
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
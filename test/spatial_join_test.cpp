@@ -0,0 +1,126 @@
+#include "polygon_operations/spatial_join.h"
+#include "polygon_operations/convex_polygon.h"
+#include "gtest/gtest.h"
+#include <random>
+#include <cmath>
+#include <sstream>
+
+std::random_device rd;  // Will be used to obtain a seed for the random number engine
+std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+
+// Utility functions
+std::vector<Point> CreateRegularPolygon(double centerX, double centerY, double radius, size_t verticesNumber)
+{
+    std::vector<Point> polygon = {};
+    for (size_t vertexId = 0; vertexId < verticesNumber; ++vertexId)
+    {
+        const double angle = 2.0 * M_PI * vertexId / verticesNumber;
+        polygon.emplace_back(Point(centerX + radius * cos(angle), centerY + radius * sin(angle)));
+    }
+    return polygon;
+}
+
+std::vector<std::vector<Point>> CreateRandomPolygons(size_t polygonsNumber, double areaSize, double minimumRadius, double maximumRadius)
+{
+    std::uniform_real_distribution<double> centerDistribution(-areaSize / 2, areaSize / 2);
+    std::uniform_real_distribution<double> radiusDistribution(minimumRadius, maximumRadius);
+    std::uniform_int_distribution<size_t> sizeDistribution(3, 12);
+
+    std::vector<std::vector<Point>> polygons = {};
+    for (size_t polygonId = 0; polygonId < polygonsNumber; ++polygonId)
+        polygons.emplace_back(CreateRegularPolygon(centerDistribution(gen), centerDistribution(gen), radiusDistribution(gen), sizeDistribution(gen)));
+    return polygons;
+}
+
+std::vector<PolygonPair> BruteForceIntersectingPairs(const std::vector<std::vector<Point>>& polygons1, const std::vector<std::vector<Point>>& polygons2)
+{
+    std::vector<PolygonPair> pairs = {};
+    for (size_t id1 = 0; id1 < polygons1.size(); ++id1)
+        for (size_t id2 = 0; id2 < polygons2.size(); ++id2)
+            if (do_intersect(polygons1[id1], polygons2[id2]))
+                pairs.emplace_back(id1, id2);
+    return pairs;
+}
+
+std::vector<PolygonPair> CollectedJoin(const std::vector<std::vector<Point>>& polygons1, const std::vector<std::vector<Point>>& polygons2,
+                                       WorkStealingThreadPool& pool, size_t partitionsPerSide, size_t batchSize)
+{
+    std::vector<PolygonPair> pairs = {};
+    spatial_join(polygons1, polygons2, pool, [&](const std::vector<PolygonPair>& batch) {
+        EXPECT_LE(batch.size(), batchSize);
+        pairs.insert(pairs.end(), batch.begin(), batch.end());
+    }, partitionsPerSide, batchSize);
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+TEST(SpatialJoin, Empty_input)
+{
+    WorkStealingThreadPool pool(2);
+    std::vector<std::vector<Point>> polygons = CreateRandomPolygons(10, 5.0, 0.5, 1.0);
+    ASSERT_TRUE(CollectedJoin(polygons, {}, pool, 0, 16).empty());
+    ASSERT_TRUE(CollectedJoin({}, polygons, pool, 0, 16).empty());
+}
+
+TEST(SpatialJoin, Polygons_spanning_partitions_are_reported_once)
+{
+    // A large square covering the whole grid against small squares in every partition
+    std::vector<std::vector<Point>> polygons1 = {{{0, 0}, {10, 0}, {10, 10}, {0, 10}}};
+    std::vector<std::vector<Point>> polygons2 = {};
+    for (int x = 0; x < 10; ++x)
+        for (int y = 0; y < 10; ++y)
+            polygons2.push_back({{x + 0.25, y + 0.25}, {x + 0.75, y + 0.25}, {x + 0.75, y + 0.75}, {x + 0.25, y + 0.75}});
+
+    WorkStealingThreadPool pool(3);
+    const std::vector<PolygonPair> pairs = CollectedJoin(polygons1, polygons2, pool, 4, 7);
+    ASSERT_EQ(pairs, BruteForceIntersectingPairs(polygons1, polygons2));
+    ASSERT_EQ(pairs.size(), 100);
+}
+
+TEST(SpatialJoin, Random_collections_against_brute_force)
+{
+    std::vector<std::vector<Point>> polygons1 = CreateRandomPolygons(2000, 40.0, 0.2, 0.6);
+    std::vector<std::vector<Point>> polygons2 = CreateRandomPolygons(300, 40.0, 0.5, 3.0);
+    const std::vector<PolygonPair> bruteForcePairs = BruteForceIntersectingPairs(polygons1, polygons2);
+
+    for (size_t threadsNumber : {1, 4})
+    {
+        WorkStealingThreadPool pool(threadsNumber);
+        for (size_t partitionsPerSide : {0, 1, 3, 17, 64})
+            ASSERT_EQ(CollectedJoin(polygons1, polygons2, pool, partitionsPerSide, 32), bruteForcePairs);
+    }
+}
+
+TEST(SpatialJoin, Statistics)
+{
+    std::vector<std::vector<Point>> polygons1 = CreateRandomPolygons(500, 20.0, 0.2, 0.6);
+    std::vector<std::vector<Point>> polygons2 = CreateRandomPolygons(500, 20.0, 0.2, 0.6);
+
+    WorkStealingThreadPool pool(2);
+    size_t pairsNumber = 0;
+    const SpatialJoinStatistics statistics = spatial_join(polygons1, polygons2, pool, [&](const std::vector<PolygonPair>& batch) {
+        pairsNumber += batch.size();
+    }, 8);
+    ASSERT_EQ(statistics.intersectingPairs, pairsNumber);
+    ASSERT_EQ(statistics.intersectingPairs, BruteForceIntersectingPairs(polygons1, polygons2).size());
+    ASSERT_GE(statistics.candidatePairs, statistics.intersectingPairs);
+    ASSERT_GT(statistics.partitions, 1);
+    ASSERT_LE(statistics.partitions, 64);
+}
+
+TEST(SpatialJoin, Stream_output)
+{
+    std::vector<std::vector<Point>> polygons1 = {{{0, 0}, {2, 0}, {2, 2}, {0, 2}}, {{5, 5}, {6, 5}, {6, 6}, {5, 6}}};
+    std::vector<std::vector<Point>> polygons2 = {{{1, 1}, {3, 1}, {3, 3}, {1, 3}}};
+
+    WorkStealingThreadPool pool(2);
+    std::ostringstream output;
+    spatial_join(polygons1, polygons2, pool, output);
+    ASSERT_EQ(output.str(), "0 0\n");
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,117 @@
+#include "polygon_operations/sweep_and_prune.h"
+#include "polygon_operations/convex_polygon.h"
+#include "gtest/gtest.h"
+#include <random>
+#include <cmath>
+
+std::random_device rd;  // Will be used to obtain a seed for the random number engine
+std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
+
+// Utility functions
+std::vector<Point> CreateRegularPolygon(double centerX, double centerY, double radius, size_t verticesNumber)
+{
+    std::vector<Point> polygon = {};
+    for (size_t vertexId = 0; vertexId < verticesNumber; ++vertexId)
+    {
+        const double angle = 2.0 * M_PI * vertexId / verticesNumber;
+        polygon.emplace_back(Point(centerX + radius * cos(angle), centerY + radius * sin(angle)));
+    }
+    return polygon;
+}
+
+std::vector<std::vector<Point>> CreateRandomPolygons(size_t polygonsNumber, double areaSize)
+{
+    std::uniform_real_distribution<double> centerDistribution(0.0, areaSize);
+    std::uniform_real_distribution<double> radiusDistribution(0.2, 1.0);
+    std::uniform_int_distribution<size_t> sizeDistribution(3, 12);
+
+    std::vector<std::vector<Point>> polygons = {};
+    for (size_t polygonId = 0; polygonId < polygonsNumber; ++polygonId)
+        polygons.emplace_back(CreateRegularPolygon(centerDistribution(gen), centerDistribution(gen), radiusDistribution(gen), sizeDistribution(gen)));
+    return polygons;
+}
+
+std::vector<PolygonPair> BruteForceIntersectingPairs(const std::vector<std::vector<Point>>& polygons)
+{
+    std::vector<PolygonPair> pairs = {};
+    for (size_t i = 0; i < polygons.size(); ++i)
+        for (size_t j = i + 1; j < polygons.size(); ++j)
+            if (do_intersect(polygons[i], polygons[j]))
+                pairs.emplace_back(i, j);
+    return pairs;
+}
+
+std::vector<PolygonPair> Sorted(std::vector<PolygonPair> pairs)
+{
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+TEST(SweepAndPrune, Empty_and_single_polygon)
+{
+    SweepAndPrune sweepAndPrune;
+    ASSERT_TRUE(sweepAndPrune.FindIntersectingPairs({}).empty());
+    ASSERT_TRUE(sweepAndPrune.FindIntersectingPairs({CreateRegularPolygon(0, 0, 1, 4)}).empty());
+}
+
+TEST(SweepAndPrune, Candidates_without_intersection)
+{
+    // The bounding boxes overlap but the polygons do not
+    std::vector<Point> polygon1 = {{0, 0}, {1, 0}, {0, 1}};
+    std::vector<Point> polygon2 = {{1, 1}, {0.6, 1}, {1, 0.6}};
+
+    SweepAndPrune sweepAndPrune;
+    ASSERT_EQ(sweepAndPrune.FindCandidatePairs({polygon1, polygon2}).size(), 1);
+    ASSERT_TRUE(sweepAndPrune.FindIntersectingPairs({polygon1, polygon2}).empty());
+    ASSERT_EQ(sweepAndPrune.LastTimings().candidatePairs, 1);
+    ASSERT_EQ(sweepAndPrune.LastTimings().confirmedPairs, 0);
+}
+
+TEST(SweepAndPrune, Random_polygons_against_brute_force)
+{
+    std::vector<std::vector<Point>> polygons = CreateRandomPolygons(1000, 40.0);
+
+    SweepAndPrune sweepAndPrune;
+    ASSERT_EQ(Sorted(sweepAndPrune.FindIntersectingPairs(polygons)), BruteForceIntersectingPairs(polygons));
+}
+
+TEST(SweepAndPrune, Coherent_frames)
+{
+    std::vector<std::vector<Point>> polygons = CreateRandomPolygons(1000, 40.0);
+    std::uniform_real_distribution<double> stepDistribution(-0.05, 0.05);
+
+    SweepAndPrune sweepAndPrune;
+    sweepAndPrune.FindIntersectingPairs(polygons);
+
+    for (size_t frame = 0; frame < 10; ++frame)
+    {
+        for (auto& polygon : polygons)
+        {
+            const double dx = stepDistribution(gen);
+            const double dy = stepDistribution(gen);
+            for (auto& vertex : polygon)
+                vertex = Point(vertex.x + dx, vertex.y + dy);
+        }
+
+        ASSERT_EQ(Sorted(sweepAndPrune.FindIntersectingPairs(polygons)), BruteForceIntersectingPairs(polygons));
+
+        // Small motions only need a few moves of the insertion sort
+        const BroadPhaseTimings& timings = sweepAndPrune.LastTimings();
+        ASSERT_LT(timings.moves, 10 * polygons.size());
+        ASSERT_GE(timings.boundsUpdate, 0.0);
+        ASSERT_GE(timings.sort, 0.0);
+        ASSERT_GE(timings.sweep, 0.0);
+        ASSERT_GE(timings.narrowPhase, 0.0);
+        ASSERT_EQ(timings.confirmedPairs, sweepAndPrune.FindIntersectingPairs(polygons).size());
+    }
+
+    // A different number of polygons rebuilds the order
+    polygons.resize(500);
+    ASSERT_EQ(Sorted(sweepAndPrune.FindIntersectingPairs(polygons)), BruteForceIntersectingPairs(polygons));
+}
+
+int main(int argc, char **argv) 
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,37 @@
+#ifndef TEST_UTILITIES_H
+#define TEST_UTILITIES_H
+
+#include "polygon_operations/utilities.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+/// Random number engine, defined by every test executable
+extern std::mt19937 gen;
+
+/*!
+ * Random convex polygon with its vertices on a circle. Sorted random angles give a polygon moving
+ * counterclockwise, with fewer vertices than requested only when two angles coincide.
+ * \param centerX The x coordinate of the center of the circle
+ * \param centerY The y coordinate of the center of the circle
+ * \param radius The radius of the circle
+ * \param verticesNumber The number of random angles
+ * \return The vertices of the polygon moving counterclockwise
+ */
+inline std::vector<Point> CreateRandomConvexPolygon(double centerX, double centerY, double radius, size_t verticesNumber)
+{
+    std::uniform_real_distribution<double> angleDistribution(0.0, 2.0 * M_PI);
+    std::vector<double> angles = {};
+    for (size_t vertexId = 0; vertexId < verticesNumber; ++vertexId)
+        angles.push_back(angleDistribution(gen));
+    std::sort(angles.begin(), angles.end());
+    angles.erase(std::unique(angles.begin(), angles.end()), angles.end());
+
+    std::vector<Point> polygon = {};
+    for (double angle : angles)
+        polygon.emplace_back(Point(centerX + radius * cos(angle), centerY + radius * sin(angle)));
+    return polygon;
+}
+
+#endif
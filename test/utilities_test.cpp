@@ -175,6 +175,44 @@ TEST(SimpleUtilities, IsPointRightToTheEdge_error)
     }, std::invalid_argument);
 }
 
+TEST(SimpleUtilities, ComputeBoundingBox)
+{
+    std::vector<Point> points = {{0.5, -1.0}, {2.0, 0.0}, {-1.5, 3.0}};
+    BoundingBox box = ComputeBoundingBox(points);
+
+    ASSERT_EQ(box.minX, -1.5);
+    ASSERT_EQ(box.minY, -1.0);
+    ASSERT_EQ(box.maxX, 2.0);
+    ASSERT_EQ(box.maxY, 3.0);
+
+    ASSERT_TRUE(box.Overlaps({2.0, 3.0, 4.0, 4.0}));
+    ASSERT_FALSE(box.Overlaps({2.1, 0.0, 4.0, 4.0}));
+    EXPECT_THROW(ComputeBoundingBox({}), std::invalid_argument);
+}
+
+TEST(SimpleUtilities, CheckPointsCollinear_view)
+{
+    const Point points[] = {{0,0}, {1,1}, {2,2}, {3,4}};
+
+    ASSERT_TRUE(CheckPointsCollinear(points, 3));
+    ASSERT_FALSE(CheckPointsCollinear(points, 4));
+    EXPECT_THROW(CheckPointsCollinear(points, 2), std::invalid_argument);
+}
+
+TEST(SimpleUtilities, StackToVector)
+{
+    std::stack<Point> stack = {};
+    stack.push(Point(0.0, 0.0));
+    stack.push(Point(1.0, 0.0));
+    stack.push(Point(1.0, 1.0));
+
+    const std::vector<Point> fromBottom = {{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}};
+    const std::vector<Point> fromTop = {{1.0, 1.0}, {1.0, 0.0}, {0.0, 0.0}};
+    ASSERT_EQ(StackToVectorFromBottom(stack), fromBottom);
+    ASSERT_EQ(StackToVectorFromTop(stack), fromTop);
+    ASSERT_EQ(stack.size(), 3);
+}
+
 int main(int argc, char **argv) 
 {
     ::testing::InitGoogleTest(&argc, argv);